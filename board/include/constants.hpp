@@ -5,6 +5,8 @@ constexpr uint64_t SCREEN_WIDTH = 128; // OLED display width, in pixels
 constexpr uint64_t SCREEN_HEIGHT = 64; // OLED display height, in pixels
 constexpr uint8_t OLED_ADDR = 0x3C;
 constexpr uint32_t MONITOR_SPEED = 115200;
+constexpr uint32_t LOGGER_QUEUE_SIZE = 32; // Log messages waiting to be printed by the logger task, a power of two
+constexpr size_t LOGGER_ARGS_SIZE = 96; // Bytes for the arguments of a log message, %s strings are copied in here
 
 constexpr uint8_t A_PIN = 0;
 constexpr uint8_t B_PIN = 6;
@@ -24,12 +26,29 @@ constexpr uint8_t SDA_PIN = 8;
 constexpr uint8_t SCL_PIN = 4;
 
 constexpr uint8_t EVENT_QUEUE_SIZE = 16;
+constexpr uint32_t EVENT_TRACE_SIZE = 128; // Button events kept for the serial export, see core/transfer.hpp
 constexpr uint64_t DEBOUNCE_DELAY_US = 300000;
-constexpr uint64_t REPEAT_DELAY_US = 500000;
+constexpr uint64_t REPEAT_DELAY_US = 500000; // Hold time before the first repeat
+constexpr uint64_t REPEAT_INTERVAL_US = 300000; // Time between the first two repeats
+constexpr uint64_t MIN_REPEAT_INTERVAL_US = 50000; // Fastest repeat rate, reached after holding for about 2 s
+constexpr uint64_t REPEAT_ACCELERATION_PERCENT = 80; // Every repeat interval is this percentage of the previous one
+constexpr uint64_t LONG_PRESS_US = 800000; // Minimum hold time of a long press gesture
+constexpr uint64_t DOUBLE_PRESS_US = 600000; // Maximum time between the presses of a double press gesture, more than DEBOUNCE_DELAY_US
 
 constexpr uint64_t TIME_BEFORE_DEEPSLEEP_US = 60000000; // 1 minute of inactivity before going to deep sleep
 constexpr uint64_t DEEPSLEEP_GRACE_PERIOD_US = 5000000; // 5 seconds grace period in deep sleep before sleeping
 constexpr uint64_t UPDATE_STATUS_INTERVAL_MS = 1000; // Update status info every second
+constexpr uint64_t BATTERY_CHECK_INTERVAL_MS = 5000; // How often the battery level shown in the title bar is sampled
+constexpr uint64_t TEMPERATURE_SAMPLE_INTERVAL_MS = 5000; // How often the temperature sensors are read
+constexpr uint8_t TEMPERATURE_RESOLUTION_BITS = 12; // Default DS18B20 resolution, 9 to 12 bits
+constexpr uint64_t DATALOG_SAMPLE_INTERVAL_MS = 60000; // How often a record is added to the data log
+constexpr uint32_t DATALOG_BATCH_RECORDS = 16; // Records kept in RAM before they are written to flash together
+constexpr uint64_t NETWORK_BACKOFF_BASE_MS = 10000; // Delay before the first retry of a failed connection or network job
+constexpr uint64_t NETWORK_BACKOFF_CAP_MS = 30 * 60 * 1000; // Longest retry delay, reached after 8 failures in a row
+constexpr uint64_t NETWORK_COALESCE_MS = 5 * 60 * 1000; // Network jobs due this soon run early, in the same radio-on window
+constexpr uint64_t NETWORK_IDLE_CHECK_MS = 10 * 60 * 1000; // Longest time the network scheduler sleeps without looking at its jobs
+constexpr size_t MAX_NETWORK_JOBS = 4;
+constexpr uint64_t NTP_RESYNC_INTERVAL_MS = 12 * 3600 * 1000; // Age of the last NTP sync at which the RTC is synced again, a multiple of the 3 h weather refresh so both share a window
 
 constexpr float BATTERY_MAX_VOLTAGE = 4.2f; // Maximum battery voltage
 constexpr float BATTERY_MIN_VOLTAGE = 3.0f; // Minimum battery voltage
@@ -41,4 +60,6 @@ constexpr float BATTERY_DISCONNECTED_VOLTAGE = 1.0f; // Voltage indicating batte
 constexpr uint16_t MAX_ANALOG_READ = 4095; // 12-bit ADC
 constexpr float ANALOG_REF_VOLTAGE = 3.3f; // Reference voltage for ADC
 
-constexpr size_t DAYLIGHT_OFFSET_S = 3600; // Daylight saving time offset
\ No newline at end of file
+constexpr size_t DAYLIGHT_OFFSET_S = 3600; // Daylight saving time offset
+
+constexpr size_t MAX_WEATHER_LOCATIONS = 3; // Saved locations of the weather app, e.g. home, office and travel
\ No newline at end of file
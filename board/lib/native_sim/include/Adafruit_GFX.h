@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+
+// Host reimplementation of the parts of Adafruit_GFX used by the firmware, with the same drawing semantics.
+// Text uses the classic 5x7 font in a 6x8 cell, only printable ASCII has the Adafruit glyphs.
+class Adafruit_GFX : public Print {
+    public:
+        Adafruit_GFX(int16_t w, int16_t h);
+        virtual ~Adafruit_GFX() = default;
+
+        virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+        virtual void startWrite() {}
+        virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+        virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+        virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+        virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+        virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+        virtual void endWrite() {}
+
+        virtual void setRotation(uint8_t r);
+        virtual void invertDisplay(bool i) { (void)i; }
+
+        virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+        virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+        virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+        virtual void fillScreen(uint16_t color);
+        virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+        virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+        void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+        void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
+        void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+        void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color);
+        void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+        void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+        void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
+        void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
+
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+
+        void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+        void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y);
+        void getTextBounds(const char* string, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+        void getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+        void setTextSize(uint8_t s) { setTextSize(s, s); }
+        void setTextSize(uint8_t sx, uint8_t sy);
+        void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+        void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+        void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+        void setTextWrap(bool w) { wrap = w; }
+        void cp437(bool x = true) { _cp437 = x; }
+
+        using Print::write;
+        size_t write(uint8_t c) override;
+
+        int16_t width() const { return _width; }
+        int16_t height() const { return _height; }
+        uint8_t getRotation() const { return rotation; }
+        int16_t getCursorX() const { return cursor_x; }
+        int16_t getCursorY() const { return cursor_y; }
+
+    protected:
+        void charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy);
+
+        int16_t WIDTH;
+        int16_t HEIGHT;
+        int16_t _width;
+        int16_t _height;
+        int16_t cursor_x = 0;
+        int16_t cursor_y = 0;
+        uint16_t textcolor = 0xFFFF;
+        uint16_t textbgcolor = 0xFFFF;
+        uint8_t textsize_x = 1;
+        uint8_t textsize_y = 1;
+        uint8_t rotation = 0;
+        bool wrap = true;
+        bool _cp437 = false;
+};
+
+// 1 bit per pixel canvas in memory, rows are byte aligned and MSB first like drawBitmap() expects
+class GFXcanvas1 : public Adafruit_GFX {
+    public:
+        GFXcanvas1(uint16_t w, uint16_t h);
+        ~GFXcanvas1();
+        GFXcanvas1(const GFXcanvas1&) = delete;
+        GFXcanvas1& operator=(const GFXcanvas1&) = delete;
+
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+        void fillScreen(uint16_t color) override;
+        bool getPixel(int16_t x, int16_t y) const;
+        uint8_t* getBuffer() const { return buffer; }
+
+    private:
+        uint8_t* buffer;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#ifndef NO_ADAFRUIT_SSD1306_COLOR_COMPATIBILITY
+#define BLACK SSD1306_BLACK
+#define WHITE SSD1306_WHITE
+#define INVERSE SSD1306_INVERSE
+#endif
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_CHARGEPUMP 0x8D
+#define SSD1306_SEGREMAP 0xA0
+#define SSD1306_DISPLAYALLON_RESUME 0xA4
+#define SSD1306_DISPLAYALLON 0xA5
+#define SSD1306_NORMALDISPLAY 0xA6
+#define SSD1306_INVERTDISPLAY 0xA7
+#define SSD1306_SETMULTIPLEX 0xA8
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_COMSCANINC 0xC0
+#define SSD1306_COMSCANDEC 0xC8
+#define SSD1306_SETDISPLAYOFFSET 0xD3
+#define SSD1306_SETDISPLAYCLOCKDIV 0xD5
+#define SSD1306_SETPRECHARGE 0xD9
+#define SSD1306_SETCOMPINS 0xDA
+#define SSD1306_SETVCOMDETECT 0xDB
+#define SSD1306_SETLOWCOLUMN 0x00
+#define SSD1306_SETHIGHCOLUMN 0x10
+#define SSD1306_SETSTARTLINE 0x40
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_RIGHT_HORIZONTAL_SCROLL 0x26
+#define SSD1306_LEFT_HORIZONTAL_SCROLL 0x27
+#define SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29
+#define SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL 0x2A
+#define SSD1306_DEACTIVATE_SCROLL 0x2E
+#define SSD1306_ACTIVATE_SCROLL 0x2F
+#define SSD1306_SET_VERTICAL_SCROLL_AREA 0xA3
+
+// Largest I2C transmission, including the control byte, used when splitting display RAM writes
+#define WIRE_MAX MIN(256, I2C_BUFFER_LENGTH)
+
+// Host version of the Adafruit I2C SSD1306 driver, it issues the same bus traffic as the original library
+class Adafruit_SSD1306 : public Adafruit_GFX {
+    public:
+        Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rst_pin = -1, uint32_t clk_during = 400000UL, uint32_t clk_after = 100000UL);
+        ~Adafruit_SSD1306();
+        Adafruit_SSD1306(const Adafruit_SSD1306&) = delete;
+        Adafruit_SSD1306& operator=(const Adafruit_SSD1306&) = delete;
+
+        bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool reset = true, bool periph_begin = true);
+        void display();
+        void clearDisplay();
+        void invertDisplay(bool i) override;
+        void dim(bool dim);
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+        void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+        void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+        void startscrollright(uint8_t start, uint8_t stop);
+        void startscrollleft(uint8_t start, uint8_t stop);
+        void stopscroll();
+        void ssd1306_command(uint8_t c);
+        bool getPixel(int16_t x, int16_t y);
+        uint8_t* getBuffer() { return buffer; }
+
+    protected:
+        void ssd1306_command1(uint8_t c);
+        void ssd1306_commandList(const uint8_t* c, uint8_t n);
+
+        TwoWire* wire;
+        uint8_t* buffer = nullptr;
+        int8_t i2caddr = 0;
+        int8_t vccstate = SSD1306_SWITCHCAPVCC;
+        uint8_t contrast = 0;
+        uint32_t wireClk;
+        uint32_t restoreClk;
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+// Host stand-in for the subset of the arduino-esp32 core used by the firmware
+
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sys/param.h>
+#include <sys/time.h>
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "sim.hpp"
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t*>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t*>(addr))
+#define pgm_read_ptr(addr) (*reinterpret_cast<void* const*>(addr))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define ONLOW 0x04
+#define ONHIGH 0x05
+
+#define NUM_DIGITAL_PINS 22
+#define digitalPinToInterrupt(p) ((p) < NUM_DIGITAL_PINS ? (p) : -1)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+// Interrupt handlers run on the simulation thread while holding a global lock, these take and release it
+void noInterrupts();
+void interrupts();
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution_bits);
+
+// Internal temperature sensor of the SoC in celsius
+float temperatureRead();
+
+// Input register of the GPIO matrix, GPIO.in.val has one bit per pin
+struct gpio_in_reg_t {
+    volatile uint32_t val;
+};
+struct gpio_dev_t {
+    gpio_in_reg_t in;
+};
+extern gpio_dev_t GPIO;
+
+// Timer group API of arduino-esp32 2.x, the timer counts at 80 MHz / divider
+struct hw_timer_s;
+typedef struct hw_timer_s hw_timer_t;
+hw_timer_t* timerBegin(uint8_t timer, uint16_t divider, bool count_up);
+void timerEnd(hw_timer_t* timer);
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(void), bool edge);
+void timerDetachInterrupt(hw_timer_t* timer);
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarm_value, bool autoreload);
+void timerAlarmEnable(hw_timer_t* timer);
+void timerAlarmDisable(hw_timer_t* timer);
+
+// Sets TZ like the SNTP helper of arduino-esp32, the simulated RTC needs no network sync
+void configTime(long gmt_offset_sec, int daylight_offset_sec, const char* server1, const char* server2 = nullptr, const char* server3 = nullptr);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+// settimeofday() must move the simulated RTC, not the host clock
+int sim_settimeofday(const struct timeval* tv, const struct timezone* tz);
+#define settimeofday sim_settimeofday
+
+// Events of the USB-CDC port, Serial on the ESP32-C3 with ARDUINO_USB_CDC_ON_BOOT
+typedef enum {
+    ARDUINO_HW_CDC_ANY_EVENT = ESP_EVENT_ANY_ID,
+    ARDUINO_HW_CDC_CONNECTED_EVENT = 0,
+    ARDUINO_HW_CDC_BUS_RESET_EVENT,
+    ARDUINO_HW_CDC_RX_EVENT,
+    ARDUINO_HW_CDC_TX_EVENT,
+    ARDUINO_HW_CDC_DISCONNECTED_EVENT,
+    ARDUINO_HW_CDC_MAX_EVENT,
+} arduino_hw_cdc_event_t;
+
+class HardwareSerial : public Stream {
+    public:
+        void begin(unsigned long baud) { (void)baud; }
+        void end() {}
+        int available() override; // Bytes received on the pseudo terminal of sim::open_serial_pty(), 0 without it
+        int read() override;
+        int peek() override { return -1; }
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+        void flush() override;
+        operator bool() const { return true; }
+        // Only ARDUINO_HW_CDC_RX_EVENT is raised, from a thread of its own like the event task of the core, when
+        // bytes arrive on the pseudo terminal
+        void onEvent(arduino_hw_cdc_event_t event, esp_event_handler_t callback);
+};
+extern HardwareSerial Serial;
+
+void setup();
+void loop();
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127
+typedef uint8_t DeviceAddress[8];
+
+// Simulated DS18B20 sensors on a OneWire bus, they report sim::set_external_temperature() after the conversion time
+class DallasTemperature {
+    public:
+        explicit DallasTemperature(OneWire* bus) : bus(bus) {}
+
+        void begin();
+        uint8_t getDeviceCount();
+        bool getAddress(DeviceAddress address, uint8_t index);
+        bool isConnected(const DeviceAddress address);
+
+        void setResolution(uint8_t resolution);
+        bool setResolution(const DeviceAddress address, uint8_t resolution, bool skip_global_calculation = false);
+        uint8_t getResolution();
+        uint8_t getResolution(const DeviceAddress address);
+        void setWaitForConversion(bool wait) { wait_for_conversion = wait; }
+        bool getWaitForConversion() { return wait_for_conversion; }
+        static uint16_t millisToWaitForConversion(uint8_t resolution);
+
+        void requestTemperatures();
+        bool requestTemperaturesByAddress(const DeviceAddress address);
+        bool isConversionComplete();
+        float getTempC(const DeviceAddress address);
+        float getTempCByIndex(uint8_t index);
+
+    private:
+        OneWire* bus;
+        bool wait_for_conversion = true;
+        uint8_t resolution = 12;
+        uint64_t conversion_end_us = 0;
+        bool converted = false;
+        bool has_result = false; // A conversion ended since power on, the scratchpad no longer reads 85 C
+};
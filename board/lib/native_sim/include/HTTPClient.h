@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Arduino.h"
+#include "WiFiClientSecure.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+    HTTP_CODE_OK = 200,
+    HTTP_CODE_NO_CONTENT = 204,
+    HTTP_CODE_MOVED_PERMANENTLY = 301,
+    HTTP_CODE_FOUND = 302,
+    HTTP_CODE_NOT_MODIFIED = 304,
+    HTTP_CODE_BAD_REQUEST = 400,
+    HTTP_CODE_FORBIDDEN = 403,
+    HTTP_CODE_NOT_FOUND = 404,
+    HTTP_CODE_TOO_MANY_REQUESTS = 429,
+    HTTP_CODE_INTERNAL_SERVER_ERROR = 500,
+    HTTP_CODE_SERVICE_UNAVAILABLE = 503,
+} t_http_codes;
+
+// Requests are answered by the handler installed with sim::set_http_handler(), the connection is refused without one
+class HTTPClient {
+    public:
+        bool begin(WiFiClient& client, const String& url);
+        bool begin(const String& url);
+        void end();
+
+        void setReuse(bool reuse) { this->reuse = reuse; }
+        void useHTTP10(bool use_http10) { http10 = use_http10; }
+        void setTimeout(uint16_t timeout_ms) { (void)timeout_ms; }
+        void setConnectTimeout(int32_t timeout_ms) { (void)timeout_ms; }
+        void addHeader(const String& name, const String& value) { (void)name; (void)value; }
+
+        int GET();
+        int getSize() { return static_cast<int>(body.length()); }
+        String getString() { return body; }
+        WiFiClient& getStream() { return stream; }
+        WiFiClient* getStreamPtr() { return &stream; }
+        static String errorToString(int error);
+
+        // Number of requests that had to open a new connection instead of reusing a kept-alive one
+        static uint32_t connections_opened();
+
+        // Bytes of the request URLs and of the response bodies, headers and TLS records left out
+        static uint64_t bytes_transferred();
+
+    private:
+        class ResponseStream : public WiFiClient {
+            public:
+                void reset(const String* data) { this->data = data; position = 0; }
+                int available() override { return data != nullptr ? static_cast<int>(data->length() - position) : 0; }
+                int read() override { return available() > 0 ? static_cast<uint8_t>((*data)[position++]) : -1; }
+                int peek() override { return available() > 0 ? static_cast<uint8_t>((*data)[position]) : -1; }
+                uint8_t connected() override { return available() > 0; }
+            private:
+                const String* data = nullptr;
+                unsigned int position = 0;
+        };
+
+        String url;
+        String body;
+        ResponseStream stream;
+        bool reuse = true;
+        bool http10 = false;
+        bool kept_alive = false;
+        WiFiClient* client = nullptr;
+        uint32_t client_stops = 0;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+// Bus handle for the simulated DS18B20 sensors, see DallasTemperature.h
+class OneWire {
+    public:
+        explicit OneWire(uint8_t pin) : pin(pin) {}
+        uint8_t get_pin() const { return pin; }
+
+    private:
+        uint8_t pin;
+};
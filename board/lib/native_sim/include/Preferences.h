@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "WString.h"
+
+// In-memory stand-in for the NVS backed Preferences library, contents are lost when the simulation exits
+class Preferences {
+    public:
+        bool begin(const char* name, bool read_only = false, const char* partition_label = nullptr);
+        void end();
+
+        bool clear();
+        bool remove(const char* key);
+        bool isKey(const char* key);
+
+        size_t putBool(const char* key, bool value);
+        size_t putUChar(const char* key, uint8_t value);
+        size_t putUShort(const char* key, uint16_t value);
+        size_t putInt(const char* key, int32_t value);
+        size_t putUInt(const char* key, uint32_t value);
+        size_t putULong64(const char* key, uint64_t value);
+        size_t putFloat(const char* key, float value);
+        size_t putString(const char* key, const char* value);
+        size_t putString(const char* key, const String& value);
+        size_t putBytes(const char* key, const void* value, size_t length);
+
+        bool getBool(const char* key, bool default_value = false);
+        uint8_t getUChar(const char* key, uint8_t default_value = 0);
+        uint16_t getUShort(const char* key, uint16_t default_value = 0);
+        int32_t getInt(const char* key, int32_t default_value = 0);
+        uint32_t getUInt(const char* key, uint32_t default_value = 0);
+        uint64_t getULong64(const char* key, uint64_t default_value = 0);
+        float getFloat(const char* key, float default_value = NAN);
+        String getString(const char* key, const String& default_value = String());
+        size_t getBytesLength(const char* key);
+        size_t getBytes(const char* key, void* buffer, size_t max_length);
+
+    private:
+        bool put(const char* key, const void* value, size_t length);
+        bool get(const char* key, void* buffer, size_t length);
+
+        String name_space;
+        bool started = false;
+        bool read_only = false;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "WString.h"
+
+// Subset of the Arduino Print class, subclasses only need to implement write(uint8_t)
+class Print {
+    public:
+        virtual ~Print() = default;
+
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+        size_t write(const char* str);
+        size_t write(const char* buffer, size_t size) { return write(reinterpret_cast<const uint8_t*>(buffer), size); }
+
+        size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+        size_t print(const char* str);
+        size_t print(const String& str);
+        size_t print(char c);
+        size_t print(unsigned char value, int base = 10);
+        size_t print(int value, int base = 10);
+        size_t print(unsigned int value, int base = 10);
+        size_t print(long value, int base = 10);
+        size_t print(unsigned long value, int base = 10);
+        size_t print(long long value, int base = 10);
+        size_t print(unsigned long long value, int base = 10);
+        size_t print(double value, int digits = 2);
+
+        size_t println();
+        template<typename T>
+        size_t println(T value) {
+            size_t n = print(value);
+            return n + println();
+        }
+        template<typename T>
+        size_t println(T value, int format) {
+            size_t n = print(value, format);
+            return n + println();
+        }
+
+        virtual void flush() {}
+
+    private:
+        size_t print_number(unsigned long long value, int base, bool negative);
+};
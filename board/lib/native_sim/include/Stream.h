@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Print.h"
+
+// Subset of the Arduino Stream class
+class Stream : public Print {
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+
+        void setTimeout(unsigned long timeout_ms) { timeout = timeout_ms; }
+        unsigned long getTimeout() const { return timeout; }
+
+        virtual size_t readBytes(char* buffer, size_t length);
+        size_t readBytes(uint8_t* buffer, size_t length) { return readBytes(reinterpret_cast<char*>(buffer), length); }
+        String readString();
+
+    protected:
+        // Waits up to the stream timeout for the next byte, returns -1 on timeout
+        int timed_read();
+
+        unsigned long timeout = 1000;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Subset of the Arduino String class backed by std::string
+class String {
+    public:
+        String(const char* str = "") : data(str != nullptr ? str : "") {}
+        String(const std::string& str) : data(str) {}
+        explicit String(char c) : data(1, c) {}
+        explicit String(int value, unsigned char base = 10);
+        explicit String(unsigned int value, unsigned char base = 10);
+        explicit String(long value, unsigned char base = 10);
+        explicit String(unsigned long value, unsigned char base = 10);
+        explicit String(long long value, unsigned char base = 10);
+        explicit String(unsigned long long value, unsigned char base = 10);
+        explicit String(float value, unsigned char decimal_places = 2);
+        explicit String(double value, unsigned char decimal_places = 2);
+
+        const char* c_str() const { return data.c_str(); }
+        unsigned int length() const { return static_cast<unsigned int>(data.size()); }
+        bool isEmpty() const { return data.empty(); }
+        bool reserve(unsigned int size) { data.reserve(size); return true; }
+
+        char charAt(unsigned int index) const { return index < data.size() ? data[index] : '\0'; }
+        char operator[](unsigned int index) const { return charAt(index); }
+        char& operator[](unsigned int index) { return data[index]; }
+
+        bool concat(const String& str) { data += str.data; return true; }
+        bool concat(const char* str) { if (str == nullptr) return false; data += str; return true; }
+        bool concat(const char* str, unsigned int length) { if (str == nullptr) return false; data.append(str, length); return true; }
+        bool concat(char c) { data += c; return true; }
+        String& operator+=(const String& str) { concat(str); return *this; }
+        String& operator+=(const char* str) { concat(str); return *this; }
+        String& operator+=(char c) { concat(c); return *this; }
+
+        bool equals(const String& other) const { return data == other.data; }
+        bool equals(const char* other) const { return other != nullptr && data == other; }
+        bool operator==(const String& other) const { return equals(other); }
+        bool operator==(const char* other) const { return equals(other); }
+        bool operator!=(const String& other) const { return !equals(other); }
+        bool operator!=(const char* other) const { return !equals(other); }
+        bool operator<(const String& other) const { return data < other.data; }
+
+        bool startsWith(const String& prefix) const { return data.rfind(prefix.data, 0) == 0; }
+        bool endsWith(const String& suffix) const {
+            return data.size() >= suffix.data.size() && data.compare(data.size() - suffix.data.size(), suffix.data.size(), suffix.data) == 0;
+        }
+        int indexOf(char c, unsigned int from = 0) const;
+        int indexOf(const String& str, unsigned int from = 0) const;
+
+        String substring(unsigned int from) const { return substring(from, length()); }
+        String substring(unsigned int from, unsigned int to) const;
+        void remove(unsigned int index) { if (index < data.size()) data.erase(index); }
+        void remove(unsigned int index, unsigned int count) { if (index < data.size()) data.erase(index, count); }
+        void replace(const String& find, const String& replacement);
+        void replace(char find, char replacement);
+        void trim();
+        void toLowerCase();
+        void toUpperCase();
+
+        long toInt() const { return std::strtol(data.c_str(), nullptr, 10); }
+        float toFloat() const { return std::strtof(data.c_str(), nullptr); }
+        double toDouble() const { return std::strtod(data.c_str(), nullptr); }
+
+    private:
+        std::string data;
+};
+
+inline String operator+(const String& a, const String& b) { String ret = a; ret += b; return ret; }
+inline String operator+(const String& a, const char* b) { String ret = a; ret += b; return ret; }
+inline String operator+(const char* a, const String& b) { String ret = a; ret += b; return ret; }
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "WString.h"
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+} wl_status_t;
+
+typedef enum {
+    WIFI_MODE_NULL = 0,
+    WIFI_MODE_STA,
+    WIFI_MODE_AP,
+    WIFI_MODE_APSTA,
+} wifi_mode_t;
+#define WIFI_OFF WIFI_MODE_NULL
+#define WIFI_STA WIFI_MODE_STA
+#define WIFI_AP WIFI_MODE_AP
+#define WIFI_AP_STA WIFI_MODE_APSTA
+
+// Any SSID connects while sim::set_wifi_available(true), the link comes up after a short simulated delay
+class WiFiClass {
+    public:
+        wl_status_t begin(const char* ssid, const char* passphrase = nullptr);
+        wl_status_t begin(const String& ssid, const String& passphrase) { return begin(ssid.c_str(), passphrase.c_str()); }
+        bool disconnect(bool wifi_off = false, bool erase_ap = false);
+        bool mode(wifi_mode_t mode);
+        wifi_mode_t getMode();
+        bool hostname(const char* name) { (void)name; return true; }
+        bool setHostname(const char* name) { (void)name; return true; }
+        wl_status_t status();
+        bool isConnected() { return status() == WL_CONNECTED; }
+        int8_t RSSI();
+        String SSID();
+};
+extern WiFiClass WiFi;
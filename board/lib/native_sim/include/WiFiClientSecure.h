@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+// The simulation has no network stack, the client never connects
+class WiFiClient : public Stream {
+    public:
+        virtual ~WiFiClient() = default;
+        virtual int connect(const char* host, uint16_t port) { (void)host; (void)port; return 0; }
+        virtual void stop() { stops++; }
+        virtual uint8_t connected() { return 0; }
+        int available() override { return 0; }
+        int read() override { return -1; }
+        int peek() override { return -1; }
+        size_t write(uint8_t c) override { (void)c; return 0; }
+        using Print::write;
+        operator bool() { return connected(); }
+
+        uint32_t stops = 0; // Lets HTTPClient notice that its kept-alive connection was closed
+};
+
+class WiFiClientSecure : public WiFiClient {
+    public:
+        void setCACert(const char* root_ca) { (void)root_ca; }
+        void setInsecure() {}
+};
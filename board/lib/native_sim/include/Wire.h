@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Stream.h"
+
+#ifndef I2C_BUFFER_LENGTH
+#define I2C_BUFFER_LENGTH 128
+#endif
+
+// I2C master connected to a simulated SSD1306 panel, transmissions to any other address are NACKed
+class TwoWire : public Stream {
+    public:
+        bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+        bool end() { return true; }
+        bool setClock(uint32_t frequency);
+        uint32_t getClock() { return clock; }
+
+        void beginTransmission(uint8_t address);
+        uint8_t endTransmission(bool send_stop = true);
+        size_t write(uint8_t data) override;
+        size_t write(const uint8_t* data, size_t size) override;
+        using Print::write;
+
+        uint8_t requestFrom(uint8_t address, uint8_t quantity, bool send_stop = true) { (void)address; (void)quantity; (void)send_stop; return 0; }
+        int available() override { return 0; }
+        int read() override { return -1; }
+        int peek() override { return -1; }
+
+    private:
+        uint8_t address = 0;
+        uint8_t buffer[I2C_BUFFER_LENGTH];
+        size_t length = 0;
+        bool transmitting = false;
+        uint32_t clock = 100000;
+};
+extern TwoWire Wire;
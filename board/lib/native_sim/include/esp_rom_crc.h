@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+// CRC-16/CCITT reflected (poly 0x8408), crc and result inverted like the ROM function, 0 as crc gives CRC-16/X-25
+uint16_t esp_rom_crc16_le(uint16_t crc, const uint8_t* buf, uint32_t len);
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <sys/time.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+// Called on every simulated sync, when the network comes up or configTime() is called with it up
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+
+struct sim_queue;
+typedef struct sim_queue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+BaseType_t xQueuePeek(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+#define xQueueSendToBack(queue, item, ticks) xQueueSend((queue), (item), (ticks))
+#define xQueueSendFromISR(queue, item, woken) ((void)(woken), xQueueSend((queue), (item), 0))
+#define xQueueSendToBackFromISR(queue, item, woken) xQueueSendFromISR((queue), (item), (woken))
+#define xQueueOverwriteFromISR(queue, item, woken) ((void)(woken), xQueueOverwrite((queue), (item)))
+#define xQueueReceiveFromISR(queue, buffer, woken) ((void)(woken), xQueueReceive((queue), (buffer), 0))
+#define xQueueIsQueueFullFromISR(queue) (uxQueueSpacesAvailable(queue) == 0)
+#define xQueueIsQueueEmptyFromISR(queue) (uxQueueMessagesWaiting(queue) == 0)
+#define uxQueueMessagesWaitingFromISR(queue) uxQueueMessagesWaiting(queue)
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "esp_sleep.h"
+
+// Erasing the simulated NVS partition drops every Preferences namespace
+esp_err_t nvs_flash_init();
+esp_err_t nvs_flash_erase();
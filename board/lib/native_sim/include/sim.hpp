@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "WString.h"
+
+// Control interface of the host simulation, used by the native runner to drive the firmware
+namespace sim {
+    // Simulated time in microseconds since the simulation started, it runs get_speed() times faster than the host clock
+    uint64_t now_us();
+
+    // Converts a simulated duration into a host duration in microseconds
+    uint64_t to_host_us(uint64_t sim_us);
+
+    // Blocks the calling host thread until the simulated clock reaches sim_us
+    void sleep_until_us(uint64_t sim_us);
+
+    // Sets how many times faster than real time the simulation runs (1.0 = real time)
+    void set_speed(double speed);
+    double get_speed();
+
+    // Drives a GPIO input to the given level and fires the interrupt attached to it, if any
+    void set_pin_level(uint8_t pin, bool level);
+    bool get_pin_level(uint8_t pin);
+
+    // Sets the raw value returned by analogRead() for the given pin
+    void set_analog_value(uint8_t pin, uint16_t value);
+
+    // Returns the SSD1306 display RAM (128x64, page layout) as written over the simulated I2C bus
+    const uint8_t* panel_ram();
+    bool panel_is_on();
+
+    // Incremented every time a byte is written to the display RAM
+    uint64_t panel_revision();
+
+    // Total number of bytes put on the simulated I2C bus, including address and control bytes
+    uint64_t i2c_bytes_written();
+
+    // Writes the current content of the display RAM to a binary PBM file, returns false on error
+    bool write_pbm(const char* path);
+
+    // Makes the simulated access point reachable (or not) for WiFi.begin()
+    void set_wifi_available(bool available);
+
+    // Simulated time the WiFi radio has spent out of WIFI_MODE_NULL, the main power cost of the network
+    uint64_t wifi_radio_on_us();
+
+    // Answers the GET requests made through HTTPClient, returns the HTTP status code and fills body
+    typedef int (*http_handler_t)(const char* url, String& body);
+    void set_http_handler(http_handler_t handler);
+
+    // Sets the temperature reported by a simulated DS18B20 sensor, 0 is the first one found on the bus
+    void set_external_temperature(float celsius, uint8_t sensor = 0);
+
+    // Sets how many DS18B20 sensors answer on the bus (1 by default, at most 8)
+    void set_external_sensor_count(uint8_t count);
+
+    // Connects Serial to a new pseudo terminal instead of stdout, so a host program can also send data to the
+    // firmware. Returns the path of the terminal, nullptr on failure.
+    const char* open_serial_pty();
+
+    // Backs the data partition with the given label with the content of a file, returns false if it cannot be read.
+    // Writes and erases are written back to the file.
+    bool set_partition_file(const char* label, const char* path);
+
+    // Wall-clock time of the simulated RTC in microseconds since the Unix epoch
+    int64_t rtc_us();
+    void set_rtc_us(int64_t rtc_us);
+
+    // Runs setup() and then loop() forever in the "loopTask" task like the arduino-esp32 core does, after_loop (if
+    // not null) is called after every loop() iteration. Used by the runner and by the tests of the whole firmware.
+    void start_firmware(void (*after_loop)() = nullptr);
+}
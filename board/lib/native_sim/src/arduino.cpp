@@ -0,0 +1,762 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_rom_crc.h>
+#include <esp_sntp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "sim_internal.hpp"
+
+namespace {
+    std::mutex clock_mutex;
+    sim::internal::host_clock::time_point host_base = sim::internal::host_clock::now();
+    uint64_t sim_base_us = 0;
+    double speed = 1.0;
+
+    std::mutex rtc_mutex;
+    int64_t rtc_offset_us = 0; // rtc_us() - now_us()
+    bool sntp_configured = false;
+    sntp_sync_time_cb_t sntp_sync_callback = nullptr;
+
+    std::recursive_mutex isr_mutex;
+    std::mutex pin_mutex;
+    std::condition_variable pin_changed;
+    uint8_t pin_modes[NUM_DIGITAL_PINS] = {0};
+    uint16_t analog_values[NUM_DIGITAL_PINS] = {0};
+    void (*pin_isrs[NUM_DIGITAL_PINS])(void) = {nullptr};
+    int pin_isr_modes[NUM_DIGITAL_PINS] = {0};
+
+    std::mutex random_mutex;
+    std::mt19937 random_engine(0x5eed);
+
+    // Wake-up sources armed for the next sleep
+    uint64_t sleep_timer_us = 0;
+    bool sleep_timer_enabled = false;
+    uint32_t gpio_wakeup_low_mask = 0;
+    uint32_t gpio_wakeup_high_mask = 0;
+    bool gpio_wakeup_enabled = false;
+    esp_sleep_wakeup_cause_t wakeup_cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+gpio_dev_t GPIO = {{0xffffffff}}; // Inputs float high until the runner drives them
+HardwareSerial Serial;
+
+namespace sim {
+    uint64_t now_us() {
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(internal::host_clock::now() - host_base).count();
+        return sim_base_us + static_cast<uint64_t>(elapsed * speed);
+    }
+
+    uint64_t to_host_us(uint64_t sim_us) {
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        return static_cast<uint64_t>(sim_us / speed);
+    }
+
+    void set_speed(double new_speed) {
+        if (new_speed <= 0) {
+            return;
+        }
+        auto current = now_us();
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        host_base = internal::host_clock::now();
+        sim_base_us = current;
+        speed = new_speed;
+    }
+
+    double get_speed() {
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        return speed;
+    }
+
+    void set_pin_level(uint8_t pin, bool level) {
+        if (pin >= NUM_DIGITAL_PINS) {
+            return;
+        }
+        std::lock_guard<std::recursive_mutex> isr_guard(isr_mutex);
+        bool previous = (GPIO.in.val & (1u << pin)) != 0;
+        {
+            std::lock_guard<std::mutex> lock(pin_mutex);
+            if (level) {
+                GPIO.in.val = GPIO.in.val | (1u << pin);
+            } else {
+                GPIO.in.val = GPIO.in.val & ~(1u << pin);
+            }
+        }
+        pin_changed.notify_all();
+        auto isr = pin_isrs[pin];
+        if (isr == nullptr || previous == level) {
+            return;
+        }
+        switch (pin_isr_modes[pin]) {
+            case CHANGE:
+                isr();
+                break;
+            case RISING:
+                if (level) isr();
+                break;
+            case FALLING:
+                if (!level) isr();
+                break;
+            case ONLOW:
+                if (!level) isr();
+                break;
+            case ONHIGH:
+                if (level) isr();
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool get_pin_level(uint8_t pin) {
+        return pin < NUM_DIGITAL_PINS && (GPIO.in.val & (1u << pin)) != 0;
+    }
+
+    void set_analog_value(uint8_t pin, uint16_t value) {
+        if (pin < NUM_DIGITAL_PINS) {
+            analog_values[pin] = value;
+        }
+    }
+
+    int64_t rtc_us() {
+        std::lock_guard<std::mutex> lock(rtc_mutex);
+        return rtc_offset_us + static_cast<int64_t>(now_us());
+    }
+
+    void set_rtc_us(int64_t rtc_us) {
+        auto now = static_cast<int64_t>(now_us());
+        std::lock_guard<std::mutex> lock(rtc_mutex);
+        rtc_offset_us = rtc_us - now;
+    }
+
+    void sleep_until_us(uint64_t sim_us) {
+        std::this_thread::sleep_until(internal::host_deadline(sim_us));
+    }
+
+    void start_firmware(void (*after_loop)()) {
+        static void (*hook)() = nullptr;
+        hook = after_loop;
+        xTaskCreate([](void* param) {
+            (void)param;
+            setup();
+            while (true) {
+                loop();
+                if (hook != nullptr) {
+                    hook();
+                }
+            }
+        }, "loopTask", 8192, nullptr, 1, nullptr);
+    }
+}
+
+namespace sim::internal {
+    std::recursive_mutex& interrupt_lock() {
+        return isr_mutex;
+    }
+
+    host_clock::time_point host_deadline(uint64_t sim_deadline_us) {
+        auto now = now_us();
+        auto remaining = sim_deadline_us > now ? sim_deadline_us - now : 0;
+        if (remaining > (1ULL << 50)) {
+            return host_clock::time_point::max(); // Far enough to never expire
+        }
+        return host_clock::now() + std::chrono::microseconds(to_host_us(remaining));
+    }
+
+    host_clock::time_point tick_deadline(uint32_t ticks) {
+        if (ticks == portMAX_DELAY) {
+            return host_clock::time_point::max();
+        }
+        return host_deadline(now_us() + static_cast<uint64_t>(ticks) * portTICK_PERIOD_MS * 1000);
+    }
+
+    void sleep_us(uint64_t sim_us) {
+        std::this_thread::sleep_until(host_deadline(now_us() + sim_us));
+    }
+
+    void on_network_up() {
+        bool sync = false;
+        sntp_sync_time_cb_t callback = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(rtc_mutex);
+            sync = sntp_configured;
+            callback = sntp_sync_callback;
+        }
+        if (!sync) {
+            return;
+        }
+        if (sim::rtc_us() < 1577836800LL * 1000000) {
+            // Not synced yet, pretend the NTP server answered with the host clock
+            auto wall = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            sim::set_rtc_us(wall);
+        }
+        // A simulated RTC does not drift, a sync once it is set leaves it where it is
+        if (callback != nullptr) {
+            int64_t rtc = sim::rtc_us();
+            timeval tv = {static_cast<time_t>(rtc / 1000000), static_cast<suseconds_t>(rtc % 1000000)};
+            callback(&tv);
+        }
+    }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin < NUM_DIGITAL_PINS) {
+        pin_modes[pin] = mode;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < NUM_DIGITAL_PINS && pin_modes[pin] == OUTPUT) {
+        std::lock_guard<std::mutex> lock(pin_mutex);
+        if (value) {
+            GPIO.in.val = GPIO.in.val | (1u << pin);
+        } else {
+            GPIO.in.val = GPIO.in.val & ~(1u << pin);
+        }
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    return sim::get_pin_level(pin) ? HIGH : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    return pin < NUM_DIGITAL_PINS ? analog_values[pin] : 0;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+    if (pin >= NUM_DIGITAL_PINS) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(isr_mutex);
+    pin_isrs[pin] = isr;
+    pin_isr_modes[pin] = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin >= NUM_DIGITAL_PINS) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(isr_mutex);
+    pin_isrs[pin] = nullptr;
+}
+
+void noInterrupts() {
+    isr_mutex.lock();
+}
+
+void interrupts() {
+    isr_mutex.unlock();
+}
+
+void vPortEnterCritical(portMUX_TYPE* mux) {
+    (void)mux;
+    isr_mutex.lock();
+}
+
+void vPortExitCritical(portMUX_TYPE* mux) {
+    (void)mux;
+    isr_mutex.unlock();
+}
+
+unsigned long millis() {
+    return static_cast<unsigned long>(sim::now_us() / 1000);
+}
+
+unsigned long micros() {
+    return static_cast<unsigned long>(sim::now_us());
+}
+
+void delay(uint32_t ms) {
+    sim::internal::sleep_us(static_cast<uint64_t>(ms) * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    sim::internal::sleep_us(us);
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+long random(long max) {
+    return random(0, max);
+}
+
+long random(long min, long max) {
+    if (min >= max) {
+        return min;
+    }
+    std::lock_guard<std::mutex> lock(random_mutex);
+    return std::uniform_int_distribution<long>(min, max - 1)(random_engine);
+}
+
+void randomSeed(unsigned long seed) {
+    std::lock_guard<std::mutex> lock(random_mutex);
+    random_engine.seed(seed);
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+    (void)pin;
+    (void)frequency;
+    (void)duration;
+}
+
+void noTone(uint8_t pin) {
+    (void)pin;
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution_bits) {
+    (void)channel;
+    (void)resolution_bits;
+    return freq;
+}
+
+float temperatureRead() {
+    return 35.0f;
+}
+
+int64_t esp_timer_get_time() {
+    return static_cast<int64_t>(sim::now_us());
+}
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    std::string name;
+    std::mutex mutex;
+    std::condition_variable changed;
+    uint64_t deadline = 0; // Simulated time of the next expiry, 0 when stopped
+    uint64_t period = 0; // 0 for one-shot timers
+    bool deleted = false;
+};
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle) {
+    if (create_args == nullptr || create_args->callback == nullptr || out_handle == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    auto timer = new esp_timer();
+    timer->callback = create_args->callback;
+    timer->arg = create_args->arg;
+    timer->name = create_args->name != nullptr ? create_args->name : "esp_timer";
+    std::thread([timer]() {
+        sim::internal::set_thread_name(timer->name.c_str());
+        std::unique_lock<std::mutex> lock(timer->mutex);
+        while (!timer->deleted) {
+            if (timer->deadline == 0) {
+                timer->changed.wait(lock);
+                continue;
+            }
+            uint64_t deadline = timer->deadline;
+            if (timer->changed.wait_until(lock, sim::internal::host_deadline(deadline),
+                    [timer, deadline]() { return timer->deleted || timer->deadline != deadline; })) {
+                continue; // Restarted, stopped or deleted
+            }
+            timer->deadline = timer->period != 0 ? deadline + timer->period : 0;
+            lock.unlock();
+            timer->callback(timer->arg);
+            lock.lock();
+        }
+        lock.unlock();
+        delete timer;
+    }).detach();
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+namespace {
+    esp_err_t start_timer(esp_timer_handle_t timer, uint64_t timeout_us, uint64_t period) {
+        {
+            std::lock_guard<std::mutex> lock(timer->mutex);
+            if (timer->deadline != 0) {
+                return ESP_ERR_INVALID_STATE;
+            }
+            timer->deadline = sim::now_us() + std::max<uint64_t>(timeout_us, 1);
+            timer->period = period;
+        }
+        timer->changed.notify_all();
+        return ESP_OK;
+    }
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    return start_timer(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    return start_timer(timer, period, std::max<uint64_t>(period, 1));
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    {
+        std::lock_guard<std::mutex> lock(timer->mutex);
+        if (timer->deadline == 0) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        timer->deadline = 0;
+    }
+    timer->changed.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    {
+        std::lock_guard<std::mutex> lock(timer->mutex);
+        if (timer->deadline != 0) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        timer->deleted = true;
+    }
+    timer->changed.notify_all();
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    return timer->deadline != 0;
+}
+
+// Timer group
+
+struct hw_timer_s {
+    uint16_t divider = 1;
+    uint64_t alarm = 0;
+    bool autoreload = false;
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> running{true};
+    void (*isr)(void) = nullptr;
+    std::thread thread;
+};
+
+hw_timer_t* timerBegin(uint8_t timer, uint16_t divider, bool count_up) {
+    (void)timer;
+    (void)count_up;
+    auto t = new hw_timer_t();
+    t->divider = divider != 0 ? divider : 1;
+    return t;
+}
+
+void timerEnd(hw_timer_t* timer) {
+    if (timer == nullptr) {
+        return;
+    }
+    timer->running = false;
+    if (timer->thread.joinable()) {
+        timer->thread.join();
+    }
+    delete timer;
+}
+
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(void), bool edge) {
+    (void)edge;
+    std::lock_guard<std::recursive_mutex> lock(isr_mutex);
+    timer->isr = isr;
+}
+
+void timerDetachInterrupt(hw_timer_t* timer) {
+    std::lock_guard<std::recursive_mutex> lock(isr_mutex);
+    timer->isr = nullptr;
+}
+
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarm_value, bool autoreload) {
+    timer->alarm = alarm_value;
+    timer->autoreload = autoreload;
+}
+
+void timerAlarmEnable(hw_timer_t* timer) {
+    timer->enabled = true;
+    if (timer->thread.joinable()) {
+        return;
+    }
+    timer->thread = std::thread([timer]() {
+        sim::internal::set_thread_name("Timer");
+        // The timer group runs from the 80 MHz APB clock
+        uint64_t period_us = std::max<uint64_t>(1, timer->alarm * timer->divider / 80);
+        uint64_t next = sim::now_us() + period_us;
+        while (timer->running) {
+            std::this_thread::sleep_until(sim::internal::host_deadline(next));
+            next += period_us;
+            if (!timer->enabled) {
+                continue;
+            }
+            std::lock_guard<std::recursive_mutex> lock(isr_mutex);
+            if (timer->isr != nullptr) {
+                timer->isr();
+            }
+            if (!timer->autoreload) {
+                timer->enabled = false;
+            }
+        }
+    });
+}
+
+void timerAlarmDisable(hw_timer_t* timer) {
+    timer->enabled = false;
+}
+
+// Time
+
+void configTime(long gmt_offset_sec, int daylight_offset_sec, const char* server1, const char* server2, const char* server3) {
+    (void)server1;
+    (void)server2;
+    (void)server3;
+    // Same TZ string as setTimeZone() in esp32-hal-time.c
+    long offset = -gmt_offset_sec;
+    // Sized for the longest "UTC%ld:%02u:%02u" a long offset can produce, so nothing is ever truncated
+    char cst[32] = {0};
+    char cdt[32] = "DST";
+    char tz[64] = {0};
+    if (offset % 3600) {
+        snprintf(cst, sizeof(cst), "UTC%ld:%02u:%02u", offset / 3600, static_cast<unsigned>(labs((offset % 3600) / 60)), static_cast<unsigned>(labs(offset % 60)));
+    } else {
+        snprintf(cst, sizeof(cst), "UTC%ld", offset / 3600);
+    }
+    if (daylight_offset_sec != 3600) {
+        long tz_dst = offset - daylight_offset_sec;
+        if (tz_dst % 3600) {
+            snprintf(cdt, sizeof(cdt), "DST%ld:%02u:%02u", tz_dst / 3600, static_cast<unsigned>(labs((tz_dst % 3600) / 60)), static_cast<unsigned>(labs(tz_dst % 60)));
+        } else {
+            snprintf(cdt, sizeof(cdt), "DST%ld", tz_dst / 3600);
+        }
+    }
+    snprintf(tz, sizeof(tz), "%s%s", cst, cdt);
+    setenv("TZ", tz, 1);
+    tzset();
+    {
+        std::lock_guard<std::mutex> lock(rtc_mutex);
+        sntp_configured = true;
+    }
+    if (WiFi.isConnected()) {
+        sim::internal::on_network_up();
+    }
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    std::lock_guard<std::mutex> lock(rtc_mutex);
+    sntp_sync_callback = callback;
+}
+
+bool getLocalTime(struct tm* info, uint32_t ms) {
+    uint32_t start = millis();
+    while (true) {
+        time_t now = static_cast<time_t>(sim::rtc_us() / 1000000);
+        localtime_r(&now, info);
+        if (info->tm_year > (2016 - 1900)) {
+            return true;
+        }
+        if (millis() - start >= ms) {
+            return false;
+        }
+        delay(10);
+    }
+}
+
+int sim_settimeofday(const struct timeval* tv, const struct timezone* tz) {
+    (void)tz;
+    if (tv == nullptr) {
+        return -1;
+    }
+    sim::set_rtc_us(static_cast<int64_t>(tv->tv_sec) * 1000000 + tv->tv_usec);
+    return 0;
+}
+
+// Sleep
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    if (gpio_num < 0 || gpio_num >= GPIO_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (intr_type == GPIO_INTR_LOW_LEVEL) {
+        gpio_wakeup_low_mask |= 1u << gpio_num;
+    } else if (intr_type == GPIO_INTR_HIGH_LEVEL) {
+        gpio_wakeup_high_mask |= 1u << gpio_num;
+    } else {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num) {
+    if (gpio_num < 0 || gpio_num >= GPIO_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_wakeup_low_mask &= ~(1u << gpio_num);
+    gpio_wakeup_high_mask &= ~(1u << gpio_num);
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+    gpio_wakeup_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    sleep_timer_us = time_in_us;
+    sleep_timer_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+    if (source == ESP_SLEEP_WAKEUP_TIMER || source == ESP_SLEEP_WAKEUP_ALL) {
+        sleep_timer_enabled = false;
+    }
+    if (source == ESP_SLEEP_WAKEUP_GPIO || source == ESP_SLEEP_WAKEUP_ALL) {
+        gpio_wakeup_enabled = false;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_deep_sleep_enable_gpio_wakeup(uint64_t gpio_pin_mask, esp_deepsleep_gpio_wake_up_mode_t mode) {
+    (void)gpio_pin_mask;
+    (void)mode;
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return wakeup_cause;
+}
+
+esp_err_t esp_light_sleep_start() {
+    auto gpio_wakes = [](uint32_t in) {
+        return gpio_wakeup_enabled && ((~in & gpio_wakeup_low_mask) != 0 || (in & gpio_wakeup_high_mask) != 0);
+    };
+    auto deadline = sleep_timer_enabled ? sim::internal::host_deadline(sim::now_us() + sleep_timer_us) : sim::internal::host_clock::time_point::max();
+    std::unique_lock<std::mutex> lock(pin_mutex);
+    if (pin_changed.wait_until(lock, deadline, [&]() { return gpio_wakes(GPIO.in.val); })) {
+        wakeup_cause = ESP_SLEEP_WAKEUP_GPIO;
+    } else {
+        wakeup_cause = ESP_SLEEP_WAKEUP_TIMER;
+    }
+    return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+    Serial.printf("[sim] deep-sleep entered at %.3f s, stopping\n", sim::now_us() / 1e6);
+    Serial.flush();
+    std::_Exit(0);
+}
+
+// ROM
+
+uint16_t esp_rom_crc16_le(uint16_t crc, const uint8_t* buf, uint32_t len) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; ++i) {
+        crc ^= buf[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+// Serial
+
+namespace {
+    int serial_fd = -1; // Master side of the pseudo terminal, -1 to print to stdout and receive nothing
+    int serial_slave_fd = -1; // Kept open so the master doesn't fail while no client has the port open
+    std::mutex serial_mutex; // Every write reaches the port in one piece, like on the USB-CDC driver
+    std::atomic<esp_event_handler_t> serial_rx_handler{nullptr};
+
+    void serial_rx_thread() {
+        sim::internal::set_thread_name("cdc_events");
+        while (true) {
+            pollfd descriptor = {serial_fd, POLLIN, 0};
+            if (serial_fd < 0 || poll(&descriptor, 1, 100) <= 0 || !(descriptor.revents & POLLIN)) {
+                // Nothing opened, nothing received or no client on the other side
+                std::this_thread::sleep_for(std::chrono::milliseconds(serial_fd < 0 || descriptor.revents != 0 ? 10 : 0));
+                continue;
+            }
+            // Raised again every millisecond while bytes are left unread, like the driver raising one event per
+            // packet, so bytes arriving after the firmware emptied the buffer also get an event
+            do {
+                esp_event_handler_t handler = serial_rx_handler.load();
+                if (handler != nullptr) {
+                    handler(&Serial, "ARDUINO_HW_CDC_EVENTS", ARDUINO_HW_CDC_RX_EVENT, nullptr);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            } while (Serial.available() > 0);
+        }
+    }
+}
+
+namespace sim {
+    const char* open_serial_pty() {
+        int fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+            return nullptr;
+        }
+        const char* path = ptsname(fd);
+        serial_slave_fd = open(path, O_RDWR | O_NOCTTY);
+        // Raw bytes both ways, the binary export protocol goes through it
+        termios attributes;
+        tcgetattr(serial_slave_fd, &attributes);
+        cfmakeraw(&attributes);
+        tcsetattr(serial_slave_fd, TCSANOW, &attributes);
+        serial_fd = fd;
+        return path;
+    }
+}
+
+int HardwareSerial::available() {
+    int count = 0;
+    if (serial_fd < 0 || ioctl(serial_fd, FIONREAD, &count) != 0) {
+        return 0;
+    }
+    return count;
+}
+
+int HardwareSerial::read() {
+    uint8_t c;
+    if (available() == 0 || ::read(serial_fd, &c, 1) != 1) {
+        return -1;
+    }
+    return c;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    if (serial_fd < 0) {
+        return fwrite(buffer, 1, size, stdout);
+    }
+    size_t written = 0;
+    while (written < size) {
+        ssize_t result = ::write(serial_fd, buffer + written, size - written);
+        if (result <= 0) {
+            break;
+        }
+        written += result;
+    }
+    return written;
+}
+
+void HardwareSerial::onEvent(arduino_hw_cdc_event_t event, esp_event_handler_t callback) {
+    if (event != ARDUINO_HW_CDC_RX_EVENT && event != ARDUINO_HW_CDC_ANY_EVENT) {
+        return;
+    }
+    if (serial_rx_handler.exchange(callback) == nullptr) {
+        std::thread(serial_rx_thread).detach();
+    }
+}
+
+void HardwareSerial::flush() {
+    if (serial_fd < 0) {
+        fflush(stdout);
+    }
+}
@@ -0,0 +1,322 @@
+#include <Arduino.h>
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <pthread.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sim_internal.hpp"
+
+struct sim_task {
+    std::string name;
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t notification_value = 0;
+    bool notification_pending = false;
+};
+
+struct sim_queue {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t item_size;
+};
+
+struct sim_semaphore {
+    std::mutex mutex;
+    std::condition_variable changed;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+namespace {
+    thread_local sim_task* current_task = nullptr;
+    thread_local std::string thread_name = "main";
+
+    struct TaskStart {
+        sim_task* task;
+        TaskFunction_t function;
+        void* parameters;
+    };
+}
+
+namespace sim::internal {
+    void set_thread_name(const char* name) {
+        thread_name = name;
+    }
+}
+
+// Tasks
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stack_depth, void* parameters, UBaseType_t priority, TaskHandle_t* created_task) {
+    (void)stack_depth;
+    (void)priority;
+    auto handle = new sim_task();
+    handle->name = name != nullptr ? name : "";
+    if (created_task != nullptr) {
+        *created_task = handle;
+    }
+    std::thread([handle, task, parameters]() {
+        current_task = handle;
+        thread_name = handle->name;
+        task(parameters);
+        // Returning from a task function is an error on FreeRTOS, the thread just ends here
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack_depth, void* parameters, UBaseType_t priority, TaskHandle_t* created_task, BaseType_t core_id) {
+    (void)core_id;
+    return xTaskCreate(task, name, stack_depth, parameters, priority, created_task);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == nullptr || task == current_task) {
+        // The handle is leaked on purpose, other tasks may still hold it
+        pthread_exit(nullptr);
+    }
+    // Threads cannot be killed from outside, no code path of the firmware needs it
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_until(sim::internal::tick_deadline(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+    return static_cast<TickType_t>(sim::now_us() / (1000000 / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCountFromISR() {
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return current_task;
+}
+
+char* pcTaskGetName(TaskHandle_t task) {
+    if (task == nullptr) {
+        return const_cast<char*>(thread_name.c_str());
+    }
+    return const_cast<char*>(task->name.c_str());
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    (void)task;
+    return 0;
+}
+
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t* previous_value) {
+    if (task == nullptr) {
+        return pdFAIL;
+    }
+    BaseType_t ret = pdPASS;
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        if (previous_value != nullptr) {
+            *previous_value = task->notification_value;
+        }
+        switch (action) {
+            case eNoAction:
+                break;
+            case eSetBits:
+                task->notification_value |= value;
+                break;
+            case eIncrement:
+                task->notification_value++;
+                break;
+            case eSetValueWithOverwrite:
+                task->notification_value = value;
+                break;
+            case eSetValueWithoutOverwrite:
+                if (task->notification_pending) {
+                    ret = pdFAIL;
+                } else {
+                    task->notification_value = value;
+                }
+                break;
+        }
+        if (ret == pdPASS) {
+            task->notification_pending = true;
+        }
+    }
+    task->notified.notify_all();
+    return ret;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t bits_to_clear_on_entry, uint32_t bits_to_clear_on_exit, uint32_t* notification_value, TickType_t ticks_to_wait) {
+    auto task = current_task;
+    if (task == nullptr) {
+        return pdFAIL;
+    }
+    auto deadline = sim::internal::tick_deadline(ticks_to_wait);
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (!task->notification_pending) {
+        task->notification_value &= ~bits_to_clear_on_entry;
+    }
+    bool received = task->notified.wait_until(lock, deadline, [task]() { return task->notification_pending; });
+    if (notification_value != nullptr) {
+        *notification_value = task->notification_value;
+    }
+    if (!received) {
+        return pdFALSE;
+    }
+    task->notification_value &= ~bits_to_clear_on_exit;
+    task->notification_pending = false;
+    return pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait) {
+    auto task = current_task;
+    if (task == nullptr) {
+        return 0;
+    }
+    auto deadline = sim::internal::tick_deadline(ticks_to_wait);
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->notified.wait_until(lock, deadline, [task]() { return task->notification_value != 0; });
+    uint32_t value = task->notification_value;
+    if (value != 0) {
+        task->notification_value = clear_count_on_exit ? 0 : value - 1;
+    }
+    task->notification_pending = false;
+    return value;
+}
+
+// Queues
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    auto queue = new sim_queue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+namespace {
+    BaseType_t queue_send(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait, bool front) {
+        auto deadline = sim::internal::tick_deadline(ticks_to_wait);
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        if (!queue->changed.wait_until(lock, deadline, [queue]() { return queue->items.size() < queue->length; })) {
+            return errQUEUE_FULL;
+        }
+        auto bytes = static_cast<const uint8_t*>(item);
+        std::vector<uint8_t> copy(bytes, bytes + queue->item_size);
+        if (front) {
+            queue->items.push_front(std::move(copy));
+        } else {
+            queue->items.push_back(std::move(copy));
+        }
+        lock.unlock();
+        queue->changed.notify_all();
+        return pdPASS;
+    }
+
+    BaseType_t queue_receive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait, bool remove) {
+        auto deadline = sim::internal::tick_deadline(ticks_to_wait);
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        if (!queue->changed.wait_until(lock, deadline, [queue]() { return !queue->items.empty(); })) {
+            return errQUEUE_EMPTY;
+        }
+        memcpy(buffer, queue->items.front().data(), queue->item_size);
+        if (remove) {
+            queue->items.pop_front();
+            lock.unlock();
+            queue->changed.notify_all();
+        }
+        return pdPASS;
+    }
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait) {
+    return queue_send(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait) {
+    return queue_send(queue, item, ticks_to_wait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->items.clear();
+        auto bytes = static_cast<const uint8_t*>(item);
+        queue->items.emplace_back(bytes, bytes + queue->item_size);
+    }
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait) {
+    return queue_receive(queue, buffer, ticks_to_wait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait) {
+    return queue_receive(queue, buffer, ticks_to_wait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->items.clear();
+    }
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return static_cast<UBaseType_t>(queue->items.size());
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return static_cast<UBaseType_t>(queue->length - queue->items.size());
+}
+
+// Semaphores
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count) {
+    auto semaphore = new sim_semaphore();
+    semaphore->count = initial_count;
+    semaphore->max_count = max_count;
+    return semaphore;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait) {
+    auto deadline = sim::internal::tick_deadline(ticks_to_wait);
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!semaphore->changed.wait_until(lock, deadline, [semaphore]() { return semaphore->count > 0; })) {
+        return pdFALSE;
+    }
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->count >= semaphore->max_count) {
+            return pdFALSE;
+        }
+        semaphore->count++;
+    }
+    semaphore->changed.notify_one();
+    return pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore) {
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    return semaphore->count;
+}
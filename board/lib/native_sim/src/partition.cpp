@@ -0,0 +1,112 @@
+#include <esp_partition.h>
+#include <sim.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Partition {
+        esp_partition_t info;
+        std::vector<uint8_t> content;
+        std::string path;
+    };
+
+    // Added by the runner before the firmware starts, then only the content changes
+    std::map<std::string, Partition> partitions;
+    std::mutex content_mutex;
+
+    bool in_bounds(const esp_partition_t* partition, size_t offset, size_t size) {
+        return offset <= partition->size && size <= partition->size - offset;
+    }
+
+    // Keeps the file in sync, so what the firmware logged can be inspected and survives a restart of the simulation
+    void write_through(const Partition& partition, size_t offset, size_t size) {
+        std::fstream file(partition.path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file) {
+            fprintf(stderr, "[sim] cannot write partition %s back to %s\n", partition.info.label, partition.path.c_str());
+            return;
+        }
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(partition.content.data() + offset), static_cast<std::streamsize>(size));
+    }
+}
+
+namespace sim {
+    bool set_partition_file(const char* label, const char* path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file || strlen(label) >= sizeof(esp_partition_t::label)) {
+            return false;
+        }
+        Partition partition = {};
+        partition.content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        partition.info.type = ESP_PARTITION_TYPE_DATA;
+        partition.info.subtype = ESP_PARTITION_SUBTYPE_ANY;
+        partition.info.size = static_cast<uint32_t>(partition.content.size());
+        strcpy(partition.info.label, label);
+        partition.path = path;
+        partitions[label] = std::move(partition);
+        return true;
+    }
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    (void)subtype; // Files carry no subtype, the label is enough to tell them apart
+    if (type != ESP_PARTITION_TYPE_DATA && type != ESP_PARTITION_TYPE_ANY) {
+        return nullptr;
+    }
+    if (label == nullptr) {
+        return partitions.empty() ? nullptr : &partitions.begin()->second.info;
+    }
+    auto it = partitions.find(label);
+    return it == partitions.end() ? nullptr : &it->second.info;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    if (partition == nullptr || dst == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!in_bounds(partition, src_offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    std::lock_guard<std::mutex> lock(content_mutex);
+    const auto& content = partitions.at(partition->label).content;
+    memcpy(dst, content.data() + src_offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size) {
+    if (partition == nullptr || src == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!in_bounds(partition, dst_offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    std::lock_guard<std::mutex> lock(content_mutex);
+    Partition& target = partitions.at(partition->label);
+    const uint8_t* bytes = static_cast<const uint8_t*>(src);
+    for (size_t i = 0; i < size; ++i) {
+        target.content[dst_offset + i] &= bytes[i]; // Programming cannot set bits back to 1
+    }
+    write_through(target, dst_offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    if (partition == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset % SPI_FLASH_SEC_SIZE != 0 || size % SPI_FLASH_SEC_SIZE != 0 || !in_bounds(partition, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    std::lock_guard<std::mutex> lock(content_mutex);
+    Partition& target = partitions.at(partition->label);
+    memset(target.content.data() + offset, 0xFF, size);
+    write_through(target, offset, size);
+    return ESP_OK;
+}
@@ -0,0 +1,484 @@
+#include <Arduino.h>
+#include <DallasTemperature.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <nvs_flash.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "sim_internal.hpp"
+
+namespace {
+    // WiFi
+
+    constexpr uint64_t wifi_connect_time_us = 1500000;
+    std::mutex wifi_mutex;
+    bool wifi_available = false;
+    wifi_mode_t wifi_mode = WIFI_MODE_NULL;
+    String wifi_ssid;
+    bool wifi_connecting = false;
+    uint64_t wifi_connected_at_us = 0;
+    uint64_t radio_on_since_us = 0; // When the mode last left WIFI_MODE_NULL
+    uint64_t radio_on_total_us = 0; // Time spent with the radio on before that
+
+    // Call with wifi_mutex held
+    void set_wifi_mode(wifi_mode_t mode) {
+        if (wifi_mode == WIFI_MODE_NULL && mode != WIFI_MODE_NULL) {
+            radio_on_since_us = sim::now_us();
+        } else if (wifi_mode != WIFI_MODE_NULL && mode == WIFI_MODE_NULL) {
+            radio_on_total_us += sim::now_us() - radio_on_since_us;
+        }
+        wifi_mode = mode;
+    }
+
+    // HTTP
+
+    std::mutex http_mutex;
+    sim::http_handler_t http_handler = nullptr;
+    uint32_t http_connections = 0;
+    uint64_t http_bytes = 0;
+
+    // NVS, one map per namespace
+
+    std::mutex nvs_mutex;
+    std::map<std::string, std::map<std::string, std::vector<uint8_t>>> nvs;
+
+    // DS18B20
+
+    constexpr uint8_t max_sensors = 8;
+    std::mutex sensor_mutex;
+    float external_temperatures[max_sensors] = {21.5f, 21.5f, 21.5f, 21.5f, 21.5f, 21.5f, 21.5f, 21.5f};
+    uint8_t sensor_count = 1;
+}
+
+namespace sim {
+    void set_wifi_available(bool available) {
+        std::lock_guard<std::mutex> lock(wifi_mutex);
+        wifi_available = available;
+    }
+
+    uint64_t wifi_radio_on_us() {
+        std::lock_guard<std::mutex> lock(wifi_mutex);
+        return radio_on_total_us + (wifi_mode != WIFI_MODE_NULL ? sim::now_us() - radio_on_since_us : 0);
+    }
+
+    void set_http_handler(http_handler_t handler) {
+        std::lock_guard<std::mutex> lock(http_mutex);
+        http_handler = handler;
+    }
+
+    void set_external_temperature(float celsius, uint8_t sensor) {
+        std::lock_guard<std::mutex> lock(sensor_mutex);
+        if (sensor < max_sensors) {
+            external_temperatures[sensor] = celsius;
+        }
+    }
+
+    void set_external_sensor_count(uint8_t count) {
+        std::lock_guard<std::mutex> lock(sensor_mutex);
+        sensor_count = count < max_sensors ? count : max_sensors;
+    }
+}
+
+// WiFi
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+    (void)passphrase;
+    std::lock_guard<std::mutex> lock(wifi_mutex);
+    if (wifi_mode == WIFI_MODE_NULL) {
+        set_wifi_mode(WIFI_MODE_STA);
+    }
+    wifi_ssid = ssid != nullptr ? ssid : "";
+    wifi_connecting = true;
+    wifi_connected_at_us = sim::now_us() + wifi_connect_time_us;
+    return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifi_off, bool erase_ap) {
+    std::lock_guard<std::mutex> lock(wifi_mutex);
+    wifi_connecting = false;
+    if (wifi_off) {
+        set_wifi_mode(WIFI_MODE_NULL);
+    }
+    if (erase_ap) {
+        wifi_ssid = "";
+    }
+    return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    std::lock_guard<std::mutex> lock(wifi_mutex);
+    set_wifi_mode(mode);
+    if (mode == WIFI_MODE_NULL) {
+        wifi_connecting = false;
+    }
+    return true;
+}
+
+wifi_mode_t WiFiClass::getMode() {
+    std::lock_guard<std::mutex> lock(wifi_mutex);
+    return wifi_mode;
+}
+
+wl_status_t WiFiClass::status() {
+    bool just_connected = false;
+    wl_status_t ret;
+    {
+        std::lock_guard<std::mutex> lock(wifi_mutex);
+        if (wifi_mode == WIFI_MODE_NULL) {
+            return WL_NO_SHIELD;
+        }
+        if (!wifi_connecting) {
+            return WL_DISCONNECTED;
+        }
+        if (!wifi_available) {
+            return sim::now_us() >= wifi_connected_at_us ? WL_NO_SSID_AVAIL : WL_DISCONNECTED;
+        }
+        if (sim::now_us() < wifi_connected_at_us) {
+            return WL_DISCONNECTED;
+        }
+        just_connected = wifi_connected_at_us != 0;
+        wifi_connected_at_us = 0;
+        ret = WL_CONNECTED;
+    }
+    if (just_connected) {
+        sim::internal::on_network_up();
+    }
+    return ret;
+}
+
+int8_t WiFiClass::RSSI() {
+    return isConnected() ? -58 : 0;
+}
+
+String WiFiClass::SSID() {
+    std::lock_guard<std::mutex> lock(wifi_mutex);
+    return wifi_ssid;
+}
+
+// HTTPClient
+
+bool HTTPClient::begin(WiFiClient& client, const String& url) {
+    // The connection is gone if the client was stopped since the last request
+    if (kept_alive && (this->client != &client || client.stops != client_stops)) {
+        kept_alive = false;
+    }
+    this->client = &client;
+    client_stops = client.stops;
+    return begin(url);
+}
+
+bool HTTPClient::begin(const String& url) {
+    // A kept-alive connection is only reused for the same host
+    auto host_of = [](const String& u) {
+        int start = u.indexOf("://");
+        start = start < 0 ? 0 : start + 3;
+        int end = u.indexOf('/', start);
+        return u.substring(start, end < 0 ? u.length() : end);
+    };
+    if (kept_alive && host_of(this->url) != host_of(url)) {
+        kept_alive = false;
+    }
+    this->url = url;
+    body = "";
+    stream.reset(nullptr);
+    return true;
+}
+
+void HTTPClient::end() {
+    stream.reset(nullptr);
+    if (!reuse || http10) {
+        kept_alive = false;
+    }
+}
+
+int HTTPClient::GET() {
+    if (!WiFi.isConnected()) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    sim::http_handler_t handler;
+    {
+        std::lock_guard<std::mutex> lock(http_mutex);
+        handler = http_handler;
+        if (handler != nullptr && !kept_alive) {
+            http_connections++;
+        }
+    }
+    if (handler == nullptr) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    int code = handler(url.c_str(), body);
+    {
+        std::lock_guard<std::mutex> lock(http_mutex);
+        http_bytes += url.length() + body.length();
+    }
+    if (code <= 0) {
+        body = "";
+        kept_alive = false;
+        return code;
+    }
+    kept_alive = reuse && !http10;
+    stream.reset(&body);
+    return code;
+}
+
+String HTTPClient::errorToString(int error) {
+    switch (error) {
+        case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+        case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+        case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+        case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+        case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+        case HTTPC_ERROR_NO_STREAM: return "no stream";
+        case HTTPC_ERROR_NO_HTTP_SERVER: return "no HTTP server";
+        case HTTPC_ERROR_TOO_LESS_RAM: return "too less ram";
+        case HTTPC_ERROR_ENCODING: return "Transfer-Encoding not supported";
+        case HTTPC_ERROR_STREAM_WRITE: return "Stream write error";
+        case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+        default: return String();
+    }
+}
+
+uint32_t HTTPClient::connections_opened() {
+    std::lock_guard<std::mutex> lock(http_mutex);
+    return http_connections;
+}
+
+uint64_t HTTPClient::bytes_transferred() {
+    std::lock_guard<std::mutex> lock(http_mutex);
+    return http_bytes;
+}
+
+// NVS and Preferences
+
+esp_err_t nvs_flash_init() {
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase() {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs.clear();
+    return ESP_OK;
+}
+
+bool Preferences::begin(const char* name, bool read_only, const char* partition_label) {
+    (void)partition_label;
+    if (started || name == nullptr || strlen(name) > 15) {
+        return false;
+    }
+    name_space = name;
+    this->read_only = read_only;
+    started = true;
+    return true;
+}
+
+void Preferences::end() {
+    started = false;
+}
+
+bool Preferences::clear() {
+    if (!started || read_only) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs[name_space.c_str()].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!started || read_only || key == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    return nvs[name_space.c_str()].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!started || key == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    auto& entries = nvs[name_space.c_str()];
+    return entries.find(key) != entries.end();
+}
+
+bool Preferences::put(const char* key, const void* value, size_t length) {
+    if (!started || read_only || key == nullptr || strlen(key) > 15) {
+        return false;
+    }
+    auto bytes = static_cast<const uint8_t*>(value);
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs[name_space.c_str()][key] = std::vector<uint8_t>(bytes, bytes + length);
+    return true;
+}
+
+bool Preferences::get(const char* key, void* buffer, size_t length) {
+    if (!started || key == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    auto& entries = nvs[name_space.c_str()];
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.size() != length) {
+        return false;
+    }
+    memcpy(buffer, it->second.data(), length);
+    return true;
+}
+
+size_t Preferences::putBool(const char* key, bool value) { uint8_t v = value; return put(key, &v, sizeof(v)) ? sizeof(v) : 0; }
+size_t Preferences::putUChar(const char* key, uint8_t value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putUShort(const char* key, uint16_t value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putInt(const char* key, int32_t value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putUInt(const char* key, uint32_t value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putULong64(const char* key, uint64_t value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putFloat(const char* key, float value) { return put(key, &value, sizeof(value)) ? sizeof(value) : 0; }
+size_t Preferences::putString(const char* key, const char* value) { return put(key, value, strlen(value) + 1) ? strlen(value) : 0; }
+size_t Preferences::putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) { return put(key, value, length) ? length : 0; }
+
+bool Preferences::getBool(const char* key, bool default_value) { uint8_t v; return get(key, &v, sizeof(v)) ? v != 0 : default_value; }
+uint8_t Preferences::getUChar(const char* key, uint8_t default_value) { uint8_t v; return get(key, &v, sizeof(v)) ? v : default_value; }
+uint16_t Preferences::getUShort(const char* key, uint16_t default_value) { uint16_t v; return get(key, &v, sizeof(v)) ? v : default_value; }
+int32_t Preferences::getInt(const char* key, int32_t default_value) { int32_t v; return get(key, &v, sizeof(v)) ? v : default_value; }
+uint32_t Preferences::getUInt(const char* key, uint32_t default_value) { uint32_t v; return get(key, &v, sizeof(v)) ? v : default_value; }
+uint64_t Preferences::getULong64(const char* key, uint64_t default_value) { uint64_t v; return get(key, &v, sizeof(v)) ? v : default_value; }
+float Preferences::getFloat(const char* key, float default_value) { float v; return get(key, &v, sizeof(v)) ? v : default_value; }
+
+String Preferences::getString(const char* key, const String& default_value) {
+    size_t length = getBytesLength(key);
+    if (length == 0) {
+        return default_value;
+    }
+    std::vector<char> buffer(length);
+    getBytes(key, buffer.data(), length);
+    buffer.back() = '\0';
+    return String(buffer.data());
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!started || key == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    auto& entries = nvs[name_space.c_str()];
+    auto it = entries.find(key);
+    return it == entries.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t max_length) {
+    if (!started || key == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    auto& entries = nvs[name_space.c_str()];
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.size() > max_length) {
+        return 0;
+    }
+    memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+// DallasTemperature, sim::set_external_sensor_count() sensors are present on TMP_PIN, the 6th ROM byte is their index
+
+void DallasTemperature::begin() {}
+
+uint8_t DallasTemperature::getDeviceCount() {
+    std::lock_guard<std::mutex> lock(sensor_mutex);
+    return sensor_count;
+}
+
+bool DallasTemperature::getAddress(DeviceAddress address, uint8_t index) {
+    if (index >= getDeviceCount()) {
+        return false;
+    }
+    const uint8_t rom[8] = {0x28, 0x53, 0x49, 0x4D, bus->get_pin(), index, 0x00, 0x5A};
+    memcpy(address, rom, sizeof(rom));
+    return true;
+}
+
+bool DallasTemperature::isConnected(const DeviceAddress address) {
+    return address[0] == 0x28 && address[5] < getDeviceCount();
+}
+
+void DallasTemperature::setResolution(uint8_t resolution) {
+    this->resolution = resolution < 9 ? 9 : (resolution > 12 ? 12 : resolution);
+}
+
+bool DallasTemperature::setResolution(const DeviceAddress address, uint8_t resolution, bool skip_global_calculation) {
+    (void)address;
+    (void)skip_global_calculation;
+    setResolution(resolution);
+    return true;
+}
+
+uint8_t DallasTemperature::getResolution() {
+    return resolution;
+}
+
+uint8_t DallasTemperature::getResolution(const DeviceAddress address) {
+    (void)address;
+    return resolution;
+}
+
+uint16_t DallasTemperature::millisToWaitForConversion(uint8_t resolution) {
+    switch (resolution) {
+        case 9: return 94;
+        case 10: return 188;
+        case 11: return 375;
+        default: return 750;
+    }
+}
+
+void DallasTemperature::requestTemperatures() {
+    // Every request restarts the conversion like on the real bus
+    has_result = has_result || (conversion_end_us != 0 && sim::now_us() >= conversion_end_us);
+    conversion_end_us = sim::now_us() + millisToWaitForConversion(resolution) * 1000ULL;
+    converted = false;
+    if (wait_for_conversion) {
+        sim::internal::sleep_us(millisToWaitForConversion(resolution) * 1000ULL);
+    }
+}
+
+bool DallasTemperature::requestTemperaturesByAddress(const DeviceAddress address) {
+    (void)address;
+    requestTemperatures();
+    return true;
+}
+
+bool DallasTemperature::isConversionComplete() {
+    if (sim::now_us() >= conversion_end_us) {
+        converted = true;
+    }
+    return converted;
+}
+
+float DallasTemperature::getTempC(const DeviceAddress address) {
+    if (!isConnected(address)) {
+        return DEVICE_DISCONNECTED_C;
+    }
+    bool converting = conversion_end_us == 0 || sim::now_us() < conversion_end_us;
+    if (!has_result && converting) {
+        return 85.0f; // Power-on value of the scratchpad, the first conversion didn't end yet
+    }
+    // Reading during a later conversion returns the previous result, here the current temperature
+    std::lock_guard<std::mutex> lock(sensor_mutex);
+    // Quantize to the configured resolution, 12 bits = 1/16 degree
+    float step = 0.5f / (1 << (resolution - 9));
+    return static_cast<int>(external_temperatures[address[5]] / step) * step;
+}
+
+float DallasTemperature::getTempCByIndex(uint8_t index) {
+    DeviceAddress address;
+    if (!getAddress(address, index)) {
+        return DEVICE_DISCONNECTED_C;
+    }
+    return getTempC(address);
+}
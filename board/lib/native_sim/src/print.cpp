@@ -0,0 +1,259 @@
+#include <Arduino.h>
+
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+
+namespace {
+    std::string to_base(unsigned long long value, unsigned char base) {
+        if (base < 2 || base > 36) {
+            base = 10;
+        }
+        char digits[65];
+        size_t i = sizeof(digits);
+        do {
+            auto digit = static_cast<char>(value % base);
+            digits[--i] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+            value /= base;
+        } while (value != 0);
+        return std::string(digits + i, sizeof(digits) - i);
+    }
+
+    std::string signed_to_base(long long value, unsigned char base) {
+        if (value < 0 && base == 10) {
+            return "-" + to_base(0ULL - static_cast<unsigned long long>(value), base);
+        }
+        return to_base(static_cast<unsigned long long>(value), base);
+    }
+
+    std::string fixed(double value, unsigned char decimal_places) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimal_places, value);
+        return buffer;
+    }
+}
+
+// String
+
+String::String(int value, unsigned char base) : data(signed_to_base(value, base)) {}
+String::String(unsigned int value, unsigned char base) : data(to_base(value, base)) {}
+String::String(long value, unsigned char base) : data(signed_to_base(value, base)) {}
+String::String(unsigned long value, unsigned char base) : data(to_base(value, base)) {}
+String::String(long long value, unsigned char base) : data(signed_to_base(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : data(to_base(value, base)) {}
+String::String(float value, unsigned char decimal_places) : data(fixed(value, decimal_places)) {}
+String::String(double value, unsigned char decimal_places) : data(fixed(value, decimal_places)) {}
+
+int String::indexOf(char c, unsigned int from) const {
+    auto pos = data.find(c, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const String& str, unsigned int from) const {
+    auto pos = data.find(str.data, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        std::swap(from, to);
+    }
+    if (from >= data.size()) {
+        return String();
+    }
+    return String(data.substr(from, std::min<size_t>(to, data.size()) - from));
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.data.empty()) {
+        return;
+    }
+    size_t pos = 0;
+    while ((pos = data.find(find.data, pos)) != std::string::npos) {
+        data.replace(pos, find.data.size(), replacement.data);
+        pos += replacement.data.size();
+    }
+}
+
+void String::replace(char find, char replacement) {
+    for (auto& c : data) {
+        if (c == find) {
+            c = replacement;
+        }
+    }
+}
+
+void String::trim() {
+    size_t begin = 0;
+    while (begin < data.size() && isspace(static_cast<unsigned char>(data[begin]))) {
+        ++begin;
+    }
+    size_t end = data.size();
+    while (end > begin && isspace(static_cast<unsigned char>(data[end - 1]))) {
+        --end;
+    }
+    data = data.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+    for (auto& c : data) {
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+}
+
+void String::toUpperCase() {
+    for (auto& c : data) {
+        c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+}
+
+// Print
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++)) {
+            n++;
+        } else {
+            break;
+        }
+    }
+    return n;
+}
+
+size_t Print::write(const char* str) {
+    if (str == nullptr) {
+        return 0;
+    }
+    return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char stack_buffer[64];
+    va_list args;
+    va_start(args, fmt);
+    va_list copy;
+    va_copy(copy, args);
+    int length = vsnprintf(stack_buffer, sizeof(stack_buffer), fmt, copy);
+    va_end(copy);
+    if (length < 0) {
+        va_end(args);
+        return 0;
+    }
+    if (static_cast<size_t>(length) < sizeof(stack_buffer)) {
+        va_end(args);
+        return write(reinterpret_cast<const uint8_t*>(stack_buffer), length);
+    }
+    std::string heap_buffer(length + 1, '\0');
+    vsnprintf(&heap_buffer[0], heap_buffer.size(), fmt, args);
+    va_end(args);
+    return write(reinterpret_cast<const uint8_t*>(heap_buffer.data()), length);
+}
+
+size_t Print::print(const char* str) {
+    return write(str);
+}
+
+size_t Print::print(const String& str) {
+    return write(str.c_str(), str.length());
+}
+
+size_t Print::print(char c) {
+    return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(unsigned char value, int base) {
+    return print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(int value, int base) {
+    return print(static_cast<long>(value), base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+    return print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(long value, int base) {
+    return print(static_cast<long long>(value), base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return print(static_cast<unsigned long long>(value), base);
+}
+
+size_t Print::print(long long value, int base) {
+    if (base == 0) {
+        return write(static_cast<uint8_t>(value));
+    }
+    if (value < 0 && base == 10) {
+        return print_number(0ULL - static_cast<unsigned long long>(value), base, true);
+    }
+    return print_number(static_cast<unsigned long long>(value), base, false);
+}
+
+size_t Print::print(unsigned long long value, int base) {
+    if (base == 0) {
+        return write(static_cast<uint8_t>(value));
+    }
+    return print_number(value, base, false);
+}
+
+size_t Print::print(double value, int digits) {
+    if (std::isnan(value)) return print("nan");
+    if (std::isinf(value)) return print("inf");
+    if (value > 4294967040.0 || value < -4294967040.0) return print("ovf");
+    return print(fixed(value, static_cast<unsigned char>(digits)).c_str());
+}
+
+size_t Print::println() {
+    return write("\r\n");
+}
+
+size_t Print::print_number(unsigned long long value, int base, bool negative) {
+    auto digits = to_base(value, static_cast<unsigned char>(base));
+    if (base != 10) {
+        for (auto& c : digits) {
+            c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+        }
+    }
+    size_t n = negative ? print('-') : 0;
+    return n + write(digits.c_str());
+}
+
+// Stream
+
+int Stream::timed_read() {
+    auto start = millis();
+    do {
+        int c = read();
+        if (c >= 0) {
+            return c;
+        }
+        delay(1);
+    } while (millis() - start < timeout);
+    return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timed_read();
+        if (c < 0) {
+            break;
+        }
+        *buffer++ = static_cast<char>(c);
+        count++;
+    }
+    return count;
+}
+
+String Stream::readString() {
+    String ret;
+    int c = timed_read();
+    while (c >= 0) {
+        ret += static_cast<char>(c);
+        c = timed_read();
+    }
+    return ret;
+}
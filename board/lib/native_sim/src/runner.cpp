@@ -0,0 +1,276 @@
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+#include "constants.hpp"
+#include "sim_internal.hpp"
+
+// Entry point of the native build: runs setup() and loop() in the "loopTask" task like the arduino-esp32 core does,
+// while the main thread replays a script of button presses and other stimuli on the simulated clock.
+//
+// Usage: program [--speed N] [--duration MS] [--script FILE] [--frames DIR] [--wifi] [--rtc now|EPOCH] [--battery VOLTS]
+//                [--partition LABEL=FILE]... [--serial-pty]
+//
+// Script lines are "<ms> <action> [argument]" with ms counted from the start of the simulation:
+//   <ms> press|release|tap A|B|UP|DOWN|LEFT|RIGHT
+//   <ms> wifi on|off
+//   <ms> temperature CELSIUS
+//   <ms> snapshot FILE.pbm
+//   <ms> quit
+//
+// Left out of the unit tests under test/, which bring their own main() and call sim::start_firmware() if they need
+// the whole firmware.
+#ifndef PIO_UNIT_TESTING
+
+namespace framebuffer {
+    void sync(); // From core/framebuffer.hpp, which is not on the include path of this library
+}
+
+namespace {
+    enum class Action {
+        PRESS,
+        RELEASE,
+        WIFI,
+        TEMPERATURE,
+        SNAPSHOT,
+        QUIT,
+    };
+
+    struct Step {
+        uint64_t at_us;
+        Action action;
+        uint8_t pin;
+        float value;
+        std::string argument;
+    };
+
+    constexpr uint64_t tap_duration_us = 80000;
+
+    std::string frames_dir;
+    uint64_t last_frame_revision = UINT64_MAX;
+    uint32_t frames_written = 0;
+    uint64_t loop_iterations = 0;
+
+    int button_pin(const std::string& name) {
+        if (name == "A") return A_PIN;
+        if (name == "B") return B_PIN;
+        if (name == "UP") return UP_PIN;
+        if (name == "DOWN") return DOWN_PIN;
+        if (name == "LEFT") return LEFT_PIN;
+        if (name == "RIGHT") return RIGHT_PIN;
+        return -1;
+    }
+
+    bool parse_script(const char* path, std::vector<Step>& steps) {
+        std::ifstream file(path);
+        if (!file) {
+            fprintf(stderr, "[sim] cannot open script %s\n", path);
+            return false;
+        }
+        std::string line;
+        size_t line_number = 0;
+        while (std::getline(file, line)) {
+            ++line_number;
+            auto comment = line.find('#');
+            if (comment != std::string::npos) {
+                line.erase(comment);
+            }
+            std::istringstream in(line);
+            double ms;
+            std::string action, argument;
+            if (!(in >> ms)) {
+                continue; // Empty line
+            }
+            in >> action >> argument;
+            Step step = {static_cast<uint64_t>(ms * 1000), Action::QUIT, 0, 0, argument};
+            if (action == "press" || action == "release" || action == "tap") {
+                int pin = button_pin(argument);
+                if (pin < 0) {
+                    fprintf(stderr, "[sim] %s:%zu: unknown button '%s'\n", path, line_number, argument.c_str());
+                    return false;
+                }
+                step.pin = static_cast<uint8_t>(pin);
+                step.action = action == "release" ? Action::RELEASE : Action::PRESS;
+                steps.push_back(step);
+                if (action == "tap") {
+                    step.at_us += tap_duration_us;
+                    step.action = Action::RELEASE;
+                    steps.push_back(step);
+                }
+            } else if (action == "wifi") {
+                step.action = Action::WIFI;
+                step.value = argument == "on" ? 1 : 0;
+                steps.push_back(step);
+            } else if (action == "temperature") {
+                step.action = Action::TEMPERATURE;
+                step.value = strtof(argument.c_str(), nullptr);
+                steps.push_back(step);
+            } else if (action == "snapshot") {
+                step.action = Action::SNAPSHOT;
+                steps.push_back(step);
+            } else if (action == "quit") {
+                step.action = Action::QUIT;
+                steps.push_back(step);
+            } else {
+                fprintf(stderr, "[sim] %s:%zu: unknown action '%s'\n", path, line_number, action.c_str());
+                return false;
+            }
+        }
+        std::stable_sort(steps.begin(), steps.end(), [](const Step& a, const Step& b) { return a.at_us < b.at_us; });
+        return true;
+    }
+
+    [[noreturn]] void quit() {
+        Serial.flush();
+        fprintf(stderr, "[sim] stopped at %.3f s: %llu loop iterations, %u frames written, %llu bytes on the I2C bus\n",
+            sim::now_us() / 1e6, static_cast<unsigned long long>(loop_iterations), frames_written,
+            static_cast<unsigned long long>(sim::i2c_bytes_written()));
+        double hours = sim::now_us() / 3.6e9;
+        fprintf(stderr, "[sim] WiFi radio on for %.3f s, %.0f ms per simulated hour\n", sim::wifi_radio_on_us() / 1e6,
+            hours > 0 ? sim::wifi_radio_on_us() / 1e3 / hours : 0.0);
+        std::_Exit(0);
+    }
+
+    // Dumps the panel after every loop() iteration that changed it
+    void after_loop() {
+        ++loop_iterations;
+        if (frames_dir.empty()) {
+            return;
+        }
+        framebuffer::sync(); // The display task sends the frames, wait for the last one to reach the panel
+        auto revision = sim::panel_revision();
+        if (revision == last_frame_revision) {
+            return;
+        }
+        last_frame_revision = revision;
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05u_%08llu.pbm", frames_dir.c_str(), frames_written,
+            static_cast<unsigned long long>(sim::now_us() / 1000));
+        if (sim::write_pbm(path)) {
+            ++frames_written;
+        }
+    }
+
+    void usage(const char* program) {
+        fprintf(stderr,
+            "usage: %s [--speed N] [--duration MS] [--script FILE] [--frames DIR] [--wifi] [--rtc now|EPOCH] [--battery VOLTS]\n"
+            "          [--partition LABEL=FILE]... [--serial-pty]\n",
+            program);
+    }
+}
+
+int main(int argc, char** argv) {
+    double speed = 1.0;
+    uint64_t duration_us = 0;
+    float battery_voltage = 3.9f;
+    std::vector<Step> steps;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--speed" && has_value) {
+            speed = strtod(argv[++i], nullptr);
+        } else if (arg == "--duration" && has_value) {
+            duration_us = strtoull(argv[++i], nullptr, 10) * 1000;
+        } else if (arg == "--script" && has_value) {
+            if (!parse_script(argv[++i], steps)) {
+                return 1;
+            }
+        } else if (arg == "--frames" && has_value) {
+            frames_dir = argv[++i];
+            if (mkdir(frames_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+                fprintf(stderr, "[sim] cannot create %s: %s\n", frames_dir.c_str(), strerror(errno));
+                return 1;
+            }
+        } else if (arg == "--wifi") {
+            sim::set_wifi_available(true);
+        } else if (arg == "--rtc" && has_value) {
+            std::string value = argv[++i];
+            if (value == "now") {
+                auto wall = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+                sim::set_rtc_us(wall);
+            } else {
+                sim::set_rtc_us(strtoll(value.c_str(), nullptr, 10) * 1000000LL);
+            }
+        } else if (arg == "--battery" && has_value) {
+            battery_voltage = strtof(argv[++i], nullptr);
+        } else if (arg == "--partition" && has_value) {
+            std::string value = argv[++i];
+            auto equals = value.find('=');
+            if (equals == std::string::npos || !sim::set_partition_file(value.substr(0, equals).c_str(), value.c_str() + equals + 1)) {
+                fprintf(stderr, "[sim] cannot load partition %s\n", value.c_str());
+                return 1;
+            }
+        } else if (arg == "--serial-pty") {
+            const char* path = sim::open_serial_pty();
+            if (path == nullptr) {
+                fprintf(stderr, "[sim] cannot open a pseudo terminal: %s\n", strerror(errno));
+                return 1;
+            }
+            fprintf(stderr, "[sim] Serial is on %s\n", path);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (speed <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Buttons are active low with pull-ups, the battery sits behind the R1/R2 divider
+    for (auto pin : {A_PIN, B_PIN, UP_PIN, DOWN_PIN, LEFT_PIN, RIGHT_PIN}) {
+        sim::set_pin_level(pin, HIGH);
+    }
+    float divided = battery_voltage * BATTERY_R2 / (BATTERY_R1 + BATTERY_R2);
+    sim::set_analog_value(BAT_PIN, static_cast<uint16_t>(std::min(1.0f, divided / ANALOG_REF_VOLTAGE) * MAX_ANALOG_READ));
+
+    sim::internal::set_thread_name("sim");
+    sim::set_speed(speed);
+    sim::start_firmware(after_loop);
+
+    if (duration_us != 0) {
+        steps.push_back({duration_us, Action::QUIT, 0, 0, ""});
+        std::stable_sort(steps.begin(), steps.end(), [](const Step& a, const Step& b) { return a.at_us < b.at_us; });
+    }
+    for (const auto& step : steps) {
+        sim::sleep_until_us(step.at_us);
+        switch (step.action) {
+            case Action::PRESS:
+                sim::set_pin_level(step.pin, LOW);
+                break;
+            case Action::RELEASE:
+                sim::set_pin_level(step.pin, HIGH);
+                break;
+            case Action::WIFI:
+                sim::set_wifi_available(step.value != 0);
+                break;
+            case Action::TEMPERATURE:
+                sim::set_external_temperature(step.value);
+                break;
+            case Action::SNAPSHOT:
+                if (!sim::write_pbm(step.argument.c_str())) {
+                    fprintf(stderr, "[sim] cannot write %s\n", step.argument.c_str());
+                }
+                break;
+            case Action::QUIT:
+                quit();
+        }
+    }
+    // No end in sight, run until interrupted or until the firmware enters deep-sleep
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::hours(1));
+    }
+}
+
+#endif
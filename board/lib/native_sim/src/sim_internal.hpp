@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Helpers shared by the simulation sources, not part of the firmware facing API
+namespace sim::internal {
+    using host_clock = std::chrono::steady_clock;
+
+    // Held while an interrupt handler runs and between noInterrupts() and interrupts()
+    std::recursive_mutex& interrupt_lock();
+
+    // Host time point at which the simulated clock reaches sim_deadline_us
+    host_clock::time_point host_deadline(uint64_t sim_deadline_us);
+
+    // Host time point at which a FreeRTOS wait of the given ticks ends, time_point::max() for portMAX_DELAY
+    host_clock::time_point tick_deadline(uint32_t ticks);
+
+    // Blocks the calling thread for the given amount of simulated time
+    void sleep_us(uint64_t sim_us);
+
+    // Name shown by pcTaskGetName() for threads that are not FreeRTOS tasks
+    void set_thread_name(const char* name);
+
+    // Accounts a finished I2C transmission of the given bytes and blocks for its duration on the bus
+    void i2c_transfer(uint8_t address, const uint8_t* data, size_t length, uint32_t clock);
+
+    // SNTP sync, called when the simulated WiFi link comes up
+    void on_network_up();
+}
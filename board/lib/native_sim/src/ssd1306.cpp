@@ -0,0 +1,229 @@
+#include <Adafruit_SSD1306.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin, uint32_t clk_during, uint32_t clk_after)
+    : Adafruit_GFX(w, h), wire(twi != nullptr ? twi : &Wire), wireClk(clk_during), restoreClk(clk_after) {
+    (void)rst_pin;
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+    free(buffer);
+}
+
+void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
+    wire->beginTransmission(i2caddr);
+    wire->write(static_cast<uint8_t>(0x00)); // Co = 0, D/C = 0
+    wire->write(c);
+    wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_commandList(const uint8_t* c, uint8_t n) {
+    wire->beginTransmission(i2caddr);
+    wire->write(static_cast<uint8_t>(0x00));
+    uint16_t bytes_out = 1;
+    while (n--) {
+        if (bytes_out >= WIRE_MAX) {
+            wire->endTransmission();
+            wire->beginTransmission(i2caddr);
+            wire->write(static_cast<uint8_t>(0x00));
+            bytes_out = 1;
+        }
+        wire->write(*c++);
+        bytes_out++;
+    }
+    wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
+    wire->setClock(wireClk);
+    ssd1306_command1(c);
+    wire->setClock(restoreClk);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset, bool periph_begin) {
+    (void)reset;
+    if (buffer == nullptr) {
+        buffer = static_cast<uint8_t*>(malloc(WIDTH * ((HEIGHT + 7) / 8)));
+        if (buffer == nullptr) {
+            return false;
+        }
+    }
+    // The Adafruit splash screen is not drawn, the firmware replaces it before the first display() anyway
+    clearDisplay();
+    vccstate = vcs;
+    i2caddr = addr != 0 ? addr : ((HEIGHT == 32) ? 0x3C : 0x3D);
+    if (periph_begin) {
+        wire->begin();
+    }
+
+    wire->setClock(wireClk);
+    static const uint8_t init1[] = {SSD1306_DISPLAYOFF, SSD1306_SETDISPLAYCLOCKDIV, 0x80, SSD1306_SETMULTIPLEX};
+    ssd1306_commandList(init1, sizeof(init1));
+    ssd1306_command1(HEIGHT - 1);
+
+    static const uint8_t init2[] = {SSD1306_SETDISPLAYOFFSET, 0x0, SSD1306_SETSTARTLINE | 0x0, SSD1306_CHARGEPUMP};
+    ssd1306_commandList(init2, sizeof(init2));
+    ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x10 : 0x14);
+
+    static const uint8_t init3[] = {SSD1306_MEMORYMODE, 0x00, SSD1306_SEGREMAP | 0x1, SSD1306_COMSCANDEC};
+    ssd1306_commandList(init3, sizeof(init3));
+
+    uint8_t com_pins = 0x12;
+    contrast = (vccstate == SSD1306_EXTERNALVCC) ? 0x9F : 0xCF;
+    if (WIDTH == 128 && HEIGHT == 32) {
+        com_pins = 0x02;
+        contrast = 0x8F;
+    }
+    ssd1306_command1(SSD1306_SETCOMPINS);
+    ssd1306_command1(com_pins);
+    ssd1306_command1(SSD1306_SETCONTRAST);
+    ssd1306_command1(contrast);
+
+    ssd1306_command1(SSD1306_SETPRECHARGE);
+    ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x22 : 0xF1);
+    static const uint8_t init5[] = {
+        SSD1306_SETVCOMDETECT, 0x40, SSD1306_DISPLAYALLON_RESUME, SSD1306_NORMALDISPLAY, SSD1306_DEACTIVATE_SCROLL, SSD1306_DISPLAYON};
+    ssd1306_commandList(init5, sizeof(init5));
+    wire->setClock(restoreClk);
+    return true;
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+        return;
+    }
+    switch (getRotation()) {
+        case 1:
+            std::swap(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            std::swap(x, y);
+            y = HEIGHT - y - 1;
+            break;
+    }
+    switch (color) {
+        case SSD1306_WHITE:
+            buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
+            break;
+        case SSD1306_BLACK:
+            buffer[x + (y / 8) * WIDTH] &= ~(1 << (y & 7));
+            break;
+        case SSD1306_INVERSE:
+            buffer[x + (y / 8) * WIDTH] ^= (1 << (y & 7));
+            break;
+    }
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+    memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+}
+
+void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    // Rotation does not matter for the pixel results, only for the speed of the original driver
+    for (int16_t i = 0; i < w; ++i) {
+        drawPixel(x + i, y, color);
+    }
+}
+
+void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t i = 0; i < h; ++i) {
+        drawPixel(x, y + i, color);
+    }
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
+    if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+        return false;
+    }
+    switch (getRotation()) {
+        case 1:
+            std::swap(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            std::swap(x, y);
+            y = HEIGHT - y - 1;
+            break;
+    }
+    return buffer[x + (y / 8) * WIDTH] & (1 << (y & 7));
+}
+
+void Adafruit_SSD1306::display() {
+    static const uint8_t dlist1[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0};
+    ssd1306_commandList(dlist1, sizeof(dlist1));
+    ssd1306_command1(WIDTH - 1);
+
+    uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
+    uint8_t* ptr = buffer;
+    wire->setClock(wireClk);
+    wire->beginTransmission(i2caddr);
+    wire->write(static_cast<uint8_t>(0x40));
+    uint16_t bytes_out = 1;
+    while (count--) {
+        if (bytes_out >= WIRE_MAX) {
+            wire->endTransmission();
+            wire->beginTransmission(i2caddr);
+            wire->write(static_cast<uint8_t>(0x40));
+            bytes_out = 1;
+        }
+        wire->write(*ptr++);
+        bytes_out++;
+    }
+    wire->endTransmission();
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::invertDisplay(bool i) {
+    wire->setClock(wireClk);
+    ssd1306_command1(i ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY);
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::dim(bool dim) {
+    wire->setClock(wireClk);
+    ssd1306_command1(SSD1306_SETCONTRAST);
+    ssd1306_command1(dim ? 0 : contrast);
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
+    wire->setClock(wireClk);
+    static const uint8_t scroll_list1a[] = {SSD1306_RIGHT_HORIZONTAL_SCROLL, 0X00};
+    ssd1306_commandList(scroll_list1a, sizeof(scroll_list1a));
+    ssd1306_command1(start);
+    ssd1306_command1(0X00);
+    ssd1306_command1(stop);
+    static const uint8_t scroll_list1b[] = {0X00, 0XFF, SSD1306_ACTIVATE_SCROLL};
+    ssd1306_commandList(scroll_list1b, sizeof(scroll_list1b));
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
+    wire->setClock(wireClk);
+    static const uint8_t scroll_list2a[] = {SSD1306_LEFT_HORIZONTAL_SCROLL, 0X00};
+    ssd1306_commandList(scroll_list2a, sizeof(scroll_list2a));
+    ssd1306_command1(start);
+    ssd1306_command1(0X00);
+    ssd1306_command1(stop);
+    static const uint8_t scroll_list2b[] = {0X00, 0XFF, SSD1306_ACTIVATE_SCROLL};
+    ssd1306_commandList(scroll_list2b, sizeof(scroll_list2b));
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::stopscroll() {
+    wire->setClock(wireClk);
+    ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
+    wire->setClock(restoreClk);
+}
@@ -0,0 +1,265 @@
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#include "sim_internal.hpp"
+
+TwoWire Wire;
+
+namespace {
+    constexpr uint8_t panel_address = 0x3C;
+    constexpr size_t panel_width = 128;
+    constexpr size_t panel_pages = 8;
+
+    // SSD1306 controller state, only touched with panel_mutex held
+    std::mutex panel_mutex;
+    uint8_t ram[panel_width * panel_pages] = {0};
+    bool display_on = false;
+    bool inverted = false;
+    bool all_on = false;
+    uint8_t addressing_mode = 0x02; // Page addressing after reset
+    uint8_t column_start = 0;
+    uint8_t column_end = panel_width - 1;
+    uint8_t page_start = 0;
+    uint8_t page_end = panel_pages - 1;
+    uint8_t column = 0;
+    uint8_t page = 0;
+    // Command bytes collected until the command has all its arguments, arguments may arrive in later transmissions
+    uint8_t pending_command[8];
+    size_t pending_length = 0;
+    std::atomic<uint64_t> revision{0};
+    std::atomic<uint64_t> bytes_written{0};
+
+    size_t command_length(uint8_t command) {
+        switch (command) {
+            case 0x21: // COLUMNADDR
+            case 0x22: // PAGEADDR
+            case 0xA3: // SET_VERTICAL_SCROLL_AREA
+                return 3;
+            case 0x20: // MEMORYMODE
+            case 0x81: // SETCONTRAST
+            case 0x8D: // CHARGEPUMP
+            case 0xA8: // SETMULTIPLEX
+            case 0xD3: // SETDISPLAYOFFSET
+            case 0xD5: // SETDISPLAYCLOCKDIV
+            case 0xD9: // SETPRECHARGE
+            case 0xDA: // SETCOMPINS
+            case 0xDB: // SETVCOMDETECT
+                return 2;
+            case 0x26: // RIGHT_HORIZONTAL_SCROLL
+            case 0x27: // LEFT_HORIZONTAL_SCROLL
+                return 7;
+            case 0x29: // VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL
+            case 0x2A: // VERTICAL_AND_LEFT_HORIZONTAL_SCROLL
+                return 6;
+            default:
+                return 1;
+        }
+    }
+
+    void execute_command(const uint8_t* c) {
+        switch (c[0]) {
+            case 0x20:
+                addressing_mode = c[1] & 0x03;
+                break;
+            case 0x21:
+                column_start = c[1] & 0x7F;
+                column_end = c[2] & 0x7F;
+                column = column_start;
+                break;
+            case 0x22:
+                page_start = c[1] & 0x07;
+                page_end = c[2] & 0x07;
+                page = page_start;
+                break;
+            case 0xA4:
+                all_on = false;
+                break;
+            case 0xA5:
+                all_on = true;
+                break;
+            case 0xA6:
+                inverted = false;
+                break;
+            case 0xA7:
+                inverted = true;
+                break;
+            case 0xAE:
+                display_on = false;
+                break;
+            case 0xAF:
+                display_on = true;
+                break;
+            default:
+                if (c[0] <= 0x0F) {
+                    column = (column & 0xF0) | (c[0] & 0x0F);
+                } else if (c[0] >= 0x10 && c[0] <= 0x17) {
+                    column = ((c[0] & 0x07) << 4) | (column & 0x0F);
+                } else if (c[0] >= 0xB0 && c[0] <= 0xB7) {
+                    page = c[0] & 0x07;
+                }
+                // Timing, charge pump, scrolling and orientation commands do not change the picture in this model
+                break;
+        }
+    }
+
+    void write_command(uint8_t byte) {
+        pending_command[pending_length++] = byte;
+        if (pending_length >= command_length(pending_command[0])) {
+            execute_command(pending_command);
+            pending_length = 0;
+        }
+    }
+
+    void write_data(uint8_t byte) {
+        ram[page * panel_width + (column & 0x7F)] = byte;
+        revision++;
+        switch (addressing_mode) {
+            case 0x00: // Horizontal
+                if (column >= column_end) {
+                    column = column_start;
+                    page = page >= page_end ? page_start : page + 1;
+                } else {
+                    column++;
+                }
+                break;
+            case 0x01: // Vertical
+                if (page >= page_end) {
+                    page = page_start;
+                    column = column >= column_end ? column_start : column + 1;
+                } else {
+                    page++;
+                }
+                break;
+            default: // Page
+                column = column >= column_end ? column_start : column + 1;
+                break;
+        }
+    }
+
+    void panel_receive(const uint8_t* data, size_t length) {
+        if (length == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(panel_mutex);
+        // The control byte selects commands (D/C# = 0) or display data (D/C# = 1) for the rest of the transmission
+        bool is_data = (data[0] & 0x40) != 0;
+        for (size_t i = 1; i < length; ++i) {
+            if (is_data) {
+                write_data(data[i]);
+            } else {
+                write_command(data[i]);
+            }
+        }
+    }
+}
+
+namespace sim {
+    const uint8_t* panel_ram() {
+        return ram;
+    }
+
+    bool panel_is_on() {
+        std::lock_guard<std::mutex> lock(panel_mutex);
+        return display_on;
+    }
+
+    uint64_t panel_revision() {
+        return revision;
+    }
+
+    uint64_t i2c_bytes_written() {
+        return bytes_written;
+    }
+
+    bool write_pbm(const char* path) {
+        uint8_t rows[64][panel_width / 8] = {{0}};
+        {
+            std::lock_guard<std::mutex> lock(panel_mutex);
+            for (size_t y = 0; y < 64; ++y) {
+                for (size_t x = 0; x < panel_width; ++x) {
+                    bool lit = (ram[(y / 8) * panel_width + x] >> (y & 7)) & 1;
+                    lit = display_on && (all_on || (lit != inverted));
+                    if (lit) {
+                        rows[y][x / 8] |= 0x80 >> (x & 7);
+                    }
+                }
+            }
+        }
+        FILE* file = fopen(path, "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        // P4 uses 1 for black, so lit pixels are stored as 0 to get white on black like the panel
+        fprintf(file, "P4\n%zu 64\n", panel_width);
+        for (auto& row : rows) {
+            for (auto& byte : row) {
+                byte = ~byte;
+            }
+        }
+        bool ok = fwrite(rows, 1, sizeof(rows), file) == sizeof(rows);
+        return fclose(file) == 0 && ok;
+    }
+}
+
+namespace sim::internal {
+    void i2c_transfer(uint8_t address, const uint8_t* data, size_t length, uint32_t clock) {
+        // Start, address byte with ACK and 9 clocks per data byte, stop
+        bytes_written += length + 1;
+        if (address == panel_address) {
+            panel_receive(data, length);
+        }
+        if (clock != 0) {
+            sleep_us((length + 1) * 9 * 1000000ULL / clock);
+        }
+    }
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    (void)sda;
+    (void)scl;
+    if (frequency != 0) {
+        clock = frequency;
+    }
+    return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+    clock = frequency;
+    return true;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    this->address = address;
+    length = 0;
+    transmitting = true;
+}
+
+uint8_t TwoWire::endTransmission(bool send_stop) {
+    (void)send_stop;
+    if (!transmitting) {
+        return 4;
+    }
+    transmitting = false;
+    sim::internal::i2c_transfer(address, buffer, length, clock);
+    return address == panel_address ? 0 : 2; // 2 = NACK on address
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (!transmitting || length >= sizeof(buffer)) {
+        return 0;
+    }
+    buffer[length++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t size) {
+    size_t written = 0;
+    while (written < size && write(data[written]) == 1) {
+        ++written;
+    }
+    return written;
+}
@@ -2,6 +2,8 @@
 #include "core/timekeeper.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/text.hpp"
 #include "core/sound.hpp"
 #include "constants.hpp"
 
@@ -23,6 +25,8 @@ namespace apps::alarm {
 
     SelectedField selected_field = SelectedField::HOURS;
 
+    constexpr uint64_t rtc_check_interval_us = 1000000; // Check if the RTC got synced every second
+
     constexpr uint64_t SECOND_TICKS = 1;
     constexpr uint64_t MINUTE_TICKS = SECOND_TICKS * 60;
     constexpr uint64_t HOUR_TICKS = MINUTE_TICKS * 60;
@@ -95,6 +99,7 @@ namespace apps::alarm {
         }
         last_alarm_snoozed = timekeeper::rtc_s(); // Reset snooze to now to avoid immediate retrigger
         xSemaphoreGive(alarm_mutex);
+        menu::set_alarm_set(get_alarm_timestamp().timestamp != 0);
     }
 
     void change_selected_field(bool next) {
@@ -127,17 +132,11 @@ namespace apps::alarm {
         xSemaphoreGive(alarm_mutex);
         if (local_alarm_is_playing) {
             display.fillRect(0, 24, SCREEN_WIDTH, 16, SSD1306_WHITE);
-            display.setTextColor(SSD1306_INVERSE);
-            display.setTextSize(2);
-            display.setCursor(30, 25);
-            display.println("ALARM!");
-            display.setTextSize(1);
-            display.setCursor(10, 50);
-            display.println("Press A to snooze");
-            display.display();
+            text::print(display, 30, 25, "ALARM!", 2, SSD1306_INVERSE);
+            text::print(display, 10, 50, "Press A to snooze", 1, SSD1306_INVERSE);
+            framebuffer::flush(display);
             return;
         }
-        display.setTextSize(2);
         switch (selected_field) {
             case SelectedField::HOURS:
             display.fillRect(19, 19, 24, 16, SSD1306_WHITE);
@@ -151,25 +150,20 @@ namespace apps::alarm {
             case SelectedField::ENABLE:
             break;
         }
-        display.setCursor(20, 20);
-        display.setTextColor(SSD1306_INVERSE);
-        display.printf("%02llu:%02llu:%02llu", hours, minutes, seconds);
-        display.setTextSize(1);
+        text::printf(display, 20, 20, 2, SSD1306_INVERSE, "%02llu:%02llu:%02llu", hours, minutes, seconds);
         if (selected_field == SelectedField::ENABLE) {
             display.fillRect(0, 50, SCREEN_WIDTH, 16, SSD1306_WHITE);   
         }
         if (!rtc_available) {
-            display.setCursor(10, 51);
-            display.printf("sync RTC to enable");
+            text::print(display, 10, 51, "sync RTC to enable", 1, SSD1306_INVERSE);
         } else {
-            display.setCursor(30, 51);
-            display.printf("Alarm: %s", local_alarm_enabled ? "ON" : "OFF");
+            text::printf(display, 30, 51, 1, SSD1306_INVERSE, "Alarm: %s", local_alarm_enabled ? "ON" : "OFF");
         }
-        display.display();
+        framebuffer::flush(display);
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         xSemaphoreTake(alarm_mutex, portMAX_DELAY);
         bool local_alarm_is_playing = alarm_is_playing;
         xSemaphoreGive(alarm_mutex);
@@ -230,8 +224,11 @@ namespace apps::alarm {
                         menu::set_dirty();
                     }
                 }
+                menu::wake_up_in(rtc_check_interval_us);
                 menu::upkeep(display);
                 break;
+            default:
+                break;
             }
         }
     }
@@ -251,9 +248,10 @@ namespace apps::alarm {
         tm timeinfo = {0};
         while (true) {
             getLocalTime(&timeinfo, 0);
+            TimestampAndTriggered alarm_info = get_alarm_timestamp();
+            menu::set_alarm_set(alarm_info.timestamp != 0); // The RTC may have just been synced
             if (timeinfo.tm_year + 1900 >= 2025) {
                 time_t now = mktime(&timeinfo);
-                TimestampAndTriggered alarm_info = get_alarm_timestamp();
                 if (alarm_info.timestamp != 0 && now >= alarm_info.timestamp && !alarm_info.triggered) {
                     sound::async_play_interruptible_melody(alarm_tone, sizeof(alarm_tone)/sizeof(alarm_tone[0]), true);
                     xSemaphoreTake(alarm_mutex, portMAX_DELAY);
@@ -1,13 +1,15 @@
 #include "apps/battery.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 #include "core/battery.hpp"
 #include "constants.hpp"
 
 namespace apps::battery {
     uint8_t voltage_dv = 0; // voltage decivolts
+    constexpr uint64_t update_interval_us = UPDATE_STATUS_INTERVAL_MS * 1000;
     void app(Adafruit_SSD1306 &display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -26,9 +28,12 @@ namespace apps::battery {
                     voltage_dv = status.voltage_dv;
                     menu::set_dirty();
                 }
+                menu::wake_up_in(update_interval_us);
                 menu::upkeep(display);
                 break;
             }
+            default:
+                break;
         }
     }
     void draw(Adafruit_SSD1306 &display) {
@@ -38,6 +43,6 @@ namespace apps::battery {
         display.setTextColor(SSD1306_WHITE);
         display.setCursor(SCREEN_WIDTH / 2 - 2*6*2, 30);
         display.printf("%u.%uV", voltage_dv / 10, voltage_dv % 10);
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
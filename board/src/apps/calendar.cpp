@@ -1,6 +1,7 @@
 #include "apps/calendar.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
 #include "constants.hpp"
@@ -29,7 +30,7 @@ namespace apps::calendar {
     bool day_selected = false;
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -72,6 +73,8 @@ namespace apps::calendar {
                         }
                         menu::set_dirty();
                         break;
+                    default:
+                        break;
                 }       
                 break;
             case events::EventType::NONE:
@@ -90,8 +93,11 @@ namespace apps::calendar {
                     }
                     last_today_update_us = timekeeper::now_us();
                 }
+                menu::wake_up_at(last_today_update_us + today_update_interval_us);
                 menu::upkeep(display);
                 break;
+            default:
+                break;
         }
     }
 
@@ -155,6 +161,6 @@ namespace apps::calendar {
                 mktime(&cursor); // Normalize to get correct tm_wday
             }
         }
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "apps/clock.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/text.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
 #include "constants.hpp"
@@ -38,14 +40,8 @@ namespace apps::clock {
             selector_offset = SCREEN_WIDTH / 2;
         }
         display.fillRect(selector_offset, 8, SCREEN_WIDTH/2, 8, SSD1306_WHITE);
-        display.setTextColor(SSD1306_INVERSE);
-        display.setTextSize(1);
-        display.setCursor(16, 8);
-        display.println("BOOT");
-        display.setCursor(SCREEN_WIDTH - 16 - 3*6, 8);
-        display.println("RTC");
-        display.setTextSize(2);
-        display.setCursor(10, 20);
+        text::print(display, 16, 8, "BOOT", 1, SSD1306_INVERSE);
+        text::print(display, SCREEN_WIDTH - 16 - 3*6, 8, "RTC", 1, SSD1306_INVERSE);
         if (clock_mode == ClockMode::SINCE_BOOT) { // SINCE_BOOT
             uint64_t micros = timekeeper::now_us();
             auto total_seconds = micros / 1000000;
@@ -53,52 +49,39 @@ namespace apps::clock {
             auto hours = (total_seconds % 86400) / 3600;
             auto minutes = (total_seconds % 3600) / 60;
             auto seconds = total_seconds % 60;
-            char buffer[30];
-            display.setTextSize(1);
-            display.setCursor(10, 18);
-            snprintf(buffer, sizeof(buffer), "%lld day%s",
+            text::printf(display, 10, 18, 1, SSD1306_INVERSE, "%lld day%s",
                      days, days == 1 ? "" : "s");
-            display.println(buffer);
-            display.setCursor(10, 32);
-            display.setTextSize(2);
-            snprintf(buffer, sizeof(buffer), "%02lld:%02lld:%02lld",
+            text::printf(display, 10, 32, 2, SSD1306_INVERSE, "%02lld:%02lld:%02lld",
                     hours, minutes, seconds);
-            display.println(buffer);
-            display.setTextSize(1);
-            display.setCursor(10, 50);
-            display.println("since boot");
+            text::print(display, 10, 50, "since boot", 1, SSD1306_INVERSE);
         } else if (!valid_timeinfo(timeinfo)) { // REAL_TIME but not valid
-            display.println("No RTC");
-            display.setTextSize(1);
-            display.setCursor(10, 40);
-            display.println("Connect WiFi");
-            display.setCursor(10, 48);
-            display.println("for NTP sync");
+            text::print(display, 10, 20, "No RTC", 2, SSD1306_INVERSE);
+            text::print(display, 10, 40, "Connect WiFi", 1, SSD1306_INVERSE);
+            text::print(display, 10, 48, "for NTP sync", 1, SSD1306_INVERSE);
         } else { // REAL_TIME and valid
-            display.printf(
+            text::printf(
+                display, 10, 20, 2, SSD1306_INVERSE,
                 "%02d:%02d:%02d",
                 timeinfo.tm_hour,
                 timeinfo.tm_min,
                 timeinfo.tm_sec
             );
-            display.setTextSize(1);
-            display.setCursor(10, 40);
-            display.print(day_names[timeinfo.tm_wday]);
-            display.setCursor(10, 50);
-            display.printf(
+            text::print(display, 10, 40, day_names[timeinfo.tm_wday], 1, SSD1306_INVERSE);
+            text::printf(
+                display, 10, 50, 1, SSD1306_INVERSE,
                 "%02d %s %04d",
                 timeinfo.tm_mday,
                 month_names[timeinfo.tm_mon],
                 timeinfo.tm_year + 1900
             );
         }
-        display.display();
+        framebuffer::flush(display);
     }
 
     void app(Adafruit_SSD1306& display) {
         constexpr uint64_t time_info_update_interval_us = 1000000; // Update time info every second
         // Implementation for the time app logic
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -132,6 +115,7 @@ namespace apps::clock {
                         menu::set_dirty();
                     }
                 }
+                menu::wake_up_at(last_time_info_update_us + time_info_update_interval_us);
                 menu::upkeep(display);
                 break;
             default:
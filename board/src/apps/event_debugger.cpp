@@ -1,13 +1,14 @@
 #include "apps/event_debugger.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 
 namespace apps::event_debugger {
 
     events::Event last_event = { .type = events::EventType::NONE, {} };
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         if (ev.type != events::EventType::NONE) {
             last_event = ev;
             menu::set_dirty();
@@ -76,11 +77,35 @@ namespace apps::event_debugger {
                 display.printf(" Timestamp: %llu\n", last_event.button_release_event.timestamp);
                 display.printf(" Duration: %llu us\n", last_event.button_release_event.duration);
                 break;
+            case events::EventType::GESTURE:
+                display.printf("Gesture:\n");
+                switch (last_event.gesture_event.type) {
+                    case events::GestureType::LONG_PRESS:
+                        display.printf(" Long Press %s\n", button_to_string(last_event.gesture_event.buttons));
+                        break;
+                    case events::GestureType::DOUBLE_PRESS:
+                        display.printf(" Double Press %s\n", button_to_string(last_event.gesture_event.buttons));
+                        break;
+                    case events::GestureType::CHORD:
+                        {
+                            auto first = static_cast<uint8_t>(last_event.gesture_event.buttons);
+                            auto second = first & (first - 1); // Drop the lowest button
+                            display.printf(" Chord %s+%s\n",
+                                button_to_string(static_cast<events::Button>(first ^ second)),
+                                button_to_string(static_cast<events::Button>(second))
+                            );
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                display.printf(" Timestamp: %llu\n", last_event.gesture_event.timestamp);
+                break;
             case events::EventType::NONE:
             default:
                 display.printf("No events received yet.\n");
                 break;
         }
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "core/sound.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 #include "constants.hpp"
 
 namespace apps::metronome {
@@ -39,7 +40,7 @@ namespace apps::metronome {
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -80,11 +81,15 @@ namespace apps::metronome {
                         change_bpm(bpm - 1);
                         menu::set_dirty();
                         break;
+                    default:
+                        break;
                 }
                 break;
             case events::EventType::NONE:
                 menu::upkeep(display);
                 break;
+            default:
+                break;
         }
     }
     void draw(Adafruit_SSD1306& display) {
@@ -108,6 +113,6 @@ namespace apps::metronome {
         display.print("A: Start/Stop");
         display.setCursor(0, 56);
         display.print("UP/DOWN: Change BPM");
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "apps/music.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/image.hpp"
 #include "core/sound.hpp"
 #include "constants.hpp"
 #include "melodies/cmajor.hpp"
@@ -12,6 +14,7 @@
 namespace apps::music {
     size_t cursor = 0;
     bool currently_playing = false;
+    constexpr uint64_t playback_check_interval_us = 100000; // Check if the melody ended every 100ms
 
     constexpr const char* melodies[] = {
         "C Major Scale",
@@ -36,7 +39,7 @@ namespace apps::music {
             melodies_notes[cursor], 
             melodies_lengths[cursor]); 
         currently_playing = true;
-        logger::info("Playing melody: %s", melodies[cursor]);
+        LOG_INFO("Playing melody: %s", melodies[cursor]);
     }
 
     void back_action(Adafruit_SSD1306& display) {
@@ -45,7 +48,7 @@ namespace apps::music {
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 if (currently_playing) {
@@ -77,6 +80,8 @@ namespace apps::music {
                     if (!sound::is_melody_playing()) {
                         currently_playing = false;
                         menu::set_dirty();
+                    } else {
+                        menu::wake_up_in(playback_check_interval_us);
                     }
                 }
                 menu::upkeep(display);
@@ -87,13 +92,12 @@ namespace apps::music {
     }
 
     void draw(Adafruit_SSD1306& display) {
-        display.clearDisplay();
         if (currently_playing) {
-            display.drawBitmap(0, 0, images::playing_music, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
+            image::blit_image(images::playing_music_packed, 0, 0, display);
             menu::draw_generic_titlebar(display, "Playing Melody");
             display.setCursor(20, 54);
             display.println("Press A to stop");
-            display.display();
+            framebuffer::flush(display);
         } else {
             menu::draw_generic_menu(display, "Select Melody", melodies, sizeof(melodies)/sizeof(melodies[0]), cursor);
         }
@@ -1,6 +1,8 @@
 #include "apps/pet.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/image.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
 #include "images/pet_happy.hpp"
@@ -20,33 +22,32 @@ namespace apps::pet {
     uint16_t current_frame = 0;
     uint16_t repeat_count = 0;
     uint16_t repeat_until = 10;
-    uint64_t last_update_ms = 0;
+    uint64_t last_frame_index = 0;
+    constexpr uint16_t FPS = 24;
+    constexpr uint64_t FRAME_DURATION_US = 1000000 / FPS;
 
     void update() {
-        constexpr uint64_t FPS = 24;
-        constexpr uint64_t FRAME_DURATION_MS = 1000 / FPS;
-        auto now = timekeeper::now_us() / 1000;
-        if (last_update_ms + FRAME_DURATION_MS < now) {
-            last_update_ms = now;
-            if (current_frame == 0) {
-                if (repeat_count < repeat_until) {
-                    repeat_count++;
-                    return;
-                } else {
-                    repeat_count = 0;
+        menu::set_frame_rate(FPS); // Wakes us up at the start of every frame
+        // Same frames as menu's frame pacing, so each wake up advances the animation by one frame
+        auto frame_index = timekeeper::now_us() / FRAME_DURATION_US;
+        if (frame_index != last_frame_index) {
+            last_frame_index = frame_index;
+            if (current_frame == 0 && repeat_count < repeat_until) {
+                repeat_count++; // Hold the first frame for a while
+            } else {
+                repeat_count = 0;
+                current_frame++;
+                menu::set_dirty();
+                current_frame %= images::pet_happy_width / SCREEN_WIDTH;
+                if (current_frame == 0) {
+                    repeat_until = random(5, 40);
                 }
             }
-            current_frame++;
-            menu::set_dirty();
-            current_frame %= images::pet_happy_width / SCREEN_WIDTH;
-            if (current_frame == 0) {
-                repeat_until = random(5, 40);
-            }
         }
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -55,24 +56,21 @@ namespace apps::pet {
                         menu::current_app = menu::App::NONE;
                         menu::set_dirty();
                         break;
+                    default:
+                        break;
                 }
                 break;
             case events::EventType::NONE:
                 update();
                 menu::upkeep(display);
                 break;
+            default:
+                break;
         }
     }  
     void draw(Adafruit_SSD1306& display) {
-        display.clearDisplay();
-        for (uint16_t x = 0; x < SCREEN_WIDTH; ++x) {
-            for (uint16_t y = 0; y < SCREEN_HEIGHT; ++y) {
-                uint16_t src_x = (current_frame * SCREEN_WIDTH + x) / 8;
-                uint16_t src_y = y;
-                bool pixel = images::pet_happy[src_y * (images::pet_happy_width / 8) + src_x] & (1 << (7 - (x % 8)));
-                display.drawPixel(x, y, pixel ? SSD1306_WHITE : SSD1306_BLACK);
-            }
-        }              
-        display.display();
+        // Frames are side by side in the sprite sheet
+        image::blit_image(images::pet_happy_packed, current_frame * SCREEN_WIDTH, 0, display);
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
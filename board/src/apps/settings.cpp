@@ -3,10 +3,12 @@
 
 #include "apps/settings.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 #include "core/logger.hpp"
 #include "core/events.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
+#include "core/network.hpp"
 #include "constants.hpp"
 
 
@@ -35,7 +37,9 @@ namespace apps::settings {
         "WiFi Enabled",
         "WiFi SSID",
         "WiFi Password",
-        "Location",
+        "Location 1",
+        "Location 2",
+        "Location 3",
         "Save Settings",
         "Reset to Defaults",
         "Factory Reset",
@@ -89,12 +93,17 @@ namespace apps::settings {
         WIFI_ENABLED = 3,
         WIFI_SSID = 4,
         WIFI_PASSWORD = 5,
-        LOCATION = 6,
-        SAVE_SETTINGS = 7,
-        RESET_TO_DEFAULTS = 8,
-        FACTORY_RESET = 9,
+        LOCATION = 6, // To LOCATION + MAX_WEATHER_LOCATIONS - 1
+        SAVE_SETTINGS = 9,
+        RESET_TO_DEFAULTS = 10,
+        FACTORY_RESET = 11,
     };
+    static_assert(static_cast<size_t>(SettingsOption::SAVE_SETTINGS) == static_cast<size_t>(SettingsOption::LOCATION) + MAX_WEATHER_LOCATIONS, "One settings entry per location");
+
+    // NVS keys of the locations, the first one keeps the key of the single location of older versions
+    const char* location_keys[MAX_WEATHER_LOCATIONS] = {"location", "location2", "location3"};
     SettingsOption current_option = SettingsOption::NONE;
+    size_t location_index = 0; // Of the location being edited
     size_t cursor = 0;
     size_t tz_cursor = 0;
 
@@ -112,7 +121,12 @@ namespace apps::settings {
     }
 
     void action(size_t cursor, Adafruit_SSD1306& display) {
-        switch (static_cast<SettingsOption>(cursor + 1)) {
+        auto option = static_cast<SettingsOption>(cursor + 1);
+        if (option >= SettingsOption::LOCATION && option < SettingsOption::SAVE_SETTINGS) {
+            location_index = static_cast<size_t>(option) - static_cast<size_t>(SettingsOption::LOCATION);
+            option = SettingsOption::LOCATION;
+        }
+        switch (option) {
             case SettingsOption::DATE_TIME:
                 getLocalTime(&base_time, 0);
                 current_option = SettingsOption::DATE_TIME;
@@ -211,7 +225,7 @@ namespace apps::settings {
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (current_option) {
             case SettingsOption::NONE:
                 menu::handle_generic_menu_navigation(
@@ -337,15 +351,15 @@ namespace apps::settings {
                 auto kb_event = menu::handle_keyboard_input(
                     ev,
                     kb_status,
-                    new_settings.location
+                    new_settings.locations[location_index]
                 );
                 if (kb_event == menu::KBEvent::ENTER_PRESSED) {
-                    if (new_settings.location != settings.location) {
+                    if (new_settings.locations[location_index] != settings.locations[location_index]) {
                         new_settings_dirty = true;
                     }
                     current_option = SettingsOption::NONE;
                 } else if (kb_event == menu::KBEvent::KEYBOARD_CLOSED) {
-                    new_settings.location = settings.location; // Revert changes
+                    new_settings.locations[location_index] = settings.locations[location_index]; // Revert changes
                     current_option = SettingsOption::NONE;
                 }
                 break;
@@ -454,7 +468,7 @@ namespace apps::settings {
                 );
                 display.setCursor(10, 50);
                 display.print("Press A to set");
-                display.display();
+                framebuffer::flush(display);
                 break;
             }
             case SettingsOption::TIMEZONE:
@@ -491,7 +505,7 @@ namespace apps::settings {
                 menu::draw_keyboard(
                     display,
                     kb_status,
-                    new_settings.location
+                    new_settings.locations[location_index]
                 );
                 break;
             case SettingsOption::SAVE_SETTINGS:
@@ -577,7 +591,7 @@ namespace apps::settings {
         xSemaphoreTake(settings_memory_mutex, portMAX_DELAY);
         Preferences prefs;
         if (!prefs.begin("settings", false)) {
-            logger::error("Failed to open settings for writing.");
+            LOG_ERROR("Failed to open settings for writing.");
             xSemaphoreGive(settings_memory_mutex);
             return;
         }
@@ -585,23 +599,26 @@ namespace apps::settings {
         prefs.putBool("wifi_enabled", new_settings.wifi_enabled);
         prefs.putString("wifi_ssid", new_settings.wifi_ssid);
         prefs.putString("wifi_password", new_settings.wifi_password);
-        prefs.putString("location", new_settings.location);
+        for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+            prefs.putString(location_keys[i], new_settings.locations[i]);
+        }
         prefs.end();
         settings_loaded = false; // Force reload next time
         xSemaphoreGive(settings_memory_mutex);
         timekeeper::update_ntp_settings(new_settings.timezone);
+        network::wake(); // Applies the WiFi settings, and a weather location change makes its job due
     }
 
     void factory_reset() {
         xSemaphoreTake(settings_memory_mutex, portMAX_DELAY);
         esp_err_t err = nvs_flash_erase();
         if (err != ESP_OK) {
-            logger::error("Failed to erase NVS flash: %d", err);
+            LOG_ERROR("Failed to erase NVS flash: %d", err);
             xSemaphoreGive(settings_memory_mutex);
             return;
         }
         nvs_flash_init();
-        logger::info("Settings reset to factory defaults.");
+        LOG_INFO("Settings reset to factory defaults.");
         settings_loaded = false; // Force reload next time
         xSemaphoreGive(settings_memory_mutex);
     }
@@ -610,13 +627,13 @@ namespace apps::settings {
         xSemaphoreTake(settings_memory_mutex, portMAX_DELAY);
         Preferences prefs;
         if (!prefs.begin("settings", false)) {
-            logger::error("Failed to open settings for clearing.");
+            LOG_ERROR("Failed to open settings for clearing.");
             xSemaphoreGive(settings_memory_mutex);
             return;
         }
         prefs.clear();
         prefs.end();
-        logger::info("All settings cleared.");
+        LOG_INFO("All settings cleared.");
         settings_loaded = false; // Force reload next time
         xSemaphoreGive(settings_memory_mutex);
     }
@@ -629,7 +646,7 @@ namespace apps::settings {
         }
         Preferences prefs;
         if (!prefs.begin("settings", true)) {
-            logger::error("Failed to open settings for reading.");
+            LOG_ERROR("Failed to open settings for reading.");
             xSemaphoreGive(settings_memory_mutex);
             return settings;
         }
@@ -637,7 +654,9 @@ namespace apps::settings {
         settings.wifi_enabled = prefs.getBool("wifi_enabled", settings.wifi_enabled);
         settings.wifi_ssid = prefs.getString("wifi_ssid", settings.wifi_ssid);
         settings.wifi_password = prefs.getString("wifi_password", settings.wifi_password);
-        settings.location = prefs.getString("location", settings.location);
+        for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+            settings.locations[i] = prefs.getString(location_keys[i], settings.locations[i]);
+        }
         prefs.end();
         settings_loaded = true;
         xSemaphoreGive(settings_memory_mutex);
@@ -1,6 +1,8 @@
 #pragma once
 #include <Adafruit_SSD1306.h>
 
+#include "constants.hpp"
+
 namespace apps::settings {
     enum class Timezone {
         TZ_AoE, // Anywhere on Earth (UTC-12)
@@ -47,7 +49,7 @@ namespace apps::settings {
         bool wifi_enabled = false;
         String wifi_ssid = "";
         String wifi_password = "";
-        String location = "Greenwich"; // Default location
+        String locations[MAX_WEATHER_LOCATIONS] = {"Greenwich"}; // Empty entries are unused
         Timezone timezone = Timezone::TZ_UTC;
     };
 
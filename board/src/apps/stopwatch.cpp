@@ -1,12 +1,15 @@
 #include "apps/stopwatch.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/text.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
 
 namespace apps::stopwatch {
     uint64_t start_time_us = 0;
     uint64_t pause_time_us = 0;
+    constexpr uint16_t running_fps = 25; // Redraw rate while running
 
     void draw(Adafruit_SSD1306& display) {
         display.clearDisplay();
@@ -23,25 +26,20 @@ namespace apps::stopwatch {
         uint64_t seconds = (elapsed_us / 1000000) % 60;
         uint64_t minutes = (elapsed_us / 60000000);
 
-        display.setTextSize(2);
-        display.setCursor(26, 20);
-        display.printf("%02llu:%02llu", minutes, seconds);
-        display.setTextSize(1);
-        display.setCursor(86, 26);
-        display.printf(".%03llu", ms);
-        display.setCursor(16, 50);
+        text::printf(display, 26, 20, 2, SSD1306_WHITE, "%02llu:%02llu", minutes, seconds);
+        text::printf(display, 86, 26, 1, SSD1306_WHITE, ".%03llu", ms);
         if (start_time_us == 0) {
-            display.println("Press A to Start");
+            text::print(display, 16, 50, "Press A to Start");
         } else if (pause_time_us == 0) {
-            display.println("Press A to Pause");
+            text::print(display, 16, 50, "Press A to Pause");
         } else {
-            display.println("Press A to Reset");
+            text::print(display, 16, 50, "Press A to Reset");
         }
-        display.display();
+        framebuffer::flush(display);
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -68,11 +66,12 @@ namespace apps::stopwatch {
                 }
             case events::EventType::NONE:
                 if (pause_time_us == 0 && start_time_us != 0) {
+                    menu::set_frame_rate(running_fps);
                     menu::set_dirty(); // Continuously update the display while running
-                    menu::upkeep(display, 0);
                 } else {
-                    menu::upkeep(display);
+                    menu::set_frame_rate(0);
                 }
+                menu::upkeep(display);
                 break;
             default:
                 break;      
@@ -1,24 +1,24 @@
 #include <math.h>
 #include <cstdint>
-#include <OneWire.h>
-#include <DallasTemperature.h>
+#include <cstring>
 
 #include "apps/temperature.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/history.hpp"
 #include "core/sound.hpp"
+#include "core/text.hpp"
+#include "core/thermometer.hpp"
 #include "core/timekeeper.hpp"
 #include "constants.hpp"
 
 namespace apps::temperature {
-    float last_internal_temperature = NAN;
-    float last_external_temperature = NAN;
-    uint64_t last_update_time_us = 0;
-    constexpr uint64_t update_interval_us = 5000000; // 5 seconds
-
-    OneWire oneWire(TMP_PIN);
-    DallasTemperature sensors(&oneWire);
-    bool sensors_initialized = false;
+    // The sensors are read by the thermometer task, the app only shows its last readings
+    uint64_t last_reading_time_us = 0;
+    constexpr uint64_t sample_interval_us = TEMPERATURE_SAMPLE_INTERVAL_MS * 1000;
+    constexpr uint64_t retry_interval_us = 100000; // Check every 100ms while no reading is available
+    size_t selected_sensor = 0;
 
     enum class TemperatureMode {
         INTERNAL_TMP,
@@ -26,7 +26,181 @@ namespace apps::temperature {
     };
     TemperatureMode temperature_mode = TemperatureMode::INTERNAL_TMP;
 
+    // History chart, one column per time slice of the span ending pan_s before now
+    bool chart_open = false;
+    history::Channel chart_channel = history::Channel::INTERNAL_TEMPERATURE;
+    constexpr uint32_t chart_spans_s[] = {2 * 3600, 12 * 3600, 2 * 86400, 8 * 86400, 30 * 86400, 120 * 86400};
+    constexpr const char* chart_span_labels[] = {"2h", "12h", "2d", "8d", "30d", "120d"};
+    constexpr size_t chart_zoom_count = sizeof(chart_spans_s) / sizeof(chart_spans_s[0]);
+    size_t chart_zoom = 1;
+    uint32_t pan_s = 0;
+    uint32_t chart_revision = 0;
+    constexpr int16_t CHART_TOP = 17; // Under the title bar and the range row
+    constexpr int16_t CHART_HEIGHT = SCREEN_HEIGHT - CHART_TOP;
+    constexpr int16_t CHART_WIDTH = SCREEN_WIDTH;
+    history::Bucket chart_columns[CHART_WIDTH];
+
+    thermometer::Reading get_reading() {
+        if (temperature_mode == TemperatureMode::INTERNAL_TMP) {
+            return thermometer::get_internal();
+        }
+        return thermometer::get_external(selected_sensor);
+    }
+
+    const char* chart_title() {
+        switch (chart_channel) {
+            case history::Channel::INTERNAL_TEMPERATURE:
+                return "Internal history";
+            case history::Channel::EXTERNAL_TEMPERATURE:
+                return "External history";
+            default:
+                return "Battery history";
+        }
+    }
+
+    // Panning stops where the window would start before the oldest day bucket
+    uint32_t max_pan_s() {
+        uint32_t retention_s = history::retention_s(history::Resolution::DAY);
+        uint32_t span_s = chart_spans_s[chart_zoom];
+        return retention_s > span_s ? retention_s - span_s : 0;
+    }
+
+    // Temperatures are in hundredths of a degree, the battery voltage in millivolts
+    int16_t print_value(Adafruit_SSD1306& display, int16_t x, int32_t value) {
+        if (chart_channel == history::Channel::BATTERY_VOLTAGE) {
+            return text::printf(display, x, 8, 1, SSD1306_WHITE, "%.2fV", value / 1000.0f);
+        }
+        return text::printf(display, x, 8, 1, SSD1306_WHITE, "%.1fC", value / 100.0f);
+    }
+
+    void draw_chart(Adafruit_SSD1306& display) {
+        display.clearDisplay();
+        menu::draw_generic_titlebar(display, chart_title());
+        uint32_t span_s = chart_spans_s[chart_zoom];
+        text::print(display, SCREEN_WIDTH - static_cast<int16_t>(strlen(chart_span_labels[chart_zoom])) * text::GLYPH_WIDTH, 8, chart_span_labels[chart_zoom]);
+        uint32_t now_s = static_cast<uint32_t>(timekeeper::rtc_s());
+        if (now_s == 0) {
+            text::print(display, 0, 8, "Clock not synced");
+            framebuffer::flush(display);
+            return;
+        }
+        uint32_t end_s = now_s - MIN(pan_s, now_s);
+        uint32_t start_s = end_s > span_s ? end_s - span_s : 0;
+        // The buckets of the finest ring still holding the start of the window, panned or not, merged per column, at
+        // most a few hundred of them whatever the span
+        history::Resolution resolution = history::resolution_for(now_s - start_s);
+        int32_t low = INT32_MAX;
+        int32_t high = INT32_MIN;
+        for (int16_t column = 0; column < CHART_WIDTH; ++column) {
+            uint32_t from_s = start_s + static_cast<uint64_t>(span_s) * column / CHART_WIDTH;
+            uint32_t to_s = start_s + static_cast<uint64_t>(span_s) * (column + 1) / CHART_WIDTH;
+            chart_columns[column] = history::get(resolution, chart_channel, from_s, to_s);
+            if (chart_columns[column].count > 0) {
+                low = MIN(low, chart_columns[column].min);
+                high = MAX(high, chart_columns[column].max);
+            }
+        }
+        if (low > high) {
+            text::print(display, 0, 8, "No data");
+            framebuffer::flush(display);
+            return;
+        }
+        int16_t x = print_value(display, 0, low);
+        x = text::print(display, x, 8, "-");
+        print_value(display, x, high);
+        int32_t range = MAX(high - low, 1);
+        for (int16_t column = 0; column < CHART_WIDTH; ++column) {
+            const history::Bucket& bucket = chart_columns[column];
+            if (bucket.count == 0) {
+                continue;
+            }
+            // Min to max of the column, higher values up
+            int16_t top = CHART_TOP + (CHART_HEIGHT - 1) * (high - bucket.max) / range;
+            int16_t bottom = CHART_TOP + (CHART_HEIGHT - 1) * (high - bucket.min) / range;
+            display.drawFastVLine(column, top, bottom - top + 1, SSD1306_WHITE);
+        }
+        framebuffer::flush(display);
+    }
+
+    void chart_app(const events::Event& ev) {
+        switch (ev.type) {
+            case events::EventType::BUTTON_PRESS:
+                switch (ev.button_press_event.button) {
+                    case events::Button::UP:
+                        if (chart_zoom > 0) {
+                            chart_zoom--;
+                            sound::play_navigation_tone();
+                            menu::set_dirty();
+                        }
+                        break;
+                    case events::Button::DOWN:
+                        if (chart_zoom + 1 < chart_zoom_count) {
+                            chart_zoom++;
+                            pan_s = MIN(pan_s, max_pan_s());
+                            sound::play_navigation_tone();
+                            menu::set_dirty();
+                        }
+                        break;
+                    case events::Button::LEFT:
+                        if (pan_s < max_pan_s()) {
+                            pan_s = MIN(pan_s + chart_spans_s[chart_zoom] / 2, max_pan_s());
+                            sound::play_navigation_tone();
+                            menu::set_dirty();
+                        }
+                        break;
+                    case events::Button::RIGHT:
+                        if (pan_s > 0) {
+                            pan_s -= MIN(pan_s, chart_spans_s[chart_zoom] / 2);
+                            sound::play_navigation_tone();
+                            menu::set_dirty();
+                        }
+                        break;
+                    case events::Button::A:
+                        switch (chart_channel) {
+                            case history::Channel::INTERNAL_TEMPERATURE:
+                                chart_channel = history::Channel::EXTERNAL_TEMPERATURE;
+                                break;
+                            case history::Channel::EXTERNAL_TEMPERATURE:
+                                chart_channel = history::Channel::BATTERY_VOLTAGE;
+                                break;
+                            default:
+                                chart_channel = history::Channel::INTERNAL_TEMPERATURE;
+                                break;
+                        }
+                        sound::play_navigation_tone();
+                        menu::set_dirty();
+                        break;
+                    case events::Button::B:
+                        chart_open = false;
+                        last_reading_time_us = 0;
+                        sound::play_cancel_tone();
+                        menu::set_dirty();
+                        break;
+                    default:
+                        break;
+                }
+                break;
+            case events::EventType::NONE:
+            {
+                // New records arrive once a minute
+                uint32_t revision = history::revision();
+                if (revision != chart_revision) {
+                    chart_revision = revision;
+                    menu::set_dirty();
+                }
+                menu::wake_up_in(1000000);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
     void draw(Adafruit_SSD1306& display) {
+        if (chart_open) {
+            draw_chart(display);
+            return;
+        }
         display.clearDisplay();
         menu::draw_generic_titlebar(display, "Temperature");
         uint16_t selector_offset;
@@ -42,74 +216,83 @@ namespace apps::temperature {
         display.println("INTERNAL");
         display.setCursor(SCREEN_WIDTH - 8 - 8*6, 8);
         display.println("EXTERNAL");
+        size_t sensor_count = thermometer::sensor_count();
+        if (temperature_mode == TemperatureMode::EXTERNAL_TMP && sensor_count > 1) {
+            display.setTextColor(SSD1306_WHITE);
+            display.setCursor(24, 56);
+            display.printf("Sensor %u/%u", static_cast<unsigned>(selected_sensor + 1), static_cast<unsigned>(sensor_count));
+        }
         display.setTextSize(2);
         display.setCursor(24, 32);
-        auto tmp = (temperature_mode == TemperatureMode::INTERNAL_TMP) ? last_internal_temperature : last_external_temperature;
+        auto tmp = get_reading().celsius;
         if (isnan(tmp)) {
             display.println("N/A");
         } else {
             display.print(tmp, 1);
             display.println(" C");
         }
-        display.display();
-    }
-
-    float read_external_temperature_sensor() {
-        if (!sensors_initialized) {
-            sensors.begin();
-            sensors.setWaitForConversion(false);
-            sensors_initialized = true;
-        }
-        sensors.requestTemperatures();
-        if (sensors.isConversionComplete()) {
-            return sensors.getTempCByIndex(0);
-        } else {
-            return NAN;
-        }
+        framebuffer::flush(display);
     }
 
     void update_temperatures() {
-        float new_tmp;
-        switch (temperature_mode) {
-            case TemperatureMode::INTERNAL_TMP:
-                if (isnan(last_internal_temperature) || last_update_time_us + update_interval_us <= timekeeper::now_us()) {
-                    new_tmp = temperatureRead();
-                    if (!isnan(new_tmp) && new_tmp != last_internal_temperature) {
-                        last_internal_temperature = new_tmp;
-                        last_update_time_us = timekeeper::now_us();
-                        menu::set_dirty();
-                    }
-                }
-                break;
-            case TemperatureMode::EXTERNAL_TMP:
-                if (isnan(last_external_temperature) || last_update_time_us + update_interval_us <= timekeeper::now_us()) {
-                    new_tmp = read_external_temperature_sensor();
-                    if (!isnan(new_tmp) && new_tmp != last_external_temperature) {
-                        last_external_temperature = new_tmp;
-                        last_update_time_us = timekeeper::now_us();
-                        menu::set_dirty();
-                    }
-                }
-                break;
+        thermometer::Reading reading = get_reading();
+        if (reading.timestamp_us != last_reading_time_us) {
+            last_reading_time_us = reading.timestamp_us;
+            menu::set_dirty();
+        }
+        if (reading.timestamp_us == 0) {
+            menu::wake_up_in(retry_interval_us); // No reading yet
+        } else {
+            // A little after the next reading is expected, the conversion takes up to 750ms
+            menu::wake_up_at(MAX(reading.timestamp_us + sample_interval_us, timekeeper::now_us() + retry_interval_us));
         }
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
+        if (chart_open) {
+            chart_app(ev);
+            if (ev.type == events::EventType::NONE) {
+                menu::upkeep(display);
+            }
+            return;
+        }
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
+                    case events::Button::A:
+                        sound::play_navigation_tone();
+                        chart_open = true;
+                        chart_channel = temperature_mode == TemperatureMode::INTERNAL_TMP ?
+                            history::Channel::INTERNAL_TEMPERATURE : history::Channel::EXTERNAL_TEMPERATURE;
+                        pan_s = 0;
+                        menu::set_dirty();
+                        break;
                     case events::Button::LEFT:
                     case events::Button::RIGHT:
-                    case events::Button::A:
                         sound::play_navigation_tone();
                         if (temperature_mode == TemperatureMode::INTERNAL_TMP) {
                             temperature_mode = TemperatureMode::EXTERNAL_TMP;
                         } else {
                             temperature_mode = TemperatureMode::INTERNAL_TMP;
                         }
+                        last_reading_time_us = 0;
                         menu::set_dirty();
                         break;
+                    case events::Button::UP:
+                    case events::Button::DOWN:
+                        if (temperature_mode == TemperatureMode::EXTERNAL_TMP && thermometer::sensor_count() > 1) {
+                            sound::play_navigation_tone();
+                            size_t count = thermometer::sensor_count();
+                            if (ev.button_press_event.button == events::Button::DOWN) {
+                                selected_sensor = (selected_sensor + 1) % count;
+                            } else {
+                                selected_sensor = (selected_sensor + count - 1) % count;
+                            }
+                            last_reading_time_us = 0;
+                            menu::set_dirty();
+                        }
+                        break;
                     case events::Button::B:
                         menu::current_app = menu::App::NONE;
                         sound::play_cancel_tone();
@@ -1,6 +1,8 @@
 #include "apps/timer.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
+#include "core/text.hpp"
 #include "core/sound.hpp"
 #include "core/timekeeper.hpp"
 #include "constants.hpp"
@@ -40,7 +42,7 @@ namespace apps::timer {
     TimerField timer_field = TimerField::MINUTES;
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (timer_state) {
@@ -196,14 +198,21 @@ namespace apps::timer {
                         timer_state = TimerState::FINISHED;
                         sound::async_play_interruptible_melody(alert_melody, sizeof(alert_melody) / sizeof(alert_melody[0]), true);
                         menu::set_dirty();
-                    } else if (last_update_time_us + ONE_SECOND_US <= now) {
+                    } else {
+                        if (last_update_time_us + ONE_SECOND_US <= now) {
+                            last_update_time_us = now;
+                            menu::set_dirty(); // Continuously update while running
+                        }
+                        menu::wake_up_at(MIN(start_time_us + remaining_time_us, last_update_time_us + ONE_SECOND_US));
+                    }
+                }
+                if (timer_state == TimerState::FINISHED) {
+                    if (last_update_time_us + ONE_SECOND_US <= now) {
                         last_update_time_us = now;
-                        menu::set_dirty(); // Continuously update while running
+                        menu::set_dirty(); // Continuously update while finished
                     }
-                } else if (timer_state == TimerState::FINISHED && last_update_time_us + ONE_SECOND_US <= now) {
-                    last_update_time_us = now;
-                    menu::set_dirty(); // Continuously update while finished
-                }   
+                    menu::wake_up_at(last_update_time_us + ONE_SECOND_US);
+                }
                 menu::upkeep(display);
                 break;
             }
@@ -239,43 +248,38 @@ namespace apps::timer {
         uint64_t minutes = total_seconds / 60;
         uint64_t seconds = total_seconds % 60;
 
-        display.setTextSize(2);
-        display.setTextColor(SSD1306_INVERSE);
-        
         display.fillRect(0, 18, background_fill_width, 18, SSD1306_WHITE);
         
-        display.setCursor(30, 20);
         if (timer_field == TimerField::MINUTES && timer_state == TimerState::EDITING) {
             display.fillRect(28, 18, 26, 18, SSD1306_WHITE);
         }
-        display.printf("%02llu", minutes);
-        display.print(':');
+        int16_t x = text::printf(display, 30, 20, 2, SSD1306_INVERSE, "%02llu", minutes);
+        x = text::print(display, x, 20, ":", 2, SSD1306_INVERSE);
         if (timer_field == TimerField::SECONDS && timer_state == TimerState::EDITING) {
             display.fillRect(64, 18, 26, 18, SSD1306_WHITE);
         }
-        display.printf("%02llu", seconds);
-        display.setTextColor(SSD1306_WHITE);
+        text::printf(display, x, 20, 2, SSD1306_INVERSE, "%02llu", seconds);
 
-        display.setTextSize(1);
-        display.setCursor(10, 50);
+        const char* hint = "";
         switch (timer_state) {
             case TimerState::IDLE:
-                display.println("Start: A, Edit: +");
+                hint = "Start: A, Edit: +";
                 break;
             case TimerState::EDITING:
-                display.println("Edit: +, Save: A/B");
+                hint = "Edit: +, Save: A/B";
                 break;
             case TimerState::RUNNING:
-                display.println("Pause: A, Reset: B");
+                hint = "Pause: A, Reset: B";
                 break;
             case TimerState::PAUSED:
-                display.println("Resume: A, Reset: B");
+                hint = "Resume: A, Reset: B";
                 break;
             case TimerState::FINISHED:
-                display.println("Reset: A/B");
+                hint = "Reset: A/B";
                 break;
         }
+        text::print(display, 10, 50, hint);
 
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
@@ -1,12 +1,17 @@
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <Preferences.h>
+#include <algorithm>
 
 #include "apps/weather.hpp"
 #include "core/events.hpp"
 #include "core/menu.hpp"
+#include "core/framebuffer.hpp"
 #include "core/sound.hpp"
 #include "core/logger.hpp"
+#include "core/timekeeper.hpp"
+#include "core/network.hpp"
 #include "apps/settings.hpp"
 #include "certs/isrg_root_x1.hpp"
 #include "constants.hpp"
@@ -22,159 +27,318 @@
 #include "images/weather_unknown.hpp"
 
 namespace apps::weather {
-    TaskHandle_t weather_update_task_handle = nullptr;
     SemaphoreHandle_t weather_data_mutex = nullptr;
-    float latest_temperature = NAN;
-    WeatherCode latest_weather_code = WeatherCode::UNKNOWN;
-    String latest_location = "Unknown";
-    
-    float latest_temperature_local = NAN;
-    WeatherCode latest_weather_code_local = WeatherCode::UNKNOWN;
-    String latest_location_local = "Unknown";
 
-    enum class WeatherTaskCommand {
-        PAUSE = 1 << 0,
-        RESUME = 1 << 1,
+    constexpr size_t forecast_hours = 48;
+    constexpr int8_t NO_TEMPERATURE = INT8_MIN;
+    constexpr uint8_t NO_WEATHER_CODE = UINT8_MAX;
+
+    // One hour of forecast, packed so the forecasts of all the locations fit in RTC memory
+    struct ForecastHour {
+        int8_t temperature; // Rounded to the degree, NO_TEMPERATURE if missing
+        uint8_t weather_code; // WeatherCode, NO_WEATHER_CODE if missing
+    };
+
+    // Hourly forecast of a settings location
+    struct Forecast {
+        uint32_t location_hash; // Of the settings entry it was fetched for
+        uint32_t start_s; // Unix time of hours[0], 0 if there is no forecast
+        uint32_t fetched_s; // Unix time of the download
+        char name[48];
+        ForecastHour hours[forecast_hours];
+    };
+
+    // Indexed like settings.locations and written by the update task under weather_data_mutex. In RTC memory, so
+    // the app has something to show right after deep sleep, before or without any network access.
+    RTC_DATA_ATTR Forecast forecasts[MAX_WEATHER_LOCATIONS];
+    uint32_t forecast_revision = 1;
+
+    // Copy the app pages through, one entry per non-empty settings location
+    Forecast local_forecasts[MAX_WEATHER_LOCATIONS];
+    size_t local_count = 0;
+    uint32_t local_revision = 0;
+    time_t shown_hour = 0;
+    size_t page = 0;
+
+    uint32_t location_hash(const String& location) {
+        uint32_t hash = 2166136261u; // FNV-1a
+        for (size_t i = 0; i < location.length(); ++i) {
+            hash = (hash ^ static_cast<uint8_t>(location[i])) * 16777619u;
+        }
+        return hash;
+    }
+
+    constexpr uint32_t forecast_refresh_interval_s = 3 * 3600; // Age at which a forecast is downloaded again
+
+    constexpr const char* geocode_cache_namespace = "geocode";
+
+    // Coordinates of a settings location, cached in NVS per entry since the locations seldom change
+    struct Geocode {
+        String location; // The query they were looked up for, empty if none
+        float latitude = NAN;
+        float longitude = NAN;
+        String display_name;
     };
 
-    constexpr uint64_t weather_update_interval_on_failure_ms = 10 * 1000; // Retry every 10 seconds on failure
-    constexpr uint64_t weather_update_interval_ms = 10 * 60 * 1000; // Update every 10 minutes
+    struct GeocodeKeys {
+        char location[8];
+        char latitude[8];
+        char longitude[8];
+        char name[8];
+    };
+
+    GeocodeKeys geocode_keys(size_t index) {
+        GeocodeKeys keys;
+        snprintf(keys.location, sizeof(keys.location), "loc%u", static_cast<unsigned>(index));
+        snprintf(keys.latitude, sizeof(keys.latitude), "lat%u", static_cast<unsigned>(index));
+        snprintf(keys.longitude, sizeof(keys.longitude), "lon%u", static_cast<unsigned>(index));
+        snprintf(keys.name, sizeof(keys.name), "name%u", static_cast<unsigned>(index));
+        return keys;
+    }
+
+    bool load_cached_geocode(size_t index, const String& location, Geocode& geocode) {
+        Preferences prefs;
+        if (!prefs.begin(geocode_cache_namespace, true)) {
+            return false;
+        }
+        GeocodeKeys keys = geocode_keys(index);
+        bool found = prefs.getString(keys.location) == location;
+        if (found) {
+            geocode.location = location;
+            geocode.latitude = prefs.getFloat(keys.latitude);
+            geocode.longitude = prefs.getFloat(keys.longitude);
+            geocode.display_name = prefs.getString(keys.name);
+            found = !isnan(geocode.latitude) && !isnan(geocode.longitude);
+        }
+        prefs.end();
+        return found;
+    }
+
+    void store_cached_geocode(size_t index, const Geocode& geocode) {
+        Preferences prefs;
+        if (!prefs.begin(geocode_cache_namespace, false)) {
+            LOG_ERROR("Failed to open the geocoding cache for writing.");
+            return;
+        }
+        GeocodeKeys keys = geocode_keys(index);
+        prefs.putString(keys.location, geocode.location);
+        prefs.putFloat(keys.latitude, geocode.latitude);
+        prefs.putFloat(keys.longitude, geocode.longitude);
+        prefs.putString(keys.name, geocode.display_name);
+        prefs.end();
+    }
+
+    // Keeps lat, lon and display_name of the Nominatim results, an array even with limit=1
+    void geocode_filter(JsonDocument& filter) {
+        filter[0]["lat"] = true;
+        filter[0]["lon"] = true;
+        filter[0]["display_name"] = true;
+    }
+
+    // Keeps the hourly forecast of an open-meteo response. A single location is answered with an object and more
+    // than one with an array, a filter of the other shape drops the whole response.
+    void forecast_filter(JsonDocument& filter, size_t count) {
+        if (count > 1) {
+            // The first element of an array filter applies to all of them
+            filter[0]["hourly"] = true;
+        } else {
+            filter["hourly"] = true;
+        }
+    }
 
-    void update_weather_task(void* param) {
-        constexpr const char* weather_api_url = "https://api.open-meteo.com/v1/forecast?latitude=%f&longitude=%f&current_weather=true";
+    bool fetch_geocode(HTTPClient& https, WiFiClientSecure& client, const String& location, Geocode& geocode) {
         constexpr const char* geo_api_url = "https://nominatim.openstreetmap.org/search?q=%s&format=json&limit=1";
         char url_buffer[256];
-        float latitude = 0.0f;
-        float longitude = 0.0f;
-        WiFiClientSecure client;
-        client.setCACert(certs::ISRG_ROOT_X1_CA);
-        HTTPClient https;
-        bool at_least_one_success = false;
-        while (true) {
-            uint32_t notification_value = 0;
-            if (xTaskNotifyWait(0, UINT32_MAX, &notification_value, 0) == pdTRUE) {
-                if (notification_value & static_cast<uint32_t>(WeatherTaskCommand::PAUSE)) {
-                    // Wait indefinitely until resumed
-                    xTaskNotifyWait(0, UINT32_MAX, &notification_value, portMAX_DELAY);
-                    if (notification_value & static_cast<uint32_t>(WeatherTaskCommand::RESUME)) {
-                        // Resumed, continue
-                        continue;
-                    }
-                }
-            }
-            if (!WiFi.isConnected()) {
-                vTaskDelay(pdMS_TO_TICKS(weather_update_interval_on_failure_ms));
-                continue;
-            }
-
-            bool location_success = false;
-            auto settings = apps::settings::get_settings();
-            snprintf(url_buffer, sizeof(url_buffer) - 1, geo_api_url, settings.location.c_str());
-            url_buffer[sizeof(url_buffer) - 1] = '\0';
-            https.begin(client, url_buffer);
-            int geo_http_code = https.GET();
-            if (geo_http_code > 0) {
-                if (geo_http_code == HTTP_CODE_OK) {
-                    String geo_payload = https.getString();
-                    JsonDocument geo_doc;
-                    DeserializationError geo_error = deserializeJson(geo_doc, geo_payload);
-                    if (!geo_error) {
-                        if (geo_doc.is<JsonArray>() && geo_doc.size() > 0) {
-                            latitude = geo_doc[0]["lat"];
-                            longitude = geo_doc[0]["lon"];
-                            String location_name = geo_doc[0]["display_name"].as<String>();
-                            if (xSemaphoreTake(weather_data_mutex, pdMS_TO_TICKS(portMAX_DELAY))) {
-                                latest_location = location_name;
-                                xSemaphoreGive(weather_data_mutex);
-                            }
-                            location_success = true;
-                        } else {
-                            logger::error("Failed to get geocoding data: unexpected JSON structure");
-                        }
+        snprintf(url_buffer, sizeof(url_buffer) - 1, geo_api_url, location.c_str());
+        url_buffer[sizeof(url_buffer) - 1] = '\0';
+        bool success = false;
+        https.begin(client, url_buffer);
+        int geo_http_code = https.GET();
+        if (geo_http_code > 0) {
+            if (geo_http_code == HTTP_CODE_OK) {
+                // Parsed straight from the connection, keeping only the fields used
+                JsonDocument geo_filter;
+                geocode_filter(geo_filter);
+                JsonDocument geo_doc;
+                DeserializationError geo_error = deserializeJson(geo_doc, https.getStream(), DeserializationOption::Filter(geo_filter));
+                if (!geo_error) {
+                    if (geo_doc.is<JsonArray>() && geo_doc.size() > 0) {
+                        geocode.location = location;
+                        geocode.latitude = geo_doc[0]["lat"];
+                        geocode.longitude = geo_doc[0]["lon"];
+                        geocode.display_name = geo_doc[0]["display_name"].as<String>();
+                        success = true;
                     } else {
-                        logger::error("Failed to parse geocoding JSON: %s", geo_error.c_str());
+                        LOG_ERROR("Failed to get geocoding data: unexpected JSON structure");
                     }
                 } else {
-                    logger::error("Unexpected HTTP code from geocoding API: %d", geo_http_code);
+                    LOG_ERROR("Failed to parse geocoding JSON: %s", geo_error.c_str());
                 }
             } else {
-                logger::error("Failed to connect to geocoding API: %s", https.errorToString(geo_http_code).c_str());
-            }
-            https.end();
-            if (!location_success) {
-                vTaskDelay(pdMS_TO_TICKS(weather_update_interval_on_failure_ms));
-                continue;
+                LOG_ERROR("Unexpected HTTP code from geocoding API: %d", geo_http_code);
             }
+        } else {
+            LOG_ERROR("Failed to connect to geocoding API: %s", https.errorToString(geo_http_code).c_str());
+        }
+        https.end();
+        return success;
+    }
 
-            snprintf(url_buffer, sizeof(url_buffer) - 1, weather_api_url, latitude, longitude);
-            url_buffer[sizeof(url_buffer) - 1] = '\0';
-
-            https.begin(client, url_buffer);
-            int httpCode = https.GET();
-            if (httpCode > 0) {
-                if (httpCode == HTTP_CODE_OK) {
-                    String payload = https.getString();
-                    JsonDocument doc;
-                    DeserializationError error = deserializeJson(doc, payload);
-                    if (!error) {
-                        float temperature = doc["current_weather"]["temperature"] | NAN;
-                        int weather_code_int = doc["current_weather"]["weathercode"] | -1;
-                        WeatherCode weather_code = WeatherCode::UNKNOWN;
-                        if (weather_code_int >= 0 && weather_code_int <= 99) {
-                            weather_code = static_cast<WeatherCode>(weather_code_int);
-                        }
-                        if (xSemaphoreTake(weather_data_mutex, pdMS_TO_TICKS(portMAX_DELAY))) {
-                            latest_temperature = temperature;
-                            latest_weather_code = weather_code;
-                            xSemaphoreGive(weather_data_mutex);
-                            at_least_one_success = true;
+    // One open-meteo request for the hourly forecast of all the locations, it takes comma separated coordinates and
+    // answers with an array
+    bool fetch_forecasts(HTTPClient& https, WiFiClientSecure& client, const Geocode* geocodes, const size_t* indices, size_t count, Forecast* fetched) {
+        char latitudes[MAX_WEATHER_LOCATIONS * 12] = "";
+        char longitudes[MAX_WEATHER_LOCATIONS * 12] = "";
+        for (size_t i = 0; i < count; ++i) {
+            const Geocode& geocode = geocodes[indices[i]];
+            size_t length = strlen(latitudes);
+            snprintf(latitudes + length, sizeof(latitudes) - length, "%s%.4f", i > 0 ? "," : "", geocode.latitude);
+            length = strlen(longitudes);
+            snprintf(longitudes + length, sizeof(longitudes) - length, "%s%.4f", i > 0 ? "," : "", geocode.longitude);
+        }
+        constexpr const char* weather_api_url = "https://api.open-meteo.com/v1/forecast?latitude=%s&longitude=%s&hourly=temperature_2m,weather_code&forecast_hours=%u&timeformat=unixtime";
+        char url_buffer[256];
+        snprintf(url_buffer, sizeof(url_buffer) - 1, weather_api_url, latitudes, longitudes, static_cast<unsigned>(forecast_hours));
+        url_buffer[sizeof(url_buffer) - 1] = '\0';
+        bool success = false;
+        https.begin(client, url_buffer);
+        int httpCode = https.GET();
+        if (httpCode > 0) {
+            if (httpCode == HTTP_CODE_OK) {
+                JsonDocument filter;
+                forecast_filter(filter, count);
+                JsonDocument doc;
+                DeserializationError error = deserializeJson(doc, https.getStream(), DeserializationOption::Filter(filter));
+                if (!error) {
+                    JsonVariantConst root = doc.as<JsonVariantConst>();
+                    success = true;
+                    for (size_t i = 0; i < count; ++i) {
+                        JsonVariantConst hourly = (count > 1 ? root[i] : root)["hourly"];
+                        Forecast& forecast = fetched[i];
+                        forecast.start_s = hourly["time"][0].as<uint32_t>();
+                        for (size_t hour = 0; hour < forecast_hours; ++hour) {
+                            float temperature = hourly["temperature_2m"][hour] | NAN;
+                            int weather_code = hourly["weather_code"][hour] | -1;
+                            forecast.hours[hour].temperature = isnan(temperature) ? NO_TEMPERATURE : static_cast<int8_t>(std::min(std::max(lroundf(temperature), -127L), 127L));
+                            forecast.hours[hour].weather_code = weather_code >= 0 && weather_code <= 99 ? weather_code : NO_WEATHER_CODE;
                         }
-                    } else {
-                        logger::error("Failed to parse weather JSON: %s", error.c_str());
+                        success &= forecast.start_s != 0;
+                    }
+                    if (!success) {
+                        LOG_ERROR("Failed to get forecast data: unexpected JSON structure");
                     }
                 } else {
-                    logger::error("Unexpected HTTP code from weather API: %d", httpCode);
+                    LOG_ERROR("Failed to parse weather JSON: %s", error.c_str());
                 }
             } else {
-                logger::error("Failed to connect to weather API: %s", https.errorToString(httpCode).c_str());
-            }
-            https.end();
-            if (!at_least_one_success) {
-                vTaskDelay(pdMS_TO_TICKS(weather_update_interval_on_failure_ms));
-            } else {
-                vTaskDelay(pdMS_TO_TICKS(weather_update_interval_ms));
+                LOG_ERROR("Unexpected HTTP code from weather API: %d", httpCode);
             }
+        } else {
+            LOG_ERROR("Failed to connect to weather API: %s", https.errorToString(httpCode).c_str());
         }
+        https.end();
+        return success;
     }
 
-    void pause_weather_task() {
-        if (weather_update_task_handle != nullptr) {
-            xTaskNotify(weather_update_task_handle, static_cast<uint32_t>(WeatherTaskCommand::PAUSE), eSetValueWithOverwrite);
+    // Time until a non-empty location has no forecast, one for another location or one older than the refresh
+    // interval. The forecast is indexed by the clock, so nothing is due before the time is set.
+    uint64_t forecast_due_in_ms() {
+        time_t now = timekeeper::rtc_s();
+        if (now == 0) {
+            return UINT64_MAX;
         }
+        auto settings = apps::settings::get_settings();
+        uint64_t due_in_s = UINT64_MAX;
+        if (xSemaphoreTake(weather_data_mutex, portMAX_DELAY)) {
+            for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+                const String& location = settings.locations[i];
+                const Forecast& forecast = forecasts[i];
+                if (location.length() == 0) {
+                    continue;
+                }
+                if (forecast.start_s == 0 || forecast.location_hash != location_hash(location)) {
+                    due_in_s = 0;
+                } else {
+                    time_t refresh_s = static_cast<time_t>(forecast.fetched_s) + forecast_refresh_interval_s;
+                    due_in_s = std::min<uint64_t>(due_in_s, refresh_s > now ? refresh_s - now : 0);
+                }
+            }
+            xSemaphoreGive(weather_data_mutex);
+        }
+        return due_in_s == UINT64_MAX ? UINT64_MAX : due_in_s * 1000;
     }
 
-    void resume_weather_task() {
-        if (weather_update_task_handle != nullptr) {
-            xTaskNotify(weather_update_task_handle, static_cast<uint32_t>(WeatherTaskCommand::RESUME), eSetValueWithOverwrite);
+    // Network job, downloads the forecasts of all the locations in a radio-on window of core/network.hpp
+    bool refresh_forecasts() {
+        time_t now = timekeeper::rtc_s();
+        if (now == 0) {
+            return false;
+        }
+        auto settings = apps::settings::get_settings();
+        WiFiClientSecure client;
+        client.setCACert(certs::ISRG_ROOT_X1_CA);
+        HTTPClient https;
+        // The responses are parsed from the stream, HTTP/1.0 keeps them from being chunked. It also closes the
+        // connection after each response, a refresh makes a single request to each host anyway.
+        https.useHTTP10(true);
+
+        // Nominatim is only asked for the locations not in the NVS cache. It is read on every refresh, which is
+        // what a refresh after a reboot does too, instead of keeping a copy in RAM between the refreshes.
+        Geocode geocodes[MAX_WEATHER_LOCATIONS];
+        size_t located[MAX_WEATHER_LOCATIONS]; // Indices of the locations with coordinates
+        size_t located_count = 0;
+        bool all_located = true;
+        for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+            const String& location = settings.locations[i];
+            if (location.length() == 0) {
+                continue;
+            }
+            Geocode& geocode = geocodes[i];
+            bool location_success = load_cached_geocode(i, location, geocode);
+            if (!location_success) {
+                location_success = fetch_geocode(https, client, location, geocode);
+                if (location_success) {
+                    store_cached_geocode(i, geocode);
+                }
+            }
+            if (location_success) {
+                located[located_count++] = i;
+            }
+            all_located &= location_success;
         }
+
+        bool weather_success = false;
+        if (located_count > 0) {
+            Forecast fetched[MAX_WEATHER_LOCATIONS] = {};
+            weather_success = fetch_forecasts(https, client, geocodes, located, located_count, fetched);
+            if (weather_success && xSemaphoreTake(weather_data_mutex, pdMS_TO_TICKS(portMAX_DELAY))) {
+                for (size_t i = 0; i < located_count; ++i) {
+                    size_t index = located[i];
+                    Forecast& forecast = forecasts[index];
+                    forecast = fetched[i];
+                    forecast.location_hash = location_hash(settings.locations[index]);
+                    forecast.fetched_s = static_cast<uint32_t>(now);
+                    strncpy(forecast.name, geocodes[index].display_name.c_str(), sizeof(forecast.name) - 1);
+                    forecast.name[sizeof(forecast.name) - 1] = '\0';
+                }
+                forecast_revision++;
+                xSemaphoreGive(weather_data_mutex);
+                menu::set_dirty(); // Wake up the app so it picks up the new data
+            }
+        }
+        // A location that could not be geocoded makes the job fail, so it is tried again with backoff
+        return weather_success && all_located;
     }
 
-    void try_start_weather_task() {
-        if (weather_update_task_handle == nullptr) {
+    void try_add_weather_job() {
+        if (weather_data_mutex == nullptr) {
             weather_data_mutex = xSemaphoreCreateMutex();
-            xTaskCreate(
-                update_weather_task,
-                "WeatherUpdateTask",
-                8192,
-                nullptr,
-                1,
-                &weather_update_task_handle
-            );
+            network::add_job({"Weather", forecast_due_in_ms, refresh_forecasts});
         }
     }
 
     void app(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = menu::wait_for_event();
         switch (ev.type) {
             case events::EventType::BUTTON_PRESS:
                 switch (ev.button_press_event.button) {
@@ -183,21 +347,68 @@ namespace apps::weather {
                         menu::current_app = menu::App::NONE;
                         menu::set_dirty();
                         break;
+                    // Paging only shows the cached copy, it never triggers a request
+                    case events::Button::UP:
+                        if (local_count > 1) {
+                            sound::play_navigation_tone();
+                            page = (page + local_count - 1) % local_count;
+                            menu::set_dirty();
+                        }
+                        break;
+                    case events::Button::DOWN:
+                        if (local_count > 1) {
+                            sound::play_navigation_tone();
+                            page = (page + 1) % local_count;
+                            menu::set_dirty();
+                        }
+                        break;
+                    default:
+                        break;
                 }
                 break;
             case events::EventType::NONE:
-                try_start_weather_task();
+                try_add_weather_job();
                 if (weather_data_mutex != nullptr && xSemaphoreTake(weather_data_mutex, 0) == pdTRUE) {
-                    if ((!isnan(latest_temperature) && latest_temperature != latest_temperature_local) || (latest_weather_code != latest_weather_code_local)) {
-                        latest_temperature_local = latest_temperature;
-                        latest_weather_code_local = latest_weather_code;
-                        latest_location_local = latest_location;
+                    if (forecast_revision != local_revision) {
+                        // A forecast of a location that has since been changed in the settings is not shown
+                        auto settings = apps::settings::get_settings();
+                        local_count = 0;
+                        for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+                            const String& location = settings.locations[i];
+                            if (location.length() == 0) {
+                                continue;
+                            }
+                            Forecast& forecast = local_forecasts[local_count++];
+                            if (forecasts[i].start_s != 0 && forecasts[i].location_hash == location_hash(location)) {
+                                forecast = forecasts[i];
+                            } else {
+                                forecast = Forecast{};
+                                strncpy(forecast.name, location.c_str(), sizeof(forecast.name) - 1);
+                            }
+                        }
+                        local_revision = forecast_revision;
+                        if (page >= local_count) {
+                            page = 0;
+                        }
                         menu::set_dirty();
                     }
                     xSemaphoreGive(weather_data_mutex);
                 }
+                {
+                    // The shown hour and the age of the forecast move with the clock, redraw on each hour
+                    time_t now = timekeeper::rtc_s();
+                    if (now != 0) {
+                        if (now / 3600 != shown_hour) {
+                            shown_hour = now / 3600;
+                            menu::set_dirty();
+                        }
+                        menu::wake_up_in(static_cast<uint64_t>(3600 - now % 3600) * 1000000ULL);
+                    }
+                }
                 menu::upkeep(display);
                 break;
+            default:
+                break;
         }
     }
 
@@ -241,9 +452,25 @@ namespace apps::weather {
 
     void draw(Adafruit_SSD1306& display) {
         display.clearDisplay();
-        menu::draw_generic_titlebar(display, "Weather");
+        time_t now = timekeeper::rtc_s();
+        const Forecast* shown = page < local_count ? &local_forecasts[page] : nullptr;
+        // Unknown until the first update, or once the clock has gone past the forecast
+        ForecastHour hour = {NO_TEMPERATURE, NO_WEATHER_CODE};
+        if (shown != nullptr && shown->start_s != 0 && now >= shown->start_s) {
+            size_t index = (now - shown->start_s) / 3600;
+            if (index < forecast_hours) {
+                hour = shown->hours[index];
+            }
+        }
+        if (local_count > 1) {
+            char title[16];
+            snprintf(title, sizeof(title), "Weather %u/%u", static_cast<unsigned>(page + 1), static_cast<unsigned>(local_count));
+            menu::draw_generic_titlebar(display, title);
+        } else {
+            menu::draw_generic_titlebar(display, "Weather");
+        }
         const uint8_t* weather_icon = nullptr;
-        WeatherCondition condition = condition_from_weather_code(latest_weather_code_local);
+        WeatherCondition condition = hour.weather_code == NO_WEATHER_CODE ? WeatherCondition::UNKNOWN : condition_from_weather_code(static_cast<WeatherCode>(hour.weather_code));
         switch (condition) {
             case WeatherCondition::CLEAR:
                 weather_icon = images::weather_clear;
@@ -279,18 +506,28 @@ namespace apps::weather {
         display.drawBitmap(16, 8, weather_icon, images::weather_clear_width, images::weather_clear_height, SSD1306_WHITE);
         display.setTextSize(2);
         display.setTextColor(SSD1306_WHITE);
-        if (!isnan(latest_temperature_local)) {    
+        if (hour.temperature != NO_TEMPERATURE) {
             display.setCursor(48, 20);
-            display.printf("%.1fC", latest_temperature_local);
+            display.printf("%dC", hour.temperature);
         } else {
             display.setCursor(48, 20);
             display.print("N/A");
         }
         display.setTextSize(1);
+        // Staleness of the cached forecast, shown once it is at least an hour old
+        if (shown != nullptr && shown->start_s != 0 && now >= shown->fetched_s + 3600) {
+            display.setCursor(48, 10);
+            uint32_t age_h = (now - shown->fetched_s) / 3600;
+            if (age_h < 48) {
+                display.printf("%uh ago", static_cast<unsigned>(age_h));
+            } else {
+                display.printf("%ud ago", static_cast<unsigned>(age_h / 24));
+            }
+        }
         display.setCursor(0, 40);
-        auto lines = latest_location_local;
+        String lines = shown != nullptr ? shown->name : "Unknown";
         lines.replace(", ", "\n");
         display.print(lines);
-        display.display();
+        framebuffer::flush(display);
     }
 }
\ No newline at end of file
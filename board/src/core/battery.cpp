@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include "core/battery.hpp"
+#include "core/menu.hpp"
 #include "constants.hpp"
 
 namespace battery {    
@@ -28,6 +29,19 @@ namespace battery {
             level = BatteryLevel::BATTERY_CHARGING;
         }
         uint8_t voltage_dv = static_cast<uint8_t>(voltage * 10); // Convert voltage to decivolts
-        return BatteryStatus{level, voltage_dv};
+        uint16_t voltage_mv = static_cast<uint16_t>(voltage * 1000);
+        return BatteryStatus{level, voltage_dv, voltage_mv};
+    }
+
+    // The level can only be sampled, but only changes are pushed to the title bar
+    void battery_task(void* param) {
+        while (true) {
+            menu::set_battery_level(get_battery_status().level);
+            vTaskDelay(pdMS_TO_TICKS(BATTERY_CHECK_INTERVAL_MS));
+        }
+    }
+
+    void init() {
+        xTaskCreate(battery_task, "BatteryTask", 2048, nullptr, 1, nullptr);
     }
 }
\ No newline at end of file
@@ -13,7 +13,11 @@ namespace battery {
     struct BatteryStatus {
         BatteryLevel level;
         uint8_t voltage_dv; // battery voltage in decivolts
+        uint16_t voltage_mv; // battery voltage in millivolts
     };
 
     BatteryStatus get_battery_status();
+
+    // Starts the task that reports the battery level to the title bar, call after menu::init()
+    void init();
 }
\ No newline at end of file
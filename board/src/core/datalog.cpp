@@ -0,0 +1,249 @@
+#include <math.h>
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+
+#include "core/datalog.hpp"
+#include "core/battery.hpp"
+#include "core/history.hpp"
+#include "core/logger.hpp"
+#include "core/thermometer.hpp"
+#include "core/timekeeper.hpp"
+#include "constants.hpp"
+
+namespace datalog {
+    constexpr uint8_t DATALOG_PARTITION_SUBTYPE = 0x41; // See partitions.csv
+    constexpr uint32_t SECTOR_SIZE = SPI_FLASH_SEC_SIZE;
+    constexpr uint32_t RECORDS_PER_SECTOR = SECTOR_SIZE / sizeof(Record);
+    constexpr uint32_t ERASED_SEQUENCE = 0xFFFFFFFF;
+
+    const esp_partition_t* partition = nullptr;
+    uint32_t sector_count = 0;
+    SemaphoreHandle_t log_mutex = nullptr;
+
+    // Record n is in slot n % RECORDS_PER_SECTOR of sector (n / RECORDS_PER_SECTOR) % sector_count, so the position
+    // of the next record is all the state there is
+    uint32_t next_sequence = 0; // Of the next record written to flash
+
+    // The batch and the schedule survive deep sleep, so the watch can wake up on a timer for a sample and go back to
+    // sleep, writing to flash only once the batch is full. timekeeper::now_us() keeps counting through deep sleep.
+    RTC_DATA_ATTR Record batch[DATALOG_BATCH_RECORDS];
+    RTC_DATA_ATTR uint32_t batch_size;
+    RTC_DATA_ATTR uint64_t next_sample_us; // timekeeper::now_us() of the next sample, 0 on the first boot
+
+    uint16_t record_crc(const Record& record) {
+        return esp_rom_crc16_le(0, reinterpret_cast<const uint8_t*>(&record), offsetof(Record, crc));
+    }
+
+    bool is_valid(const Record& record, uint32_t sequence) {
+        return record.sequence == sequence && record.crc == record_crc(record);
+    }
+
+    size_t record_offset(uint32_t sequence) {
+        return ((sequence / RECORDS_PER_SECTOR) % sector_count) * SECTOR_SIZE + (sequence % RECORDS_PER_SECTOR) * sizeof(Record);
+    }
+
+    Range get_range_locked() {
+        uint32_t end = next_sequence + batch_size;
+        // The sector being filled and all the full ones but the one that will be erased next
+        uint32_t kept = (sector_count - 1) * RECORDS_PER_SECTOR + next_sequence % RECORDS_PER_SECTOR;
+        return Range{next_sequence > kept ? next_sequence - kept : 0, end};
+    }
+
+    Range get_range() {
+        if (partition == nullptr) {
+            return Range{0, 0};
+        }
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        Range range = get_range_locked();
+        xSemaphoreGive(log_mutex);
+        return range;
+    }
+
+    bool get_record(uint32_t sequence, Record& record) {
+        if (partition == nullptr) {
+            return false;
+        }
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        Range range = get_range_locked();
+        bool found = false;
+        if (sequence >= range.first && sequence < range.end) {
+            if (sequence >= next_sequence) {
+                record = batch[sequence - next_sequence];
+                found = true;
+            } else {
+                found = esp_partition_read(partition, record_offset(sequence), &record, sizeof(record)) == ESP_OK && is_valid(record, sequence);
+            }
+        }
+        xSemaphoreGive(log_mutex);
+        return found;
+    }
+
+    // Writes the batch with one flash write per sector touched, erasing a sector when the log enters it
+    void write_batch_locked() {
+        uint32_t written = 0;
+        while (written < batch_size) {
+            uint32_t sequence = next_sequence + written;
+            uint32_t slot = sequence % RECORDS_PER_SECTOR;
+            size_t offset = record_offset(sequence);
+            if (slot == 0 && esp_partition_erase_range(partition, offset, SECTOR_SIZE) != ESP_OK) {
+                LOG_ERROR("Data log: cannot erase sector at 0x%x.", static_cast<unsigned>(offset));
+            }
+            uint32_t count = MIN(batch_size - written, RECORDS_PER_SECTOR - slot);
+            if (esp_partition_write(partition, offset, &batch[written], count * sizeof(Record)) != ESP_OK) {
+                LOG_ERROR("Data log: cannot write at 0x%x.", static_cast<unsigned>(offset));
+            }
+            written += count;
+        }
+        // A failed write still moves on, those records fail the CRC when read back
+        next_sequence += written;
+        batch_size = 0;
+    }
+
+    int16_t to_centidegrees(const thermometer::Reading& reading) {
+        if (isnan(reading.celsius)) {
+            return NO_TEMPERATURE;
+        }
+        return static_cast<int16_t>(lroundf(reading.celsius * 100));
+    }
+
+    void add_record(const Record& sample) {
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        Record& record = batch[batch_size++];
+        record = sample;
+        record.sequence = next_sequence + batch_size - 1;
+        record.crc = record_crc(record);
+        if (batch_size == DATALOG_BATCH_RECORDS) {
+            write_batch_locked();
+        }
+        xSemaphoreGive(log_mutex);
+        history::add(sample);
+    }
+
+    void take_sample() {
+        Record sample = {};
+        sample.time_s = static_cast<uint32_t>(timekeeper::rtc_s());
+        sample.internal_cc = to_centidegrees(thermometer::get_internal());
+        sample.external_cc = to_centidegrees(thermometer::get_external(0));
+        sample.battery_mv = battery::get_battery_status().voltage_mv;
+        add_record(sample);
+        uint64_t now = timekeeper::now_us();
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        next_sample_us += DATALOG_SAMPLE_INTERVAL_MS * 1000;
+        if (next_sample_us <= now) {
+            next_sample_us = now + DATALOG_SAMPLE_INTERVAL_MS * 1000; // Samples missed while off are not made up
+        }
+        xSemaphoreGive(log_mutex);
+    }
+
+    uint64_t next_sample_in_us() {
+        if (partition == nullptr) {
+            return UINT64_MAX;
+        }
+        uint64_t now = timekeeper::now_us();
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        uint64_t wait_us = next_sample_us > now ? next_sample_us - now : 0;
+        xSemaphoreGive(log_mutex);
+        return wait_us;
+    }
+
+    // Builds the history from the records kept in flash, once at boot
+    void replay_log() {
+        Range range = get_range();
+        for (uint32_t sequence = range.first; sequence < range.end; ++sequence) {
+            Record record;
+            if (get_record(sequence, record)) {
+                history::add(record);
+            }
+        }
+    }
+
+    void datalog_task(void* param) {
+        replay_log();
+        // Let the first conversion of the thermometer task end before the first sample
+        while (!thermometer::ready()) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+        while (true) {
+            uint64_t wait_us = next_sample_in_us();
+            if (wait_us > 0) {
+                vTaskDelay(pdMS_TO_TICKS((wait_us + 999) / 1000));
+                continue;
+            }
+            take_sample();
+        }
+    }
+
+    // The sector holding the record with the highest sequence is being filled, the end of the log is after its
+    // last written slot. Reads the first record of every sector and the slots of that one sector.
+    void find_end() {
+        uint32_t last_sector = 0;
+        uint32_t last_first_sequence = ERASED_SEQUENCE;
+        for (uint32_t sector = 0; sector < sector_count; ++sector) {
+            Record first;
+            if (esp_partition_read(partition, sector * SECTOR_SIZE, &first, sizeof(first)) != ESP_OK) {
+                continue;
+            }
+            bool valid = first.crc == record_crc(first) && first.sequence % RECORDS_PER_SECTOR == 0 &&
+                (first.sequence / RECORDS_PER_SECTOR) % sector_count == sector;
+            if (valid && (last_first_sequence == ERASED_SEQUENCE || first.sequence > last_first_sequence)) {
+                last_first_sequence = first.sequence;
+                last_sector = sector;
+            }
+        }
+        if (last_first_sequence == ERASED_SEQUENCE) {
+            next_sequence = 0; // New log, sector 0 is erased before the first write
+            return;
+        }
+        // Slots are written in order, the end is after the last one not erased. A torn record counts as written.
+        Record slots[RECORDS_PER_SECTOR / 8];
+        uint32_t used = 0;
+        for (uint32_t chunk = 0; chunk < RECORDS_PER_SECTOR; chunk += RECORDS_PER_SECTOR / 8) {
+            esp_partition_read(partition, last_sector * SECTOR_SIZE + chunk * sizeof(Record), slots, sizeof(slots));
+            for (uint32_t i = 0; i < RECORDS_PER_SECTOR / 8; ++i) {
+                if (slots[i].sequence != ERASED_SEQUENCE) {
+                    used = chunk + i + 1;
+                }
+            }
+        }
+        next_sequence = last_first_sequence + used;
+    }
+
+    // Finds the partition and the end of the log, once per boot. Returns false if there is no "datalog" partition.
+    bool open_log() {
+        if (partition != nullptr) {
+            return true;
+        }
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(DATALOG_PARTITION_SUBTYPE), "datalog");
+        if (partition == nullptr || partition->size < 2 * SECTOR_SIZE) {
+            LOG_WARNING("No datalog partition, data logging disabled.");
+            partition = nullptr;
+            return false;
+        }
+        sector_count = partition->size / SECTOR_SIZE;
+        if (log_mutex == nullptr) {
+            log_mutex = xSemaphoreCreateMutex();
+        }
+        find_end();
+        // The batch kept through deep sleep goes right after the last record in flash, anything else is stale
+        if (batch_size > DATALOG_BATCH_RECORDS || (batch_size > 0 && batch[0].sequence != next_sequence)) {
+            LOG_WARNING("Data log: batch kept in RTC memory does not follow the log, dropped.");
+            batch_size = 0;
+        }
+        Range range = get_range();
+        LOG_INFO("Data log has records %u to %u.", static_cast<unsigned>(range.first), static_cast<unsigned>(range.end));
+        return true;
+    }
+
+    void sample_once() {
+        if (open_log()) {
+            take_sample();
+        }
+    }
+
+    void init() {
+        if (open_log()) {
+            xTaskCreate(datalog_task, "DatalogTask", 2048, nullptr, 1, nullptr);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Environmental data log: every DATALOG_SAMPLE_INTERVAL_MS the temperatures and the battery voltage are added to a
+// batch in RTC memory, which is appended to a circular log in the "datalog" partition every DATALOG_BATCH_RECORDS
+// records. The batch survives deep sleep, so a timer wake up takes a sample without writing to flash.
+// The log is written sector after sector, erasing a sector only when the writes reach it, so every sector wears the
+// same and the oldest records are the ones overwritten. Records are fixed size and checked with a CRC, so a record
+// torn by a reset is skipped instead of read back as garbage.
+namespace datalog {
+    constexpr int16_t NO_TEMPERATURE = INT16_MIN;
+
+    struct __attribute__((packed)) Record {
+        uint32_t sequence; // Index of the record since the log was created, 0xFFFFFFFF in an erased slot
+        uint32_t time_s; // timekeeper::rtc_s() when sampled, 0 if the RTC was not synced
+        int16_t internal_cc; // Hundredths of a degree Celsius, NO_TEMPERATURE if unavailable
+        int16_t external_cc; // Of the first external sensor
+        uint16_t battery_mv;
+        uint16_t crc; // esp_rom_crc16_le(0, ...) of the fields above
+    };
+    static_assert(sizeof(Record) == 16, "Records must tile the flash sectors");
+
+    // Sequence numbers of the records that can still be read, [first, end), end is the sequence of the next record
+    struct Range {
+        uint32_t first;
+        uint32_t end;
+    };
+
+    Range get_range();
+
+    // Reads a record from flash or from the batch not written yet, returns false if it was overwritten, is not
+    // written yet or fails the CRC
+    bool get_record(uint32_t sequence, Record& record);
+
+    // Microseconds until the next sample is due, 0 if it is late and UINT64_MAX if nothing is logged. The deep sleep
+    // timer is armed with it.
+    uint64_t next_sample_in_us();
+
+    // Finds the end of the log and starts the sampling task, logs nothing if there is no "datalog" partition.
+    // Call after thermometer::init().
+    void init();
+
+    // Instead of init() on a timer wake up for a sample: adds one sample and returns without starting the task.
+    // Call after thermometer::read_once().
+    void sample_once();
+}
@@ -1,7 +1,9 @@
 #include <cstdint>
 
 #include "core/deepsleep.hpp"
+#include "core/datalog.hpp"
 #include "core/events.hpp"
+#include "core/framebuffer.hpp"
 #include "images/deepsleep.hpp"
 #include "constants.hpp"
 #include "core/image.hpp"
@@ -14,58 +16,80 @@
 #include "deepsleep.hpp"
 
 namespace deepsleep {
+    // Kept through deep sleep: the alarm the timer was armed for and whether it was armed for a data log sample instead
+    RTC_DATA_ATTR time_t alarm_timestamp_s;
+    RTC_DATA_ATTR bool timer_armed_for_sample;
+
+    bool woke_up_for_sample() {
+        return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER && timer_armed_for_sample;
+    }
+
+    void enter_deep_sleep() {
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+        esp_deep_sleep_enable_gpio_wakeup(1 << A_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
+        uint64_t wakeup_in_us = datalog::next_sample_in_us();
+        timer_armed_for_sample = wakeup_in_us != UINT64_MAX;
+        if (alarm_timestamp_s != 0) {
+            // Wake up 1s before the alarm
+            auto now = timekeeper::rtc_s();
+            if (alarm_timestamp_s <= now + 1) {
+                LOG_INFO("Deep-sleep aborted due to imminent alarm.");
+                return;
+            }
+            uint64_t alarm_in_us = static_cast<uint64_t>(alarm_timestamp_s - now - 1) * 1000000;
+            if (alarm_in_us <= wakeup_in_us) {
+                wakeup_in_us = alarm_in_us;
+                timer_armed_for_sample = false;
+                LOG_INFO("Scheduled wakeup for alarm at %d (in %d seconds).", alarm_timestamp_s, alarm_timestamp_s - now - 1);
+            }
+        }
+        if (wakeup_in_us != UINT64_MAX) {
+            esp_sleep_enable_timer_wakeup(wakeup_in_us);
+        }
+        if (timer_armed_for_sample) {
+            LOG_INFO("Scheduled wakeup for a data log sample in %u s.", static_cast<unsigned>(wakeup_in_us / 1000000));
+        }
+        timekeeper::deepsleep();
+        LOG_INFO("Entering deep-sleep.");
+        logger::flush(); // The queued messages are lost in deep sleep
+        esp_deep_sleep_start();
+    }
+
     void deepsleep(Adafruit_SSD1306& display) {
         auto alarm_info = apps::alarm::get_alarm_timestamp();
         if (alarm_info.triggered) {
-            logger::info("Deep-sleep aborted due to alarm triggered.");
+            LOG_INFO("Deep-sleep aborted due to alarm triggered.");
             return;
         }
         if (alarm_info.timestamp != 0) {
             auto now = timekeeper::rtc_s();
             if (now + DEEPSLEEP_GRACE_PERIOD_US / 1000000 + 1 >= alarm_info.timestamp) {
-                logger::info("Deep-sleep aborted due to upcoming alarm.");
+                LOG_INFO("Deep-sleep aborted due to upcoming alarm.");
                 return;
             }
         }
 
         sound::stop_async_interruptible_melody(); // Stop any playing melody
-        image::display_image(images::deepsleep, display);
+        image::display_image(images::deepsleep_packed, display);
         sound::play_melody(deepsleep_jingle_melody, sizeof(deepsleep_jingle_melody)/sizeof(deepsleep_jingle_melody[0]));
+        framebuffer::sync(); // The display task must be done with the bus and the panel
         display.ssd1306_command(SSD1306_DISPLAYOFF);
         gpio_wakeup_enable(static_cast<gpio_num_t>(A_PIN), GPIO_INTR_LOW_LEVEL);
         esp_sleep_enable_gpio_wakeup();
         esp_sleep_enable_timer_wakeup(DEEPSLEEP_GRACE_PERIOD_US);
-        logger::info("Entering light-sleep.");
+        LOG_INFO("Entering light-sleep.");
         esp_light_sleep_start();
         auto wakeup_cause = esp_sleep_get_wakeup_cause();
         if (wakeup_cause == ESP_SLEEP_WAKEUP_TIMER) {
-            logger::info("Grace period expired.");
-            esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
-            esp_deep_sleep_enable_gpio_wakeup(1 << A_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
-            alarm_info = apps::alarm::get_alarm_timestamp(); // Re-check alarm before deep sleep
-            bool abort_deep_sleep = false;
-            if (alarm_info.timestamp != 0) {
-                // Schedule wakeup for alarm, wake 1s before alarm time
-                auto now = timekeeper::rtc_s();
-                if (alarm_info.timestamp > now + 1) {
-                    esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(alarm_info.timestamp - now - 1) * 1000000);
-                    logger::info("Scheduled wakeup for alarm at %d (in %d seconds).", alarm_info.timestamp, alarm_info.timestamp - now - 1);
-                } else {
-                    logger::info("Deep-sleep aborted due to imminent alarm.");
-                    abort_deep_sleep = true;
-                }
-            }
-            if (!abort_deep_sleep) {
-                timekeeper::deepsleep();
-                logger::info("Entering deep-sleep.");
-                esp_deep_sleep_start();
-            } else {
-                logger::info("Continuing execution.");
-            }
+            LOG_INFO("Grace period expired.");
+            // Re-check alarm before deep sleep, it cannot change until the watch is awake again
+            alarm_timestamp_s = apps::alarm::get_alarm_timestamp().timestamp;
+            enter_deep_sleep();
+            LOG_INFO("Continuing execution.");
         } else if (wakeup_cause == ESP_SLEEP_WAKEUP_GPIO) {
-            logger::info("Deep-sleep aborted by GPIO wakeup.");
+            LOG_INFO("Deep-sleep aborted by GPIO wakeup.");
         } else {
-            logger::info("Woke up from unknown reason, continuing execution.");
+            LOG_INFO("Woke up from unknown reason, continuing execution.");
         }
         events::clear_event_queue(); // Avoid sending the button press event that woke us up
         events::update_last_event_timestamp(); // Prevent immediate re-entry into deepsleep
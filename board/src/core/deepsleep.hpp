@@ -5,4 +5,11 @@
 namespace deepsleep {
     // Put the device into deep sleep mode after displaying a message
     void deepsleep(Adafruit_SSD1306& display);
+
+    // True on a wake up from the timer armed for a data log sample, rather than for the alarm or by a button
+    bool woke_up_for_sample();
+
+    // Arms the timer for the next data log sample or the alarm, whichever comes first, and enters deep sleep without
+    // touching the display. Returns only if the alarm is too close to sleep.
+    void enter_deep_sleep();
 }
@@ -1,5 +1,7 @@
+#include <atomic>
 #include <cstdint>
 #include <Arduino.h>
+#include <esp_timer.h>
 
 #include "core/events.hpp"
 #include "core/logger.hpp"
@@ -8,28 +10,103 @@
 #include "constants.hpp"
 
 namespace events {
-    QueueHandle_t event_queue = nullptr;
+    static_assert((EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) == 0, "EVENT_QUEUE_SIZE must be a power of 2");
+    constexpr uint32_t EVENT_NOTIFICATION = 1 << 0;
+    constexpr uint32_t WAKE_UP_NOTIFICATION = 1 << 1;
+
+    // Single producer (the button ISRs, which run at the same interrupt level and never nest, and the repeat
+    // timer callback, which runs with interrupts disabled) and
+    // single consumer (the task that called enable_events) ring. The producer always writes, overwriting
+    // the oldest event when full, and the consumer detects the overwritten events and skips them.
+    PackedEvent event_ring[EVENT_QUEUE_SIZE];
+    std::atomic<uint32_t> ring_head(0); // Events written, the next one goes in event_ring[ring_head % EVENT_QUEUE_SIZE]
+    std::atomic<uint32_t> ring_reserved(0); // ring_head + 1 while the producer is writing an event, ring_head otherwise
+    uint32_t ring_tail = 0; // Events consumed, only used by the consumer
+    uint32_t dropped_events = 0;
+    TaskHandle_t consumer_task = nullptr;
+
     uint64_t last_button_event_time[6*2] = {0};
     uint64_t button_press_start_time[6] = {0};
-    hw_timer_t* timer_ptr = nullptr;
+    uint64_t next_repeat_time[6] = {0}; // 0 when the button is not held down
+    uint64_t repeat_interval[6] = {0}; // Time between the last repeat and the next one
+    esp_timer_handle_t repeat_timer = nullptr; // One-shot, armed only while a button is held down
+    portMUX_TYPE repeat_mux = portMUX_INITIALIZER_UNLOCKED;
     uint64_t last_event_timestamp = 0;
     EventMask current_mask = EventMask::NONE;
 
-    void IRAM_ATTR add_event(const Event& ev) {
-        Event dummy;
-        if (event_queue != nullptr) {
-            auto highPriorityTaskWoken = pdFALSE;
-            if(xQueueIsQueueFullFromISR(event_queue)) {
-                xQueueReceiveFromISR(event_queue, &dummy, &highPriorityTaskWoken);
+    // Events handed to the consumer, read by the serial export
+    TraceEntry trace[EVENT_TRACE_SIZE];
+    uint32_t trace_end = 0;
+    portMUX_TYPE trace_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    PackedEvent IRAM_ATTR pack_event(const Event& event) {
+        PackedEvent packed = {};
+        packed.type = static_cast<uint8_t>(event.type);
+        switch (event.type) {
+            case EventType::BUTTON_PRESS:
+                packed.timestamp = static_cast<uint32_t>(event.button_press_event.timestamp);
+                packed.button = static_cast<uint8_t>(event.button_press_event.button);
+                packed.hold = static_cast<uint8_t>(event.button_press_event.hold);
+                packed.repeated = event.button_press_event.repeated;
+                break;
+            case EventType::BUTTON_RELEASE: {
+                uint64_t duration = event.button_release_event.duration;
+                packed.timestamp = static_cast<uint32_t>(event.button_release_event.timestamp);
+                packed.button = static_cast<uint8_t>(event.button_release_event.button);
+                packed.hold = static_cast<uint8_t>(event.button_release_event.hold);
+                packed.duration = duration > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(duration);
+                break;
             }
-            xQueueSendFromISR(event_queue, &ev, &highPriorityTaskWoken);
-            
+            default:
+                break;
+        }
+        return packed;
+    }
+
+    void IRAM_ATTR push_event(const PackedEvent& ev) {
+        uint32_t head = ring_head.load(std::memory_order_relaxed);
+        ring_reserved.store(head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // The consumer must see the reservation before the new data
+        event_ring[head % EVENT_QUEUE_SIZE] = ev;
+        ring_head.store(head + 1, std::memory_order_release);
+    }
+
+    void IRAM_ATTR notify_consumer_from_isr() {
+        if (consumer_task != nullptr) {
+            auto highPriorityTaskWoken = pdFALSE;
+            xTaskNotifyFromISR(consumer_task, EVENT_NOTIFICATION, eSetBits, &highPriorityTaskWoken);
             if (highPriorityTaskWoken) {
                 portYIELD_FROM_ISR();
             }
         }
     }
 
+    void IRAM_ATTR add_event(const PackedEvent& ev) {
+        push_event(ev);
+        notify_consumer_from_isr();
+    }
+
+    bool pop_event(PackedEvent& ev) {
+        while (true) {
+            uint32_t head = ring_head.load(std::memory_order_acquire);
+            if (head == ring_tail) {
+                return false;
+            }
+            if (head - ring_tail > EVENT_QUEUE_SIZE) {
+                // The producer lapped us, the oldest events are gone
+                dropped_events += head - EVENT_QUEUE_SIZE - ring_tail;
+                ring_tail = head - EVENT_QUEUE_SIZE;
+            }
+            ev = event_ring[ring_tail % EVENT_QUEUE_SIZE];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (ring_reserved.load(std::memory_order_relaxed) - ring_tail <= EVENT_QUEUE_SIZE) {
+                ring_tail++;
+                return true;
+            }
+            // The slot was overwritten while copying it, retry with the newer events
+        }
+    }
+
     // MUST be a single button
     size_t IRAM_ATTR get_button_index(Button button, bool pressed) {
         switch (button) {
@@ -61,71 +138,93 @@ namespace events {
         return mask;
     }
 
-    void IRAM_ATTR handle_button_repeats() {
+    // Buttons held down according to the GPIO input register
+    Button IRAM_ATTR held_buttons(uint32_t gpio_state) {
+        Button hold = Button::NONE;
+        hold |= (gpio_state & (1 << A_PIN)) == 0 ? Button::A : Button::NONE;
+        hold |= (gpio_state & (1 << B_PIN)) == 0 ? Button::B : Button::NONE;
+        hold |= (gpio_state & (1 << UP_PIN)) == 0 ? Button::UP : Button::NONE;
+        hold |= (gpio_state & (1 << DOWN_PIN)) == 0 ? Button::DOWN : Button::NONE;
+        hold |= (gpio_state & (1 << LEFT_PIN)) == 0 ? Button::LEFT : Button::NONE;
+        hold |= (gpio_state & (1 << RIGHT_PIN)) == 0 ? Button::RIGHT : Button::NONE;
+        return hold;
+    }
+
+    // Arms the repeat timer for the earliest repeat deadline, or stops it if no button is held down
+    void IRAM_ATTR schedule_repeats(uint64_t timestamp) {
+        uint64_t next = UINT64_MAX;
+        for (int i = 0; i < 6; ++i) {
+            if (next_repeat_time[i] != 0 && next_repeat_time[i] < next) {
+                next = next_repeat_time[i];
+            }
+        }
+        if (repeat_timer == nullptr) {
+            return;
+        }
+        esp_timer_stop(repeat_timer); // Fails harmlessly if it is not running
+        if (next != UINT64_MAX) {
+            esp_timer_start_once(repeat_timer, next > timestamp ? next - timestamp : 0);
+        }
+    }
+
+    // Generates the repeat events that are due, returns true if any was generated
+    bool handle_button_repeats() {
         uint64_t timestamp = timekeeper::now_us();
         auto gpio_state = GPIO.in.val;
-        Event dummy;
-        auto highPriorityTaskWoken = pdFALSE;
+        bool added = false;
 
         for (int i = 0; i < 6; ++i) {
             Button button = static_cast<Button>(1 << i);
             bool pressed = (gpio_state & button_to_pin_mask(button)) == 0; // Active low
-            if (pressed) {
-                auto button_index = get_button_index(button, true);
-                if (
-                    last_button_event_time[button_index] + DEBOUNCE_DELAY_US <= timestamp 
-                    && button_press_start_time[i] + REPEAT_DELAY_US <= timestamp
-                ) {
-                    // Generate repeat event
-                    Event ev;
-                    ev.type = EventType::BUTTON_PRESS;
-                    ev.button_press_event.button = button;
-                    // Determine hold state
-                    Button hold = Button::NONE;
-                    bool button_a = (gpio_state & (1 << A_PIN)) == 0;
-                    bool button_b = (gpio_state & (1 << B_PIN)) == 0;
-                    bool button_up = (gpio_state & (1 << UP_PIN)) == 0;
-                    bool button_down = (gpio_state & (1 << DOWN_PIN)) == 0;
-                    bool button_left = (gpio_state & (1 << LEFT_PIN)) == 0;
-                    bool button_right = (gpio_state & (1 << RIGHT_PIN)) == 0;
-                    hold |= button_a ? Button::A : Button::NONE;
-                    hold |= button_b ? Button::B : Button::NONE;
-                    hold |= button_up ? Button::UP : Button::NONE;
-                    hold |= button_down ? Button::DOWN : Button::NONE;
-                    hold |= button_left ? Button::LEFT : Button::NONE;
-                    hold |= button_right ? Button::RIGHT : Button::NONE;
-                    ev.button_press_event.hold = hold;
-                    ev.button_press_event.timestamp = timestamp;
-                    ev.button_press_event.repeated = true;
-
-                    last_button_event_time[button_index] = timestamp;
-                    if (event_queue != nullptr) {
-                        if (xQueueIsQueueFullFromISR(event_queue)) {
-                            xQueueReceiveFromISR(event_queue, &dummy, &highPriorityTaskWoken);
-                        }
-                        xQueueSendFromISR(event_queue, &ev, &highPriorityTaskWoken);
-                    }
-                }
+            if (!pressed) {
+                next_repeat_time[i] = 0; // The release was masked or debounced
+                continue;
+            }
+            if (next_repeat_time[i] == 0 || next_repeat_time[i] > timestamp) {
+                continue;
+            }
+            if ((static_cast<uint16_t>(current_mask) & static_cast<uint8_t>(button)) == 0) {
+                // Generate repeat event
+                Event ev = { .type = EventType::BUTTON_PRESS, {}};
+                ev.button_press_event.button = button;
+                ev.button_press_event.hold = held_buttons(gpio_state);
+                ev.button_press_event.timestamp = timestamp;
+                ev.button_press_event.repeated = true;
+                push_event(pack_event(ev));
+                added = true;
             }
+            // Never catch up on missed repeats with a burst
+            next_repeat_time[i] = MAX(next_repeat_time[i] + repeat_interval[i], timestamp + 1);
+            repeat_interval[i] = MAX(MIN_REPEAT_INTERVAL_US, repeat_interval[i] * REPEAT_ACCELERATION_PERCENT / 100);
+        }
+        schedule_repeats(timestamp);
+        return added;
+    }
+
+    void repeat_timer_callback(void* arg) {
+        // Keeps the button ISRs out, they share the ring and the repeat state
+        portENTER_CRITICAL(&repeat_mux);
+        bool added = handle_button_repeats();
+        portEXIT_CRITICAL(&repeat_mux);
+        if (added && consumer_task != nullptr) {
+            xTaskNotify(consumer_task, EVENT_NOTIFICATION, eSetBits); // Once for all the repeats
         }
-        if (highPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }           
     }
 
     void IRAM_ATTR handle_button_interrupt(Button button) {
         uint64_t timestamp = timekeeper::now_us();
-        Event ev;
-
         auto gpio_state = GPIO.in.val;
         bool pressed = (gpio_state & button_to_pin_mask(button)) == 0; // Active low
 
-        if (pressed) {
-            ev.type = EventType::BUTTON_PRESS;
-        } else {
-            ev.type = EventType::BUTTON_RELEASE;
+        if (!pressed) {
+            // Stop repeating even if the release itself is masked or debounced
+            size_t i = get_button_index(button, false) / 2;
+            if (next_repeat_time[i] != 0) {
+                next_repeat_time[i] = 0;
+                schedule_repeats(timestamp);
+            }
         }
-        
+
         if ( (pressed && (static_cast<uint16_t>(current_mask) & static_cast<uint8_t>(button) ) != 0) ||
             (!pressed && (static_cast<uint16_t>(current_mask) & (static_cast<uint8_t>(button) << 6))) != 0) {
             return; // Event is masked
@@ -138,38 +237,27 @@ namespace events {
         last_button_event_time[button_index] = timestamp;
         if (pressed) {
             button_press_start_time[button_index / 2] = timestamp;
+            next_repeat_time[button_index / 2] = timestamp + REPEAT_DELAY_US;
+            repeat_interval[button_index / 2] = REPEAT_INTERVAL_US;
+            schedule_repeats(timestamp);
         }
 
-        Button hold = Button::NONE;
-
-        bool button_a = (gpio_state & (1 << A_PIN)) == 0;
-        bool button_b = (gpio_state & (1 << B_PIN)) == 0;
-        bool button_up = (gpio_state & (1 << UP_PIN)) == 0;
-        bool button_down = (gpio_state & (1 << DOWN_PIN)) == 0;
-        bool button_left = (gpio_state & (1 << LEFT_PIN)) == 0;
-        bool button_right = (gpio_state & (1 << RIGHT_PIN)) == 0;
-        hold |= button_a ? Button::A : Button::NONE;
-        hold |= button_b ? Button::B : Button::NONE;
-        hold |= button_up ? Button::UP : Button::NONE;
-        hold |= button_down ? Button::DOWN : Button::NONE;
-        hold |= button_left ? Button::LEFT : Button::NONE;
-        hold |= button_right ? Button::RIGHT : Button::NONE;
-
+        Event ev = { .type = EventType::NONE, {}};
         if (pressed) {
+            ev.type = EventType::BUTTON_PRESS;
             ev.button_press_event.button = button;
-            ev.button_press_event.hold = hold;
+            ev.button_press_event.hold = held_buttons(gpio_state);
             ev.button_press_event.timestamp = timestamp;
             ev.button_press_event.repeated = false; // Initial press, not a repeat
         } else {
+            ev.type = EventType::BUTTON_RELEASE;
             ev.button_release_event.button = button;
-            ev.button_release_event.hold = hold;
+            ev.button_release_event.hold = held_buttons(gpio_state);
             ev.button_release_event.timestamp = timestamp;
-            // Calculate duration
-            auto press_time = button_press_start_time[button_index / 2];
-            ev.button_release_event.duration = timestamp - press_time;
+            ev.button_release_event.duration = timestamp - button_press_start_time[button_index / 2];
         }
 
-        add_event(ev);
+        add_event(pack_event(ev));
     }
 
     namespace ISRs {
@@ -191,10 +279,6 @@ namespace events {
         void IRAM_ATTR button_RIGHT() {
             handle_button_interrupt(Button::RIGHT);
         }
-
-        void IRAM_ATTR timer() {
-            handle_button_repeats();
-        }
     }
 
     void mask_event(EventMask mask) {
@@ -210,10 +294,18 @@ namespace events {
     }
     
     void clear_event_queue() {
-        if (event_queue != nullptr) {
-            xQueueReset(event_queue);
+        ring_tail = ring_head.load(std::memory_order_acquire);
+    }
+
+    void wake_up() {
+        if (consumer_task != nullptr) {
+            xTaskNotify(consumer_task, WAKE_UP_NOTIFICATION, eSetBits);
         }
     }
+
+    uint32_t get_dropped_event_count() {
+        return dropped_events;
+    }
     
     Button operator|(Button a, Button b) {
         return static_cast<Button>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
@@ -233,10 +325,58 @@ namespace events {
         return static_cast<Button>(~static_cast<uint8_t>(a));
     }
 
+    Event unpack_event(const PackedEvent& packed, uint64_t now) {
+        Event ev = { .type = static_cast<EventType>(packed.type), {}};
+        uint64_t timestamp = now - static_cast<uint32_t>(static_cast<uint32_t>(now) - packed.timestamp);
+        switch (ev.type) {
+            case EventType::BUTTON_PRESS:
+                ev.button_press_event.button = static_cast<Button>(packed.button);
+                ev.button_press_event.hold = static_cast<Button>(packed.hold);
+                ev.button_press_event.timestamp = timestamp;
+                ev.button_press_event.repeated = packed.repeated;
+                break;
+            case EventType::BUTTON_RELEASE:
+                ev.button_release_event.button = static_cast<Button>(packed.button);
+                ev.button_release_event.hold = static_cast<Button>(packed.hold);
+                ev.button_release_event.timestamp = timestamp;
+                ev.button_release_event.duration = packed.duration;
+                break;
+            default:
+                break;
+        }
+        return ev;
+    }
+
+    void add_to_trace(const Event& event, const PackedEvent& packed) {
+        TraceEntry entry = {};
+        entry.timestamp = event.type == EventType::BUTTON_PRESS ? event.button_press_event.timestamp : event.button_release_event.timestamp;
+        entry.duration = packed.duration;
+        entry.type = event.type;
+        entry.button = static_cast<Button>(packed.button);
+        entry.hold = static_cast<Button>(packed.hold);
+        entry.repeated = packed.repeated;
+        portENTER_CRITICAL(&trace_mux);
+        trace[trace_end % EVENT_TRACE_SIZE] = entry;
+        trace_end++;
+        portEXIT_CRITICAL(&trace_mux);
+    }
+
     Event get_next_event(uint64_t timeout_ms)
     {
         Event ret = { .type = EventType::NONE, {}};
-        auto res = xQueueReceive(event_queue, &ret, pdMS_TO_TICKS(timeout_ms));
+        PackedEvent packed;
+        TickType_t start = xTaskGetTickCount();
+        TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+        uint32_t notification = 0;
+        while (!pop_event(packed)) {
+            // Notifications of events already consumed are stale, keep waiting for the rest of the timeout
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if ((notification & WAKE_UP_NOTIFICATION) != 0 || elapsed >= timeout ||
+                xTaskNotifyWait(0, EVENT_NOTIFICATION | WAKE_UP_NOTIFICATION, &notification, timeout - elapsed) != pdTRUE) {
+                return ret;
+            }
+        }
+        ret = unpack_event(packed, timekeeper::now_us());
         switch (ret.type) {
             case EventType::BUTTON_PRESS:
                 last_event_timestamp = ret.button_press_event.timestamp;
@@ -247,9 +387,31 @@ namespace events {
             default:
                 break;
         }
+        add_to_trace(ret, packed);
         return ret;
     }
 
+    void get_trace_range(uint32_t& first, uint32_t& end) {
+        portENTER_CRITICAL(&trace_mux);
+        end = trace_end;
+        portEXIT_CRITICAL(&trace_mux);
+        first = end > EVENT_TRACE_SIZE ? end - EVENT_TRACE_SIZE : 0;
+    }
+
+    bool get_trace_entry(uint32_t sequence, TraceEntry& entry) {
+        portENTER_CRITICAL(&trace_mux);
+        bool found = sequence < trace_end && trace_end - sequence <= EVENT_TRACE_SIZE;
+        if (found) {
+            entry = trace[sequence % EVENT_TRACE_SIZE];
+        }
+        portEXIT_CRITICAL(&trace_mux);
+        return found;
+    }
+
+    bool has_pending_events() {
+        return ring_head.load(std::memory_order_acquire) != ring_tail;
+    }
+
     EventMask operator|(EventMask a, EventMask b)
     {
         return static_cast<EventMask>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b));
@@ -273,29 +435,31 @@ namespace events {
         return static_cast<EventMask>(~static_cast<uint16_t>(a));
     }
     
-    void start_timer_interrupt() {
-        timer_ptr = timerBegin(0, 1000, true); 
-        if (timer_ptr == nullptr) {
-            logger::error("Error starting timer.");
+    void create_repeat_timer() {
+        if (repeat_timer != nullptr) {
+            return;
+        }
+        esp_timer_create_args_t args = {};
+        args.callback = repeat_timer_callback;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "ButtonRepeat";
+        if (esp_timer_create(&args, &repeat_timer) != ESP_OK) {
+            repeat_timer = nullptr;
+            LOG_ERROR("Error creating the button repeat timer.");
             return;
         }
-        timerAttachInterrupt(timer_ptr, ISRs::timer, true);
-        timerAlarmWrite(timer_ptr, 100, true); // 100 ms
-        timerAlarmEnable(timer_ptr);
-        logger::info("Timer started correctly.");
+        LOG_INFO("Button repeat timer created correctly.");
     }
 
     void enable_events() {
-        if (event_queue == nullptr) {
-            event_queue = xQueueCreate(EVENT_QUEUE_SIZE, sizeof(Event));
-        }
+        consumer_task = xTaskGetCurrentTaskHandle();
         attachInterrupt(digitalPinToInterrupt(A_PIN), ISRs::button_A, CHANGE);
         attachInterrupt(digitalPinToInterrupt(B_PIN), ISRs::button_B, CHANGE);
         attachInterrupt(digitalPinToInterrupt(UP_PIN), ISRs::button_UP, CHANGE);
         attachInterrupt(digitalPinToInterrupt(DOWN_PIN), ISRs::button_DOWN, CHANGE);
         attachInterrupt(digitalPinToInterrupt(LEFT_PIN), ISRs::button_LEFT, CHANGE);
         attachInterrupt(digitalPinToInterrupt(RIGHT_PIN), ISRs::button_RIGHT, CHANGE);
-        start_timer_interrupt();
+        create_repeat_timer();
         update_last_event_timestamp();
     }
 
@@ -306,6 +470,12 @@ namespace events {
         detachInterrupt(digitalPinToInterrupt(DOWN_PIN));
         detachInterrupt(digitalPinToInterrupt(LEFT_PIN));
         detachInterrupt(digitalPinToInterrupt(RIGHT_PIN));
+        portENTER_CRITICAL(&repeat_mux);
+        for (auto& time : next_repeat_time) {
+            time = 0;
+        }
+        schedule_repeats(timekeeper::now_us());
+        portEXIT_CRITICAL(&repeat_mux);
     }
 
     uint64_t get_last_event_timestamp() {
@@ -5,6 +5,7 @@ namespace events {
         NONE = 0,// no fields of Event are valid apart from type
         BUTTON_PRESS = 1, // buttonEvent will contain details
         BUTTON_RELEASE = 2, // buttonEvent will contain details
+        GESTURE = 3, // gesture_event will contain details, generated by menu::wait_for_event (see core/gestures.hpp)
     };
 
     enum class Button : uint8_t {
@@ -37,11 +38,25 @@ namespace events {
         uint64_t duration; // How many microseconds (us) the button was held down
     };
 
+    enum class GestureType : uint8_t {
+        NONE = 0,
+        LONG_PRESS = 1, // Released after being held down for at least LONG_PRESS_US
+        DOUBLE_PRESS = 2, // Pressed twice within DOUBLE_PRESS_US
+        CHORD = 3, // Pressed while exactly one other button was held down
+    };
+
+    struct GestureEvent {
+        GestureType type;
+        Button buttons; // One button, or both buttons of a CHORD
+        uint64_t timestamp; // Timestamp of the button event that completed the gesture
+    };
+
     struct Event {
         EventType type;
         union {
             ButtonPressEvent button_press_event; // valid if type is BUTTON_PRESS
             ButtonReleaseEvent button_release_event; // valid if type is BUTTON_RELEASE
+            GestureEvent gesture_event; // valid if type is GESTURE
         };
     };
 
@@ -68,19 +83,75 @@ namespace events {
     EventMask operator&=(EventMask& a, EventMask b);
     EventMask operator~(EventMask a);
 
+    // Button event as kept in the trace, also the layout sent by the serial export
+    struct __attribute__((packed)) TraceEntry {
+        uint64_t timestamp;
+        uint32_t duration; // BUTTON_RELEASE only
+        EventType type;
+        Button button;
+        Button hold;
+        uint8_t repeated; // BUTTON_PRESS only
+    };
+    static_assert(sizeof(TraceEntry) == 16, "TraceEntry is sent as is");
+
+    // Ring representation of an Event, 12 bytes instead of 32. Timestamps only keep their low 32 bits (71 minutes),
+    // get_next_event restores the rest from the current time, events never stay in the ring that long.
+    struct PackedEvent {
+        uint32_t timestamp;
+        uint32_t duration; // BUTTON_RELEASE only, saturated at UINT32_MAX
+        uint16_t type : 2;
+        uint16_t repeated : 1; // BUTTON_PRESS only
+        uint16_t button : 6;
+        uint16_t hold : 6;
+    };
+    static_assert(sizeof(PackedEvent) == 12, "PackedEvent should not need padding");
+
+    // Packs a button event for the ring, the duration saturates at UINT32_MAX. Safe to call from an ISR.
+    PackedEvent pack_event(const Event& event);
+
+    // Restores an event taken from the ring, with the high bits of the timestamp taken from now, which must not be
+    // more than 2^32 us (71 minutes) after the event
+    Event unpack_event(const PackedEvent& packed, uint64_t now);
+
+    // Adds an event to the ring, overwriting the oldest one when full. Only called from the producer (the button
+    // ISRs and the repeat timer), the caller must notify the consumer.
+    void push_event(const PackedEvent& ev);
+
+    // Takes the oldest event from the ring, skipping the ones overwritten since the last call. Only called from the
+    // consumer task, returns false if the ring is empty.
+    bool pop_event(PackedEvent& ev);
+
+    // Sequence numbers of the button events still in the trace, [first, end), counted since boot
+    void get_trace_range(uint32_t& first, uint32_t& end);
+
+    // Returns false if the entry is not in the trace (anymore)
+    bool get_trace_entry(uint32_t sequence, TraceEntry& entry);
+
     // Retrieves the next event from the queue blocking up to timeout_ms milliseconds (0 = non blocking).
+    // Must be called from the task that called enable_events.
     Event get_next_event(uint64_t timeout_ms = 0);
 
+    // Returns true if get_next_event would return an event without blocking. Must be called from the task that
+    // called enable_events.
+    bool has_pending_events();
+
     // Masks (ignores) events of the specified types.
     void mask_event(EventMask mask);
 
     // Unmasks (accepts) events of the specified types.
     void unmask_event(EventMask mask);
 
-    // Clears all pending events from the queue.
+    // Clears all pending events from the queue. Must be called from the task that called enable_events.
     void clear_event_queue();
 
-    // Enables event handling by attaching all necessary interrupts.
+    // Returns how many events were dropped because the queue was full (the oldest events are dropped).
+    uint32_t get_dropped_event_count();
+
+    // Wakes up the task blocked in get_next_event, which will receive an EventType::NONE event.
+    // If there are events waiting to be processed they are returned first. Safe to call from any task.
+    void wake_up();
+
+    // Enables event handling by attaching all necessary interrupts, the calling task becomes the event consumer.
     void enable_events(); 
 
     // Disables event handling by detaching all interrupts.
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "core/framebuffer.hpp"
+#include "core/timekeeper.hpp"
+#include "constants.hpp"
+
+namespace framebuffer {
+    constexpr size_t PAGE_COUNT = SCREEN_HEIGHT / 8;
+    constexpr size_t BUFFER_SIZE = SCREEN_WIDTH * PAGE_COUNT;
+    constexpr uint32_t TRANSFER_CLOCK_HZ = 400000; // Same clocks as the Adafruit driver
+    constexpr uint32_t IDLE_CLOCK_HZ = 100000;
+    constexpr size_t TRANSMISSION_SIZE = I2C_BUFFER_LENGTH; // Control byte included
+    constexpr size_t WINDOW_COMMAND_SIZE = 8; // I2C address, control byte, PAGEADDR and COLUMNADDR with their arguments
+
+    constexpr uint32_t DISPLAY_TASK_STACK_SIZE = 2048;
+    constexpr UBaseType_t DISPLAY_TASK_PRIORITY = 2; // Above the UI, so a flushed frame is picked up right away
+
+    uint8_t front_buffer[BUFFER_SIZE]; // Last flushed frame, guarded by front_mutex
+    bool frame_waiting = false; // front_buffer holds a frame not sent yet, guarded by front_mutex
+    uint8_t last_frame[BUFFER_SIZE]; // Copy of the panel RAM, guarded by bus_mutex
+    bool last_frame_valid = false; // The panel RAM is garbage until the first transfer
+    uint32_t flushes = 0; // Only used by the task that flushes
+    Stats stats = {}; // Guarded by front_mutex
+    SemaphoreHandle_t front_mutex = nullptr;
+    SemaphoreHandle_t bus_mutex = nullptr; // Held for a whole transfer
+    TaskHandle_t display_task_handle = nullptr;
+
+    // Rectangle of the panel RAM, in pages and columns, both ends included
+    struct Window {
+        uint8_t first_page;
+        uint8_t last_page;
+        uint8_t first_column;
+        uint8_t last_column;
+    };
+
+    // Bytes on the bus needed to send a window, data transmissions cost the I2C address and the control byte each
+    size_t window_cost(const Window& window) {
+        size_t data_size = (window.last_page - window.first_page + 1) * (window.last_column - window.first_column + 1);
+        size_t transmissions = (data_size + TRANSMISSION_SIZE - 2) / (TRANSMISSION_SIZE - 1);
+        return WINDOW_COMMAND_SIZE + data_size + transmissions * 2;
+    }
+
+    Window merge_windows(const Window& a, const Window& b) {
+        return Window{
+            std::min(a.first_page, b.first_page),
+            std::max(a.last_page, b.last_page),
+            std::min(a.first_column, b.first_column),
+            std::max(a.last_column, b.last_column)
+        };
+    }
+
+    // The panel is in horizontal addressing mode, so the data fills the window page by page
+    void send_window(const uint8_t* buffer, const Window& window) {
+        const uint8_t commands[] = {
+            0x00, // Co = 0, D/C = 0
+            SSD1306_PAGEADDR, window.first_page, window.last_page,
+            SSD1306_COLUMNADDR, window.first_column, window.last_column
+        };
+        Wire.beginTransmission(OLED_ADDR);
+        Wire.write(commands, sizeof(commands));
+        Wire.endTransmission();
+
+        Wire.beginTransmission(OLED_ADDR);
+        Wire.write(static_cast<uint8_t>(0x40)); // Co = 0, D/C = 1
+        size_t bytes_out = 1;
+        for (size_t page = window.first_page; page <= window.last_page; ++page) {
+            const uint8_t* row = buffer + page * SCREEN_WIDTH;
+            for (size_t column = window.first_column; column <= window.last_column; ++column) {
+                if (bytes_out >= TRANSMISSION_SIZE) {
+                    Wire.endTransmission();
+                    Wire.beginTransmission(OLED_ADDR);
+                    Wire.write(static_cast<uint8_t>(0x40));
+                    bytes_out = 1;
+                }
+                Wire.write(row[column]);
+                bytes_out++;
+            }
+        }
+        Wire.endTransmission();
+    }
+
+    // Finds the windows covering what changed between the panel RAM and buffer, returns how many
+    size_t find_windows(const uint8_t* buffer, Window (&windows)[PAGE_COUNT]) {
+        if (!last_frame_valid) {
+            windows[0] = Window{0, PAGE_COUNT - 1, 0, SCREEN_WIDTH - 1};
+            return 1;
+        }
+        size_t window_count = 0;
+        for (size_t page = 0; page < PAGE_COUNT; ++page) {
+            const uint8_t* row = buffer + page * SCREEN_WIDTH;
+            const uint8_t* last_row = last_frame + page * SCREEN_WIDTH;
+            size_t first_column = 0;
+            while (first_column < SCREEN_WIDTH && row[first_column] == last_row[first_column]) {
+                first_column++;
+            }
+            if (first_column == SCREEN_WIDTH) {
+                continue; // Page unchanged
+            }
+            size_t last_column = SCREEN_WIDTH - 1;
+            while (row[last_column] == last_row[last_column]) {
+                last_column--;
+            }
+            Window dirty = {
+                static_cast<uint8_t>(page),
+                static_cast<uint8_t>(page),
+                static_cast<uint8_t>(first_column),
+                static_cast<uint8_t>(last_column)
+            };
+            // Grow the previous window when resending the unchanged bytes in between is cheaper than a new window
+            if (window_count > 0) {
+                Window merged = merge_windows(windows[window_count - 1], dirty);
+                if (window_cost(merged) <= window_cost(windows[window_count - 1]) + window_cost(dirty)) {
+                    windows[window_count - 1] = merged;
+                    continue;
+                }
+            }
+            windows[window_count++] = dirty;
+        }
+        return window_count;
+    }
+
+    // Sends the frame waiting in the front buffer, if any. The front buffer is only locked while it is compared
+    // and copied, the transfer itself reads the copy of the panel RAM.
+    void send_waiting_frame() {
+        xSemaphoreTake(bus_mutex, portMAX_DELAY);
+        Window windows[PAGE_COUNT];
+        size_t window_count = 0;
+        xSemaphoreTake(front_mutex, portMAX_DELAY);
+        if (frame_waiting) {
+            window_count = find_windows(front_buffer, windows);
+            memcpy(last_frame, front_buffer, BUFFER_SIZE);
+            last_frame_valid = true;
+            frame_waiting = false;
+        }
+        xSemaphoreGive(front_mutex);
+        if (window_count > 0) {
+            uint64_t start = timekeeper::now_us();
+            Wire.setClock(TRANSFER_CLOCK_HZ);
+            for (size_t i = 0; i < window_count; ++i) {
+                send_window(last_frame, windows[i]);
+            }
+            Wire.setClock(IDLE_CLOCK_HZ);
+            uint32_t duration = timekeeper::now_us() - start;
+            xSemaphoreTake(front_mutex, portMAX_DELAY);
+            stats.frames_sent++;
+            stats.last_transfer_us = duration;
+            stats.max_transfer_us = std::max(stats.max_transfer_us, duration);
+            xSemaphoreGive(front_mutex);
+        }
+        xSemaphoreGive(bus_mutex);
+    }
+
+    void display_task(void* param) {
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            send_waiting_frame();
+        }
+    }
+
+    void add_blocked_time(uint64_t start) {
+        uint32_t duration = timekeeper::now_us() - start;
+        xSemaphoreTake(front_mutex, portMAX_DELAY);
+        stats.ui_blocked_us += duration;
+        stats.max_ui_blocked_us = std::max(stats.max_ui_blocked_us, duration);
+        xSemaphoreGive(front_mutex);
+    }
+
+    void init() {
+        front_mutex = xSemaphoreCreateMutex();
+        bus_mutex = xSemaphoreCreateMutex();
+        xTaskCreate(display_task, "DisplayTask", DISPLAY_TASK_STACK_SIZE, nullptr, DISPLAY_TASK_PRIORITY, &display_task_handle);
+    }
+
+    void flush(Adafruit_SSD1306& display) {
+        uint64_t start = timekeeper::now_us();
+        flushes++;
+        xSemaphoreTake(front_mutex, portMAX_DELAY);
+        if (frame_waiting) {
+            stats.frames_replaced++;
+        }
+        memcpy(front_buffer, display.getBuffer(), BUFFER_SIZE);
+        frame_waiting = true;
+        xSemaphoreGive(front_mutex);
+        xTaskNotifyGive(display_task_handle);
+        add_blocked_time(start);
+    }
+
+    void sync() {
+        uint64_t start = timekeeper::now_us();
+        send_waiting_frame(); // Waits for the transfer in progress, then sends what the display task didn't pick up
+        add_blocked_time(start);
+    }
+
+    bool busy() {
+        xSemaphoreTake(front_mutex, portMAX_DELAY);
+        bool waiting = frame_waiting;
+        xSemaphoreGive(front_mutex);
+        return waiting;
+    }
+
+    uint32_t frame_count() {
+        return flushes;
+    }
+
+    Stats get_stats() {
+        xSemaphoreTake(front_mutex, portMAX_DELAY);
+        Stats copy = stats;
+        xSemaphoreGive(front_mutex);
+        return copy;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <Adafruit_SSD1306.h>
+
+// The display buffer of Adafruit_SSD1306 is the back buffer apps draw into. flush() copies it to a front buffer
+// and returns, a dedicated task then sends to the panel only the pages and columns that changed since the
+// last transfer, so the UI keeps drawing and handling events while the I2C bus is busy.
+namespace framebuffer {
+    struct Stats {
+        uint32_t frames_sent; // Transfers to the panel, frames without changes are not sent
+        uint32_t frames_replaced; // Flushed frames replaced by a newer one before their transfer started
+        uint32_t last_transfer_us; // Duration of the last transfer
+        uint32_t max_transfer_us;
+        uint64_t ui_blocked_us; // Total time spent inside flush() and sync() by their callers
+        uint32_t max_ui_blocked_us;
+    };
+
+    // Starts the display task, call once after display.begin() and before the first flush
+    void init();
+
+    // Hands the display buffer over to the display task, use this instead of display.display()
+    void flush(Adafruit_SSD1306& display);
+
+    // Blocks until every flushed frame is on the panel, call before sending commands to the panel or sleeping
+    void sync();
+
+    // True while a flushed frame waits for the transfer in progress to end, flushing now would replace it
+    bool busy();
+
+    // Number of flushes so far, lets retained drawing code tell whether someone else drew in between
+    uint32_t frame_count();
+
+    Stats get_stats();
+}
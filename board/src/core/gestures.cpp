@@ -0,0 +1,109 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "core/gestures.hpp"
+#include "constants.hpp"
+
+namespace gestures {
+    enum State : uint8_t {
+        IDLE, // Not held down
+        DOWN, // Held down, a long press if held long enough
+        RELEASED, // Released after a short press, a press within DOUBLE_PRESS_US makes a double press
+        DOWN_AGAIN, // Held down after a double press
+        CHORDED, // Held down as part of a chord, only its release is expected
+        STATE_COUNT
+    };
+
+    enum Input : uint8_t {
+        PRESS, // Within DOUBLE_PRESS_US of the previous press of the same button
+        LATE_PRESS,
+        SHORT_RELEASE,
+        LONG_RELEASE, // Held down for at least LONG_PRESS_US
+        CHORD_PRESS, // This or another button was pressed while two or more buttons are held down
+        INPUT_COUNT
+    };
+
+    struct Transition {
+        State next;
+        events::GestureType gesture;
+    };
+
+    constexpr events::GestureType NO_GESTURE = events::GestureType::NONE;
+    constexpr events::GestureType LONG_PRESS = events::GestureType::LONG_PRESS;
+    constexpr events::GestureType DOUBLE_PRESS = events::GestureType::DOUBLE_PRESS;
+    constexpr events::GestureType CHORD = events::GestureType::CHORD;
+
+    // Per button state machine
+    constexpr Transition transitions[STATE_COUNT][INPUT_COUNT] = {
+        //            PRESS                         LATE_PRESS          SHORT_RELEASE             LONG_RELEASE            CHORD_PRESS
+        /* IDLE */       {{DOWN, NO_GESTURE},       {DOWN, NO_GESTURE}, {IDLE, NO_GESTURE},       {IDLE, NO_GESTURE},     {CHORDED, CHORD}},
+        /* DOWN */       {{DOWN, NO_GESTURE},       {DOWN, NO_GESTURE}, {RELEASED, NO_GESTURE},   {IDLE, LONG_PRESS},     {CHORDED, CHORD}},
+        /* RELEASED */   {{DOWN_AGAIN, DOUBLE_PRESS}, {DOWN, NO_GESTURE}, {RELEASED, NO_GESTURE}, {IDLE, NO_GESTURE},     {CHORDED, CHORD}},
+        /* DOWN_AGAIN */ {{DOWN, NO_GESTURE},       {DOWN, NO_GESTURE}, {IDLE, NO_GESTURE},       {IDLE, NO_GESTURE},     {CHORDED, CHORD}},
+        /* CHORDED */    {{DOWN, NO_GESTURE},       {DOWN, NO_GESTURE}, {IDLE, NO_GESTURE},       {IDLE, NO_GESTURE},     {CHORDED, NO_GESTURE}},
+    };
+
+    constexpr size_t BUTTON_COUNT = 6;
+    State states[BUTTON_COUNT] = {};
+    uint64_t last_press_time[BUTTON_COUNT] = {};
+
+    // MUST be a single button
+    size_t button_index(events::Button button) {
+        return __builtin_ctz(static_cast<uint8_t>(button));
+    }
+
+    events::GestureType step(size_t index, Input input) {
+        const Transition& transition = transitions[states[index]][input];
+        states[index] = transition.next;
+        return transition.gesture;
+    }
+
+    bool recognize(const events::Event& ev, events::Event& gesture) {
+        events::GestureType type = NO_GESTURE;
+        events::Button buttons = events::Button::NONE;
+        uint64_t timestamp = 0;
+        if (ev.type == events::EventType::BUTTON_PRESS) {
+            const auto& press = ev.button_press_event;
+            if (press.repeated || press.button == events::Button::NONE) {
+                return false;
+            }
+            size_t index = button_index(press.button);
+            timestamp = press.timestamp;
+            uint8_t held = static_cast<uint8_t>(press.hold | press.button);
+            if (__builtin_popcount(held) >= 2) {
+                // Every held button joins the chord, only the press completing a two buttons chord reports it
+                for (size_t i = 0; i < BUTTON_COUNT; i++) {
+                    if ((held & (1 << i)) != 0 && i != index) {
+                        step(i, CHORD_PRESS);
+                    }
+                }
+                type = step(index, CHORD_PRESS);
+                if (__builtin_popcount(held) != 2) {
+                    type = NO_GESTURE;
+                }
+                buttons = static_cast<events::Button>(held);
+            } else {
+                bool in_time = last_press_time[index] != 0 && timestamp - last_press_time[index] <= DOUBLE_PRESS_US;
+                type = step(index, in_time ? PRESS : LATE_PRESS);
+                buttons = press.button;
+            }
+            last_press_time[index] = timestamp;
+        } else if (ev.type == events::EventType::BUTTON_RELEASE) {
+            const auto& release = ev.button_release_event;
+            if (release.button == events::Button::NONE) {
+                return false;
+            }
+            timestamp = release.timestamp;
+            buttons = release.button;
+            type = step(button_index(release.button), release.duration >= LONG_PRESS_US ? LONG_RELEASE : SHORT_RELEASE);
+        }
+        if (type == NO_GESTURE) {
+            return false;
+        }
+        gesture.type = events::EventType::GESTURE;
+        gesture.gesture_event.type = type;
+        gesture.gesture_event.buttons = buttons;
+        gesture.gesture_event.timestamp = timestamp;
+        return true;
+    }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "core/events.hpp"
+
+namespace gestures {
+    // Feeds a raw button event to the recognizer. Returns true and fills gesture with an EventType::GESTURE
+    // event when ev completes a long press, double press or chord. The raw events are still meant to be
+    // handled as usual, the gesture comes right after the event that completed it.
+    bool recognize(const events::Event& ev, events::Event& gesture);
+}
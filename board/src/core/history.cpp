@@ -0,0 +1,125 @@
+#include <Arduino.h>
+
+#include "core/history.hpp"
+
+namespace history {
+    constexpr size_t CHANNEL_COUNT = 3;
+
+    struct Slot {
+        uint32_t index; // Start time / bucket duration, tells a bucket from the one a full ring ago
+        Bucket channels[CHANNEL_COUNT];
+    };
+
+    struct Ring {
+        uint32_t duration_s;
+        size_t capacity;
+        Slot* slots;
+    };
+
+    // About 15 KB in total
+    Slot minute_slots[128]; // 2 hours
+    Slot hour_slots[192]; // 8 days
+    Slot day_slots[128]; // 4 months
+    Ring rings[] = {
+        {60, sizeof(minute_slots) / sizeof(Slot), minute_slots},
+        {3600, sizeof(hour_slots) / sizeof(Slot), hour_slots},
+        {86400, sizeof(day_slots) / sizeof(Slot), day_slots}
+    };
+
+    SemaphoreHandle_t history_mutex = xSemaphoreCreateMutex();
+    uint32_t current_revision = 0;
+
+    constexpr Bucket EMPTY_BUCKET = {INT16_MAX, INT16_MIN, 0, 0};
+
+    uint32_t bucket_duration_s(Resolution resolution) {
+        return rings[static_cast<size_t>(resolution)].duration_s;
+    }
+
+    uint32_t retention_s(Resolution resolution) {
+        const Ring& ring = rings[static_cast<size_t>(resolution)];
+        return ring.duration_s * ring.capacity;
+    }
+
+    Resolution resolution_for(uint32_t span_s) {
+        if (span_s <= retention_s(Resolution::MINUTE)) {
+            return Resolution::MINUTE;
+        } else if (span_s <= retention_s(Resolution::HOUR)) {
+            return Resolution::HOUR;
+        }
+        return Resolution::DAY;
+    }
+
+    void add_value(Bucket& bucket, int16_t value) {
+        bucket.min = MIN(bucket.min, value);
+        bucket.max = MAX(bucket.max, value);
+        bucket.sum += value;
+        bucket.count++;
+    }
+
+    void merge(Bucket& bucket, const Bucket& other) {
+        if (other.count == 0) {
+            return;
+        }
+        bucket.min = MIN(bucket.min, other.min);
+        bucket.max = MAX(bucket.max, other.max);
+        bucket.sum += other.sum;
+        bucket.count += other.count;
+    }
+
+    void add(const datalog::Record& record) {
+        if (record.time_s == 0) {
+            return; // No place on the time axis
+        }
+        const int16_t values[CHANNEL_COUNT] = {record.internal_cc, record.external_cc, static_cast<int16_t>(record.battery_mv)};
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        for (Ring& ring : rings) {
+            uint32_t index = record.time_s / ring.duration_s;
+            Slot& slot = ring.slots[index % ring.capacity];
+            if (slot.index != index) {
+                if (slot.index > index) {
+                    continue; // Older than the ring, only happens if the clock went back
+                }
+                slot.index = index;
+                for (Bucket& bucket : slot.channels) {
+                    bucket = EMPTY_BUCKET;
+                }
+            }
+            for (size_t channel = 0; channel < CHANNEL_COUNT; ++channel) {
+                if (channel == static_cast<size_t>(Channel::BATTERY_VOLTAGE) || values[channel] != datalog::NO_TEMPERATURE) {
+                    add_value(slot.channels[channel], values[channel]);
+                }
+            }
+        }
+        current_revision++;
+        xSemaphoreGive(history_mutex);
+    }
+
+    Bucket get(Resolution resolution, Channel channel, uint32_t from_s, uint32_t to_s) {
+        Bucket result = EMPTY_BUCKET;
+        if (to_s <= from_s) {
+            return result;
+        }
+        const Ring& ring = rings[static_cast<size_t>(resolution)];
+        uint32_t first = from_s / ring.duration_s;
+        uint32_t last = (to_s - 1) / ring.duration_s;
+        if (last - first >= ring.capacity) {
+            first = last - ring.capacity + 1;
+        }
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        for (uint32_t index = first; index <= last; ++index) {
+            const Slot& slot = ring.slots[index % ring.capacity];
+            if (slot.index == index) {
+                merge(result, slot.channels[static_cast<size_t>(channel)]);
+            }
+        }
+        xSemaphoreGive(history_mutex);
+        return result;
+    }
+
+    uint32_t revision() {
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        uint32_t value = current_revision;
+        xSemaphoreGive(history_mutex);
+        return value;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/datalog.hpp"
+
+// Min/max/mean of the data log over minutes, hours and days, updated as records are added, so a chart over any
+// span reads at most a few hundred buckets instead of every record. Each resolution keeps its latest buckets in a
+// ring indexed by time, only records with a synced RTC time have a place in it.
+namespace history {
+    enum class Resolution {
+        MINUTE,
+        HOUR,
+        DAY
+    };
+
+    enum class Channel {
+        INTERNAL_TEMPERATURE, // Hundredths of a degree Celsius
+        EXTERNAL_TEMPERATURE, // Hundredths of a degree Celsius
+        BATTERY_VOLTAGE // Millivolts
+    };
+
+    struct Bucket {
+        int16_t min;
+        int16_t max;
+        int32_t sum;
+        uint16_t count; // 0 if there is no sample in the bucket
+    };
+
+    uint32_t bucket_duration_s(Resolution resolution);
+
+    // How far back the buckets of a resolution go
+    uint32_t retention_s(Resolution resolution);
+
+    // The finest resolution still holding the whole span
+    Resolution resolution_for(uint32_t span_s);
+
+    void add(const datalog::Record& record);
+
+    // Merges the buckets of the resolution that overlap [from_s, to_s)
+    Bucket get(Resolution resolution, Channel channel, uint32_t from_s, uint32_t to_s);
+
+    // Changes every time a record is added
+    uint32_t revision();
+}
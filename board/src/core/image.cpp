@@ -1,13 +1,97 @@
 #include <cstdint>
+#include <cstring>
 
 #include "core/image.hpp"
+#include "core/framebuffer.hpp"
+#include "core/logger.hpp"
 #include "constants.hpp"
 
 namespace image {
-    void display_image(const uint8_t* image_data, Adafruit_SSD1306& display) {
-        display.clearDisplay();
-        display.drawBitmap(0, 0, image_data, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
-        display.display();
+    RowDecoder seek_row(const PackedImage& image, size_t row) {
+        RowDecoder decoder = {image.data + image.bands[row / 8], image.width / 8};
+        if (image.width > MAX_IMAGE_WIDTH) {
+            LOG_ERROR("Image is %u pixels wide, at most %u can be decoded.", static_cast<unsigned>(image.width), static_cast<unsigned>(MAX_IMAGE_WIDTH));
+            return decoder; // Rows can only be skipped through a buffer as wide as the image
+        }
+        uint8_t skipped[MAX_IMAGE_WIDTH / 8];
+        for (size_t i = 0; i < row % 8; i++) {
+            decode_rows(decoder, skipped, 1);
+        }
+        return decoder;
+    }
+
+    void decode_rows(RowDecoder& decoder, uint8_t* rows, size_t row_count) {
+        const uint8_t* next = decoder.next;
+        uint8_t* end = rows + row_count * decoder.bytes_per_row;
+        while (rows < end) {
+            uint8_t header = *next++;
+            // Counts are clamped so corrupted data cannot write past the rows
+            if (header < 128) {
+                // Literal bytes
+                size_t count = MIN(static_cast<size_t>(header + 1), static_cast<size_t>(end - rows));
+                memcpy(rows, next, count);
+                rows += count;
+                next += header + 1;
+            } else if (header > 128) {
+                // Run of the same byte
+                size_t count = MIN(static_cast<size_t>(257 - header), static_cast<size_t>(end - rows));
+                memset(rows, *next++, count);
+                rows += count;
+            }
+        }
+        decoder.next = next;
+    }
+
+    // Transposes an 8x8 block of pixels: byte k of rows holds pixel row k with the leftmost pixel in the MSB,
+    // byte 7 - c of the result holds pixel column c with the top pixel in the LSB, as in the SSD1306 buffer
+    uint64_t transpose_block(uint64_t rows) {
+        rows = (rows & 0xAA55AA55AA55AA55ULL) | ((rows & 0x00AA00AA00AA00AAULL) << 7) | ((rows >> 7) & 0x00AA00AA00AA00AAULL);
+        rows = (rows & 0xCCCC3333CCCC3333ULL) | ((rows & 0x0000CCCC0000CCCCULL) << 14) | ((rows >> 14) & 0x0000CCCC0000CCCCULL);
+        rows = (rows & 0xF0F0F0F00F0F0F0FULL) | ((rows & 0x00000000F0F0F0F0ULL) << 28) | ((rows >> 28) & 0x00000000F0F0F0F0ULL);
+        return rows;
+    }
+
+    void blit_page(uint8_t* page, const uint8_t* rows, size_t bytes_per_row, size_t x) {
+        size_t shift = x % 8;
+        size_t column_byte = x / 8;
+        for (size_t block = 0; block < static_cast<size_t>(SCREEN_WIDTH) / 8; block++) {
+            size_t next_byte = (column_byte + 1) % bytes_per_row;
+            uint64_t block_rows = 0;
+            for (size_t row = 0; row < 8; row++) {
+                const uint8_t* line = rows + row * bytes_per_row;
+                uint8_t pixels = line[column_byte];
+                if (shift != 0) {
+                    pixels = (pixels << shift) | (line[next_byte] >> (8 - shift));
+                }
+                block_rows |= static_cast<uint64_t>(pixels) << (row * 8);
+            }
+            uint64_t columns = transpose_block(block_rows);
+            for (size_t column = 0; column < 8; column++) {
+                page[column] = static_cast<uint8_t>(columns >> ((7 - column) * 8));
+            }
+            page += 8;
+            column_byte = next_byte;
+        }
+    }
+
+    void blit_image(const PackedImage& image, size_t x, size_t y, Adafruit_SSD1306& display) {
+        uint8_t rows[8 * MAX_IMAGE_WIDTH / 8];
+        uint8_t* buffer = display.getBuffer();
+        if (image.width > MAX_IMAGE_WIDTH) {
+            LOG_ERROR("Image is %u pixels wide, at most %u can be drawn.", static_cast<unsigned>(image.width), static_cast<unsigned>(MAX_IMAGE_WIDTH));
+            memset(buffer, 0, SCREEN_WIDTH * SCREEN_HEIGHT / 8);
+            return;
+        }
+        auto decoder = seek_row(image, y);
+        for (size_t page = 0; page < static_cast<size_t>(SCREEN_HEIGHT) / 8; page++) {
+            decode_rows(decoder, rows, 8);
+            blit_page(buffer + page * static_cast<size_t>(SCREEN_WIDTH), rows, decoder.bytes_per_row, x);
+        }
+    }
+
+    void display_image(const PackedImage& image, Adafruit_SSD1306& display) {
+        blit_image(image, 0, 0, display);
+        framebuffer::flush(display);
     }
     void print_up_arrow(Adafruit_SSD1306& display) {
         constexpr uint8_t up_arrow[] = {
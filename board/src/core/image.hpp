@@ -3,7 +3,40 @@
 #include <Adafruit_SSD1306.h>
 
 namespace image {
-    void display_image(const uint8_t* image_data, Adafruit_SSD1306& display);
+    // Widest image seek_row and blit_image can decode, gen_images.py checks it
+    constexpr size_t MAX_IMAGE_WIDTH = 512;
+
+    // 1bpp image compressed by gen_images.py: every row is PackBits coded on its own
+    // and bands holds the offset in data of every 8th row
+    struct PackedImage {
+        const uint8_t* data;
+        const uint16_t* bands;
+        size_t width;
+        size_t height;
+    };
+
+    // Position inside the rows of a PackedImage, rows can only be decoded in order
+    struct RowDecoder {
+        const uint8_t* next;
+        size_t bytes_per_row;
+    };
+
+    // Returns a decoder that will decode the given row next, or the first row of its band if the image is wider
+    // than MAX_IMAGE_WIDTH
+    RowDecoder seek_row(const PackedImage& image, size_t row);
+
+    // Decodes the next row_count rows into rows, bytes_per_row bytes each
+    void decode_rows(RowDecoder& decoder, uint8_t* rows, size_t row_count);
+
+    // Copies SCREEN_WIDTH columns starting at column x of 8 rows of a 1bpp image into one page of the display buffer,
+    // wrapping around horizontally
+    void blit_page(uint8_t* page, const uint8_t* rows, size_t bytes_per_row, size_t x);
+
+    // Fills the display buffer with the screen-sized window of the image whose top left corner is (x, y),
+    // x wraps around the image width. Images wider than MAX_IMAGE_WIDTH leave the buffer cleared.
+    void blit_image(const PackedImage& image, size_t x, size_t y, Adafruit_SSD1306& display);
+
+    void display_image(const PackedImage& image, Adafruit_SSD1306& display);
     void print_up_arrow(Adafruit_SSD1306& display);
     void print_down_arrow(Adafruit_SSD1306& display);
 }
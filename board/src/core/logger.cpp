@@ -1,4 +1,6 @@
+#include <atomic>
 #include <stdarg.h>
+#include <string.h>
 #include <Arduino.h>
 
 #include "core/logger.hpp"
@@ -6,13 +8,38 @@
 #include "constants.hpp"
 
 namespace logger {
-    enum class LogLevel
-    {
-        INFO,
-        WARNING,
-        ERROR
+    constexpr size_t TASK_NAME_SIZE = 16; // configMAX_TASK_NAME_LEN
+    constexpr size_t LINE_SIZE = 320;
+    constexpr size_t SPEC_SIZE = 16;
+
+    static_assert((LOGGER_QUEUE_SIZE & (LOGGER_QUEUE_SIZE - 1)) == 0, "LOGGER_QUEUE_SIZE must be a power of two");
+    static_assert(LOGGER_ARGS_SIZE <= 255, "The size of the arguments is kept in a byte");
+
+    struct Message {
+        // Free for the producer at position p when it is p - index, ready for the consumer when it is p + 1 - index,
+        // so a zeroed queue is empty and messages can be queued before init()
+        std::atomic<uint32_t> sequence;
+        LogLevel level;
+        uint8_t args_size;
+        bool truncated; // The arguments didn't fit, the rest of the message is left out
+        uint64_t timestamp_us;
+        const char* fmt;
+        char task_name[TASK_NAME_SIZE];
+        uint8_t args[LOGGER_ARGS_SIZE];
     };
 
+    // Bounded multi-producer queue: producers claim a position with a compare and swap on enqueue_position and
+    // publish the message with its sequence, the logger task is the only consumer
+    Message queue[LOGGER_QUEUE_SIZE];
+    std::atomic<uint32_t> enqueue_position{0};
+    std::atomic<uint32_t> dropped{0};
+
+    // Only touched with drain_mutex held
+    uint32_t dequeue_position = 0;
+    uint32_t reported_dropped = 0;
+    SemaphoreHandle_t drain_mutex = nullptr;
+    TaskHandle_t logger_task_handle = nullptr;
+
     const char* LogLevel_to_cstr(LogLevel level) {
         switch (level) {
             case LogLevel::INFO:
@@ -39,42 +66,370 @@ namespace logger {
         }
     }
 
-    void log_message(LogLevel level, const char* fmt, va_list args) {
-        char buffer[256];
-        auto us = timekeeper::now_us();
-        auto seconds = us / 1000000;
-        auto micros = us % 1000000;
-        auto color = LogLevel_to_color_code(level);
-        auto task_name = pcTaskGetName(nullptr);
-        Serial.printf("[%lld.%06lld] (%s) [%s%s\033[0m] ", seconds, micros, task_name, color, LogLevel_to_cstr(level));
-        vsnprintf(buffer, sizeof(buffer), fmt, args);
-        buffer[sizeof(buffer) - 1] = '\0'; // Ensure null-termination
-        Serial.print(buffer);
-        Serial.println();
+    enum class ArgType
+    {
+        NONE, // %%
+        INT,
+        LONG,
+        LONG_LONG,
+        SIZE,
+        DOUBLE,
+        POINTER,
+        STRING,
+        UNSUPPORTED // %n, %Lf or a malformed conversion, the message ends there
+    };
+
+    struct Conversion {
+        const char* start; // The '%'
+        const char* end; // After the conversion character
+        ArgType type;
+        uint8_t stars; // Width and precision given as int arguments before the value
+    };
+
+    // Finds the next conversion of a printf format from fmt, returns false at the end of the string
+    bool next_conversion(const char* fmt, Conversion& conversion) {
+        const char* c = strchr(fmt, '%');
+        if (c == nullptr) {
+            return false;
+        }
+        conversion.start = c++;
+        conversion.stars = 0;
+        while (*c != '\0' && strchr("-+ #0", *c) != nullptr) {
+            c++;
+        }
+        if (*c == '*') {
+            conversion.stars++;
+            c++;
+        }
+        while (*c >= '0' && *c <= '9') {
+            c++;
+        }
+        if (*c == '.') {
+            c++;
+            if (*c == '*') {
+                conversion.stars++;
+                c++;
+            }
+            while (*c >= '0' && *c <= '9') {
+                c++;
+            }
+        }
+        int longs = 0;
+        bool size = false;
+        bool long_double = false;
+        while (*c != '\0' && strchr("hlzjtL", *c) != nullptr) {
+            longs += *c == 'l';
+            longs += *c == 'j' ? 2 : 0;
+            size |= *c == 'z' || *c == 't';
+            long_double |= *c == 'L';
+            c++;
+        }
+        if (*c == '\0') {
+            conversion.end = c;
+            conversion.type = ArgType::UNSUPPORTED;
+            return true;
+        }
+        conversion.end = c + 1;
+        switch (*c) {
+            case '%':
+                conversion.type = ArgType::NONE;
+                break;
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                conversion.type = size ? ArgType::SIZE : (longs >= 2 ? ArgType::LONG_LONG : (longs == 1 ? ArgType::LONG : ArgType::INT));
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                conversion.type = long_double ? ArgType::UNSUPPORTED : ArgType::DOUBLE;
+                break;
+            case 'p':
+                conversion.type = ArgType::POINTER;
+                break;
+            case 's':
+                conversion.type = ArgType::STRING;
+                break;
+            default:
+                conversion.type = ArgType::UNSUPPORTED;
+                break;
+        }
+        return true;
     }
 
-    void init() {
-        Serial.begin(MONITOR_SPEED);
+    template <typename T>
+    bool pack(Message& message, size_t& used, T value) {
+        if (used + sizeof(T) > LOGGER_ARGS_SIZE) {
+            return false;
+        }
+        memcpy(message.args + used, &value, sizeof(T));
+        used += sizeof(T);
+        return true;
     }
 
-    void info(const char* fmt, ...) {
-        va_list args;
-        va_start(args, fmt);
-        log_message(LogLevel::INFO, fmt, args);
-        va_end(args);
+    // Copies the arguments the format reads from args into the message, returns false if they didn't all fit
+    bool pack_args(Message& message, const char* fmt, va_list args) {
+        size_t used = 0;
+        Conversion conversion;
+        while (next_conversion(fmt, conversion)) {
+            fmt = conversion.end;
+            for (uint8_t i = 0; i < conversion.stars; ++i) {
+                if (!pack(message, used, va_arg(args, int))) {
+                    message.args_size = used;
+                    return false;
+                }
+            }
+            bool packed = true;
+            switch (conversion.type) {
+                case ArgType::NONE:
+                    break;
+                case ArgType::INT:
+                    packed = pack(message, used, va_arg(args, int));
+                    break;
+                case ArgType::LONG:
+                    packed = pack(message, used, va_arg(args, long));
+                    break;
+                case ArgType::LONG_LONG:
+                    packed = pack(message, used, va_arg(args, long long));
+                    break;
+                case ArgType::SIZE:
+                    packed = pack(message, used, va_arg(args, size_t));
+                    break;
+                case ArgType::DOUBLE:
+                    packed = pack(message, used, va_arg(args, double));
+                    break;
+                case ArgType::POINTER:
+                    packed = pack(message, used, va_arg(args, void*));
+                    break;
+                case ArgType::STRING: {
+                    // The string can be gone by the time the message is printed, a long one is cut to fit
+                    const char* string = va_arg(args, const char*);
+                    if (string == nullptr) {
+                        string = "(null)";
+                    }
+                    if (used >= LOGGER_ARGS_SIZE) {
+                        message.args_size = used;
+                        return false;
+                    }
+                    size_t length = strnlen(string, LOGGER_ARGS_SIZE - used - 1);
+                    memcpy(message.args + used, string, length);
+                    message.args[used + length] = '\0';
+                    used += length + 1;
+                    break;
+                }
+                default:
+                    packed = false;
+                    break;
+            }
+            if (!packed) {
+                message.args_size = used;
+                return false;
+            }
+        }
+        message.args_size = used;
+        return true;
     }
 
-    void warning(const char* fmt, ...) {
+    void log_message(LogLevel level, const char* fmt, ...) {
+        uint32_t position = enqueue_position.load(std::memory_order_relaxed);
+        Message* message;
+        uint32_t index;
+        while (true) {
+            index = position % LOGGER_QUEUE_SIZE;
+            message = &queue[index];
+            int32_t state = static_cast<int32_t>(message->sequence.load(std::memory_order_acquire) + index - position);
+            if (state == 0) {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (state < 0) {
+                // Still holding the message from a lap before, the logger task is behind
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+        message->level = level;
+        message->timestamp_us = timekeeper::now_us();
+        message->fmt = fmt;
+        strncpy(message->task_name, pcTaskGetName(nullptr), TASK_NAME_SIZE - 1);
+        message->task_name[TASK_NAME_SIZE - 1] = '\0';
         va_list args;
         va_start(args, fmt);
-        log_message(LogLevel::WARNING, fmt, args);
+        message->truncated = !pack_args(*message, fmt, args);
         va_end(args);
+        message->sequence.store(position + 1 - index, std::memory_order_release);
+        if (logger_task_handle != nullptr) {
+            xTaskNotifyGive(logger_task_handle);
+        }
     }
 
-    void error(const char* fmt, ...) {
-        va_list args;
-        va_start(args, fmt);
-        log_message(LogLevel::ERROR, fmt, args);
-        va_end(args);
+    template <typename T>
+    T unpack(const Message& message, size_t& used) {
+        T value;
+        memcpy(&value, message.args + used, sizeof(T));
+        used += sizeof(T);
+        return value;
+    }
+
+    template <typename T>
+    int format_value(char* out, size_t size, const char* spec, const int* stars, uint8_t star_count, T value) {
+        switch (star_count) {
+            case 0:
+                return snprintf(out, size, spec, value);
+            case 1:
+                return snprintf(out, size, spec, stars[0], value);
+            default:
+                return snprintf(out, size, spec, stars[0], stars[1], value);
+        }
+    }
+
+    // Formats the message after the header already in line, one conversion at a time from the packed arguments
+    size_t format_message(const Message& message, char* line, size_t length) {
+        const char* fmt = message.fmt;
+        size_t used = 0;
+        Conversion conversion;
+        bool cut = message.truncated;
+        while (length < LINE_SIZE - 1) {
+            bool found = next_conversion(fmt, conversion);
+            const char* text_end = found ? conversion.start : fmt + strlen(fmt);
+            size_t text = MIN(static_cast<size_t>(text_end - fmt), LINE_SIZE - 1 - length);
+            memcpy(line + length, fmt, text);
+            length += text;
+            if (!found) {
+                break;
+            }
+            fmt = conversion.end;
+            char spec[SPEC_SIZE];
+            size_t spec_length = conversion.end - conversion.start;
+            // Stop where the arguments were cut, unpacking past them would read garbage
+            size_t needed = conversion.stars * sizeof(int);
+            switch (conversion.type) {
+                case ArgType::INT: needed += sizeof(int); break;
+                case ArgType::LONG: needed += sizeof(long); break;
+                case ArgType::LONG_LONG: needed += sizeof(long long); break;
+                case ArgType::SIZE: needed += sizeof(size_t); break;
+                case ArgType::DOUBLE: needed += sizeof(double); break;
+                case ArgType::POINTER: needed += sizeof(void*); break;
+                case ArgType::STRING: needed += 1; break;
+                default: break;
+            }
+            if (conversion.type == ArgType::UNSUPPORTED || spec_length >= SPEC_SIZE || used + needed > message.args_size) {
+                cut = true;
+                break;
+            }
+            memcpy(spec, conversion.start, spec_length);
+            spec[spec_length] = '\0';
+            int stars[2] = {0, 0};
+            for (uint8_t i = 0; i < conversion.stars; ++i) {
+                stars[i] = unpack<int>(message, used);
+            }
+            char* out = line + length;
+            size_t size = LINE_SIZE - length;
+            int written = 0;
+            switch (conversion.type) {
+                case ArgType::NONE:
+                    written = snprintf(out, size, "%%");
+                    break;
+                case ArgType::INT:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<int>(message, used));
+                    break;
+                case ArgType::LONG:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<long>(message, used));
+                    break;
+                case ArgType::LONG_LONG:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<long long>(message, used));
+                    break;
+                case ArgType::SIZE:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<size_t>(message, used));
+                    break;
+                case ArgType::DOUBLE:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<double>(message, used));
+                    break;
+                case ArgType::POINTER:
+                    written = format_value(out, size, spec, stars, conversion.stars, unpack<void*>(message, used));
+                    break;
+                case ArgType::STRING: {
+                    const char* string = reinterpret_cast<const char*>(message.args + used);
+                    used += strlen(string) + 1;
+                    written = format_value(out, size, spec, stars, conversion.stars, string);
+                    break;
+                }
+                default:
+                    break;
+            }
+            length += MIN(static_cast<size_t>(written > 0 ? written : 0), size - 1);
+        }
+        if (cut && length < LINE_SIZE - 4) {
+            length += snprintf(line + length, LINE_SIZE - length, "...");
+        }
+        return MIN(length, LINE_SIZE - 1);
+    }
+
+    void print_message(const Message& message) {
+        char line[LINE_SIZE + 2];
+        auto seconds = message.timestamp_us / 1000000;
+        auto micros = message.timestamp_us % 1000000;
+        auto color = LogLevel_to_color_code(message.level);
+        int header = snprintf(line, LINE_SIZE, "[%lld.%06lld] (%s) [%s%s\033[0m] ", static_cast<long long>(seconds), static_cast<long long>(micros), message.task_name, color, LogLevel_to_cstr(message.level));
+        size_t length = format_message(message, line, MIN(static_cast<size_t>(header), LINE_SIZE - 1));
+        line[length++] = '\r';
+        line[length++] = '\n';
+        // One write per line, so the lines don't get mixed with the frames of the serial export
+        Serial.write(reinterpret_cast<const uint8_t*>(line), length);
+    }
+
+    void drain_locked() {
+        while (true) {
+            uint32_t index = dequeue_position % LOGGER_QUEUE_SIZE;
+            Message& message = queue[index];
+            if (message.sequence.load(std::memory_order_acquire) + index != dequeue_position + 1) {
+                break; // Empty, or the producer of the next message is still writing it
+            }
+            print_message(message);
+            message.sequence.store(dequeue_position + LOGGER_QUEUE_SIZE - index, std::memory_order_release);
+            dequeue_position++;
+        }
+        uint32_t dropped_now = dropped.load(std::memory_order_relaxed);
+        if (dropped_now != reported_dropped) {
+            Message report = {};
+            report.level = LogLevel::WARNING;
+            report.timestamp_us = timekeeper::now_us();
+            report.fmt = "%u log messages dropped, the queue was full.";
+            strncpy(report.task_name, pcTaskGetName(nullptr), TASK_NAME_SIZE - 1);
+            unsigned count = dropped_now - reported_dropped;
+            memcpy(report.args, &count, sizeof(count));
+            report.args_size = sizeof(count);
+            print_message(report);
+            reported_dropped = dropped_now;
+        }
+    }
+
+    void flush() {
+        if (drain_mutex == nullptr) {
+            return;
+        }
+        xSemaphoreTake(drain_mutex, portMAX_DELAY);
+        drain_locked();
+        Serial.flush();
+        xSemaphoreGive(drain_mutex);
+    }
+
+    uint32_t dropped_count() {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    void logger_task(void* param) {
+        while (true) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            xSemaphoreTake(drain_mutex, portMAX_DELAY);
+            drain_locked();
+            xSemaphoreGive(drain_mutex);
+        }
+    }
+
+    void init() {
+        Serial.begin(MONITOR_SPEED);
+        drain_mutex = xSemaphoreCreateMutex();
+        // Lowest priority, the serial port only gets the time no other task needs
+        xTaskCreate(logger_task, "LoggerTask", 3072, nullptr, 0, &logger_task_handle);
+        xTaskNotifyGive(logger_task_handle);
     }
-}
\ No newline at end of file
+}
@@ -1,8 +1,32 @@
 #pragma once
+#include <stdint.h>
+
+// Messages below this level are left out at compile time: 0 keeps everything, 1 drops info, 2 keeps only errors and
+// 3 drops every message, e.g. with -DLOG_LEVEL=1 in build_flags
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 0
+#endif
+
+// printf style logging through logger::log_message(). Macros so the arguments of a message left out by LOG_LEVEL
+// are not evaluated either, e.g. no String is built for it; they are still compiled, so they cannot go stale.
+#define LOG_INFO(...) do { if (LOG_LEVEL <= 0) { logger::log_message(logger::LogLevel::INFO, __VA_ARGS__); } } while (0)
+#define LOG_WARNING(...) do { if (LOG_LEVEL <= 1) { logger::log_message(logger::LogLevel::WARNING, __VA_ARGS__); } } while (0)
+#define LOG_ERROR(...) do { if (LOG_LEVEL <= 2) { logger::log_message(logger::LogLevel::ERROR, __VA_ARGS__); } } while (0)
 
 namespace logger {
+    enum class LogLevel
+    {
+        INFO,
+        WARNING,
+        ERROR
+    };
+
     void init();
-    void info(const char* fmt, ...);
-    void warning(const char* fmt, ...);
-    void error(const char* fmt, ...);
+    // Queues the message for the logger task and returns without formatting or waiting for the serial port. The
+    // arguments are captured as printf would read them, %s strings are copied. Dropped if the queue is full.
+    void log_message(LogLevel level, const char* fmt, ...);
+    // Prints the queued messages from the calling task, the queue is lost in deep sleep
+    void flush();
+    // Messages dropped because the queue was full since boot
+    uint32_t dropped_count();
 }
\ No newline at end of file
@@ -1,9 +1,14 @@
 #include <cstdint>
+#include <cstring>
 
 #include "core/menu.hpp"
 #include "core/events.hpp"
+#include "core/gestures.hpp"
 #include "core/sound.hpp"
 #include "core/image.hpp"
+#include "core/framebuffer.hpp"
+#include "core/widgets.hpp"
+#include "core/text.hpp"
 #include "apps/temperature.hpp"
 #include "apps/music.hpp"
 #include "apps/weather.hpp"
@@ -42,10 +47,22 @@
 
 namespace menu {
     static SemaphoreHandle_t status_mutex = nullptr;
+    static TaskHandle_t ui_task = nullptr; // Task running main_loop
     bool dirty = true;
+    uint64_t next_wakeup_us = UINT64_MAX; // Earliest deadline requested by the current app, only used by the UI task
+    uint64_t frame_period_us = 0; // 0 when redraws are not paced, see set_frame_rate, only written by the UI task with status_mutex held
+    uint64_t next_frame_us = 0; // Start of the next frame when paced, only used by the UI task
+    FrameStats frame_stats = {}; // Only used by the UI task
+    App last_app = App::NONE; // current_app during the previous iteration of main_loop
+    events::Event pending_gesture = { .type = events::EventType::NONE, {} }; // Completed by the last event wait_for_event returned
+    constexpr uint64_t deepsleep_retry_interval_us = 1000000; // How often to retry an aborted deep-sleep
     wifi::WiFiStatus last_wifi_status = wifi::WiFiStatus::DISCONNECTED;
     battery::BatteryLevel last_battery_level = battery::BatteryLevel::BATTERY_EMPTY;
     bool last_alarm_set = false; // True if an alarm is set
+    uint8_t titlebar_cache[SCREEN_WIDTH]; // The first page of the display buffer, as left by the last title bar drawn
+    char titlebar_cache_title[widgets::MAX_TEXT_LENGTH + 1];
+    uint32_t titlebar_cache_status = 0;
+    bool titlebar_cache_valid = false;
     
     App current_app = App::NONE;
     size_t cursor = 0;
@@ -163,63 +180,47 @@ namespace menu {
         }
     }
 
+    uint32_t titlebar_status() {
+        return static_cast<uint32_t>(last_wifi_status) |
+            (static_cast<uint32_t>(last_battery_level) << 8) |
+            (static_cast<uint32_t>(last_alarm_set) << 16);
+    }
+
     void draw_generic_titlebar(Adafruit_SSD1306 &display, const char *title)
     {
+        uint32_t status = titlebar_status();
+        // The title bar is the first page, longer titles are clipped before the end of the cached part
+        if (titlebar_cache_valid && titlebar_cache_status == status &&
+            strncmp(titlebar_cache_title, title, widgets::MAX_TEXT_LENGTH) == 0) {
+            memcpy(display.getBuffer(), titlebar_cache, SCREEN_WIDTH);
+        } else {
+            display.fillRect(0, 0, SCREEN_WIDTH, 8, SSD1306_WHITE);
+            text::print(display, text::GLYPH_WIDTH, 0, title, 1, SSD1306_BLACK);
+            draw_alarm_icon(display);
+            draw_battery_icon(display);
+            draw_wifi_icon(display);
+            memcpy(titlebar_cache, display.getBuffer(), SCREEN_WIDTH);
+            strncpy(titlebar_cache_title, title, widgets::MAX_TEXT_LENGTH);
+            titlebar_cache_title[widgets::MAX_TEXT_LENGTH] = '\0';
+            titlebar_cache_status = status;
+            titlebar_cache_valid = true;
+        }
+        // Leave the text settings as a println of the title would, the apps print under the title bar from here
         display.setTextSize(1);
-        display.fillRect(0, 0, SCREEN_WIDTH, 8, SSD1306_WHITE);
-        display.setTextColor(SSD1306_BLACK);
-        display.setCursor(0, 0);
-        display.print(" ");
-        display.println(title);
-        draw_alarm_icon(display);
-        draw_battery_icon(display);
-        draw_wifi_icon(display);
         display.setTextColor(SSD1306_WHITE);
+        display.setCursor(0, 8);
     }
 
+    widgets::Screen generic_menu_screen;
+    widgets::TitleBar generic_menu_titlebar;
+    widgets::List generic_menu_list;
+
     void draw_generic_menu(Adafruit_SSD1306 &display, const char *title, const char *const options[], size_t option_count, size_t selected_index)
     {
-        display.clearDisplay();
-        draw_generic_titlebar(display, title);
-        size_t start_index = 0;
-        size_t end_index = option_count; // Exclusive
-        bool can_scroll_up = false;
-        bool can_scroll_down = false;
-        if (option_count > 7) { // Only 7 options can fit on screen at once
-            if (selected_index < 4) {
-                start_index = 0;
-                end_index = 7;
-                can_scroll_down = true;
-            } else if (selected_index >= option_count - 4) {
-                start_index = option_count - 7;
-                end_index = option_count;
-                can_scroll_up = true;
-            } else {
-                start_index = selected_index - 3;
-                end_index = selected_index + 4;
-                can_scroll_up = true;
-                can_scroll_down = true;
-            }
-        }
-        for (size_t i = start_index; i < end_index; ++i) {
-            if (i == selected_index) {
-                display.print("> ");
-            } else {
-                display.print("  ");
-            }
-            display.println(options[i]);
-        }
-        if (can_scroll_up || can_scroll_down) {
-            // Draw a scrollbar
-            constexpr size_t padding = 1;
-            size_t max_scrollbar_height = 64 - 8 - padding * 2 - 2; // 8 pixels for titlebar + padding
-            display.drawRect(SCREEN_WIDTH - 4, 8 + padding, 4, max_scrollbar_height + 2, SSD1306_WHITE);
-            uint16_t scrollbar_height = max_scrollbar_height * 7 / option_count;
-            size_t max_offset = max_scrollbar_height - static_cast<size_t>(scrollbar_height);
-            uint16_t scrollbar_offset = max_offset * selected_index / (option_count - 1);
-            display.fillRect(SCREEN_WIDTH - 4, 8 + 1 + padding + scrollbar_offset, 4, scrollbar_height, SSD1306_WHITE);
-        }
-        display.display();
+        widgets::begin(generic_menu_screen, display);
+        widgets::draw_titlebar(generic_menu_screen, generic_menu_titlebar, title, display);
+        widgets::draw_list(generic_menu_screen, generic_menu_list, options, option_count, selected_index, display);
+        widgets::end(generic_menu_screen, display);
     }
 
     void generic_cursor_up(size_t &cursor, size_t option_count) {
@@ -291,38 +292,127 @@ namespace menu {
         draw_generic_menu(display, "Main Menu", menu_items, sizeof(menu_items)/sizeof(menu_items[0]), cursor);
     }
 
-    void status_update_task(void* param) {
-        while (true) {
-            wifi::WiFiStatus current_wifi_status = wifi::get_status();
-            battery::BatteryStatus current_battery_status = battery::get_battery_status();
-            bool alarm_is_set = apps::alarm::get_alarm_timestamp().timestamp != 0;
-            if (xSemaphoreTake(status_mutex, portMAX_DELAY)) {
-                if (current_wifi_status != last_wifi_status) {
-                    last_wifi_status = current_wifi_status;
-                    dirty = true;
-                }
-                if (current_battery_status.level != last_battery_level) {
-                    last_battery_level = current_battery_status.level;
-                    dirty = true;
-                }
-                if (alarm_is_set != last_alarm_set) {
-                    last_alarm_set = alarm_is_set;
-                    dirty = true;
-                }
-                xSemaphoreGive(status_mutex);
-            }
-            vTaskDelay(pdMS_TO_TICKS(UPDATE_STATUS_INTERVAL_MS)); // Update every 1 seconds
+    // Stores a status pushed by its source, with status_mutex held since set_dirty may run on another task
+    template <typename T>
+    void update_status(T& last, T current) {
+        bool changed = false;
+        if (xSemaphoreTake(status_mutex, portMAX_DELAY)) {
+            changed = last != current;
+            last = current;
+            xSemaphoreGive(status_mutex);
+        }
+        if (changed) {
+            set_dirty(); // Wakes up the UI task
         }
     }
 
+    void set_wifi_status(wifi::WiFiStatus status) {
+        update_status(last_wifi_status, status);
+    }
+
+    void set_battery_level(battery::BatteryLevel level) {
+        update_status(last_battery_level, level);
+    }
+
+    void set_alarm_set(bool alarm_set) {
+        update_status(last_alarm_set, alarm_set);
+    }
+
     void init() {
         status_mutex = xSemaphoreCreateMutex();
-        xTaskCreate(status_update_task, "StatusUpdate", 2048, nullptr, 1, nullptr);
+        ui_task = xTaskGetCurrentTaskHandle();
     }
 
-    void upkeep(Adafruit_SSD1306& display, uint64_t delay_ms) {
-        bool needs_redraw = false;
+    bool is_dirty() {
+        bool ret = true;
+        if (xSemaphoreTake(status_mutex, portMAX_DELAY)) {
+            ret = dirty;
+            xSemaphoreGive(status_mutex);
+        }
+        return ret;
+    }
+
+    events::Event wait_for_event() {
+        if (pending_gesture.type == events::EventType::GESTURE) {
+            events::Event gesture = pending_gesture;
+            pending_gesture.type = events::EventType::NONE;
+            return gesture;
+        }
+        uint64_t timeout_ms = 0; // Don't block if a redraw is pending and its frame has started
+        auto now = timekeeper::now_us();
+        if (!is_dirty() || (frame_period_us != 0 && next_frame_us > now)) {
+            auto deepsleep_deadline = events::get_last_event_timestamp() + TIME_BEFORE_DEEPSLEEP_US;
+            if (deepsleep_deadline <= now) {
+                deepsleep_deadline = now + deepsleep_retry_interval_us; // Deep-sleep was aborted, try again later
+            }
+            auto deadline = MIN(next_wakeup_us, deepsleep_deadline);
+            if (frame_period_us != 0) {
+                deadline = MIN(deadline, next_frame_us);
+            }
+            if (deadline > now) {
+                timeout_ms = (deadline - now + 999) / 1000; // Round up so we never wake up early
+            }
+        }
+        events::Event ev = events::get_next_event(timeout_ms);
+        gestures::recognize(ev, pending_gesture); // Returned by the next call
+        if (ev.type == events::EventType::NONE && next_wakeup_us <= timekeeper::now_us()) {
+            next_wakeup_us = UINT64_MAX; // Expired, the app will request a new one while handling this event
+        }
+        return ev;
+    }
+
+    void wake_up_at(uint64_t timestamp_us) {
+        next_wakeup_us = MIN(next_wakeup_us, timestamp_us);
+    }
+
+    void wake_up_in(uint64_t delay_us) {
+        wake_up_at(timekeeper::now_us() + delay_us);
+    }
+
+    void set_frame_rate(uint16_t fps) {
+        uint64_t period_us = fps == 0 ? 0 : 1000000 / fps;
+        if (period_us == frame_period_us) {
+            return;
+        }
         if (xSemaphoreTake(status_mutex, portMAX_DELAY)) {
+            frame_period_us = period_us;
+            xSemaphoreGive(status_mutex);
+        }
+        next_frame_us = timekeeper::now_us(); // Don't wait for a whole frame to show the first one
+    }
+
+    FrameStats get_frame_stats() {
+        return frame_stats;
+    }
+
+    void reset_frame_stats() {
+        frame_stats = {};
+    }
+
+    // True if a redraw may start now, moves on to the next frame when paced
+    bool start_frame(uint64_t now) {
+        if (events::has_pending_events()) {
+            return false; // Handle the input first, the redraw will show its result too
+        }
+        if (frame_period_us == 0) {
+            return true;
+        }
+        if (now < next_frame_us) {
+            return false;
+        }
+        uint64_t missed = (now - next_frame_us) / frame_period_us;
+        bool skipped = framebuffer::busy(); // The last frame is still waiting for the panel, don't replace it
+        if (is_dirty()) {
+            frame_stats.dropped_frames += missed + (skipped ? 1 : 0);
+        }
+        next_frame_us = (now / frame_period_us + 1) * frame_period_us;
+        return !skipped;
+    }
+
+    void upkeep(Adafruit_SSD1306& display) {
+        bool needs_redraw = false;
+        auto frame_start = timekeeper::now_us();
+        if (start_frame(frame_start) && xSemaphoreTake(status_mutex, portMAX_DELAY)) {
             needs_redraw = dirty;
             dirty = false;
             xSemaphoreGive(status_mutex);
@@ -338,12 +428,18 @@ namespace menu {
                     }
                     break;
             }
+            uint32_t render_us = timekeeper::now_us() - frame_start;
+            frame_stats.rendered_frames++;
+            frame_stats.last_render_us = render_us;
+            frame_stats.max_render_us = MAX(frame_stats.max_render_us, render_us);
+            if (frame_period_us != 0 && render_us > frame_period_us) {
+                frame_stats.over_budget_frames++;
+            }
         }
         auto last_event_timestamp = events::get_last_event_timestamp();
         if (last_event_timestamp + TIME_BEFORE_DEEPSLEEP_US < timekeeper::now_us()) {
             deepsleep::deepsleep(display);
         }
-        vTaskDelay(pdMS_TO_TICKS(delay_ms)); // Small delay to prevent busy looping
     }
 
     void cursor_up() {
@@ -363,7 +459,7 @@ namespace menu {
     }
 
     void main_menu(Adafruit_SSD1306& display) {
-        events::Event ev = events::get_next_event();
+        events::Event ev = wait_for_event();
         handle_generic_menu_navigation(ev, sizeof(menu_items)/sizeof(menu_items[0]), cursor, display, main_menu_actions);
         switch (ev.type) {
             case events::EventType::NONE:
@@ -376,14 +472,27 @@ namespace menu {
 
     void set_dirty()
     {
+        bool was_dirty = true;
+        bool paced = false;
         if (xSemaphoreTake(status_mutex, portMAX_DELAY)) {
+            was_dirty = dirty;
             dirty = true;
+            paced = frame_period_us != 0;
             xSemaphoreGive(status_mutex);
         }
+        // The UI task may be blocked in wait_for_event, unless it is the caller and will see the flag on its own
+        // or it is going to wake up for the next frame anyway
+        if (!was_dirty && !paced && xTaskGetCurrentTaskHandle() != ui_task) {
+            events::wake_up();
+        }
     }
 
     void main_loop(Adafruit_SSD1306 &display)
     {
+        if (current_app != last_app) {
+            last_app = current_app;
+            set_frame_rate(0); // The new app sets its own
+        }
         switch (current_app) {
             case App::NONE:
                 main_menu(display);
@@ -721,21 +830,78 @@ namespace menu {
                     default:
                         break;
                 }
+                break;
+            default:
+                break;
         }
         return event;
     }
 
+    constexpr int16_t KB_TEXT_HEIGHT = 10; // Text and cursor
+    constexpr int16_t KB_SEPARATOR_Y = 11;
+    constexpr int16_t KB_TOP = 13;
+    constexpr int16_t KB_ROW_HEIGHT = 8;
+
+    // Cell and label of a key, the special keys are as wide as their label and the others share the rest of the row
+    void get_kb_key(size_t key_index, bool shift_active, widgets::Bounds& bounds, const char*& label) {
+        uint8_t row = get_kb_row(key_index);
+        size_t row_min, row_max;
+        get_kb_min_max_index_for_row(row, row_min, row_max);
+        size_t cols = row_max - row_min + 1;
+        size_t special_keys = 0;
+        size_t special_keys_width = 0;
+        for (size_t i = row_min; i <= row_max; ++i) {
+            KBKey key = shift_active ? keyboard_layout.shifted[i] : keyboard_layout.normal[i];
+            auto len = strlen(kbkey_to_string(key));
+            if (len > 1) {
+                special_keys++;
+                special_keys_width += 6 * len;
+            }
+        }
+        // Rows made only of special keys have no space to share
+        size_t normal_keys = cols - special_keys;
+        auto size_per_key = normal_keys ? (SCREEN_WIDTH - special_keys_width) / normal_keys : 0;
+        auto extra_space = normal_keys ? (SCREEN_WIDTH - special_keys_width) % normal_keys : 0;
+        size_t extra_space_used = 0;
+        size_t x_offset = 0;
+        for (size_t i = row_min; i <= key_index; ++i) {
+            KBKey key = shift_active ? keyboard_layout.shifted[i] : keyboard_layout.normal[i];
+            label = kbkey_to_string(key);
+            auto chars = strlen(label);
+            size_t width = (chars > 1) ? (6 * chars) : size_per_key;
+            if (chars == 1 && extra_space_used < extra_space) {
+                width += 1;
+                extra_space_used++;
+            }
+            bounds = {
+                static_cast<int16_t>(x_offset),
+                static_cast<int16_t>(KB_TOP + row * KB_ROW_HEIGHT),
+                static_cast<int16_t>(width),
+                KB_ROW_HEIGHT
+            };
+            x_offset += width;
+        }
+    }
+
+    // The layout arrays are larger than the keys actually in the rows
+    size_t get_kb_key_count() {
+        size_t count = 0;
+        for (auto cols : keyboard_layout.cols_per_row) {
+            count += cols;
+        }
+        return count;
+    }
+
+    widgets::Screen keyboard_screen;
+    widgets::Label keyboard_text;
+    widgets::KeyboardGrid keyboard_grid = {get_kb_key_count(), get_kb_key, 0, false};
+
     void draw_keyboard(
         Adafruit_SSD1306& display, 
         const KBStatus& kb_status, 
         const String& input_buffer
     ) {
         auto shift_active = kb_status.caps_active || kb_status.shift_active;
-        auto selected_key = kb_status.selected_key;
-        display.clearDisplay();
-        display.setTextSize(1);
-        display.setTextColor(SSD1306_INVERSE);
-        display.setCursor(0, 0);
         auto max_shown_chars = SCREEN_WIDTH / 6 - 1;
         auto padding = (SCREEN_WIDTH - (max_shown_chars + 1) * 6) / 2; // Center the text
         size_t start_pos = 0;
@@ -743,56 +909,18 @@ namespace menu {
             start_pos = input_buffer.length() - max_shown_chars;
         }
         auto shown_chars = MIN(input_buffer.length(), max_shown_chars);
-        display.setCursor(padding, 0);
-        display.print(input_buffer.substring(start_pos, start_pos + max_shown_chars));
-        display.drawFastHLine(padding + shown_chars * 6, 9, 6, SSD1306_WHITE);
-        display.setTextColor(SSD1306_WHITE);
-        display.drawFastHLine(0, 11, SCREEN_WIDTH, SSD1306_WHITE);
-        size_t key_index = 0;
-        size_t y_offset = 13;
-        const size_t char_height = 8;
-        for (size_t row = 0; row < sizeof(keyboard_layout.cols_per_row)/sizeof(keyboard_layout.cols_per_row[0]); ++row) {
-            size_t cols = keyboard_layout.cols_per_row[row];
-            size_t x_offset = 0;
-            size_t special_keys = 0;
-            size_t special_keys_width = 0;
-            size_t key_index_backup = key_index;
-            for (size_t col = 0; col < cols; ++col) {
-                KBKey key = shift_active ? keyboard_layout.shifted[key_index] : keyboard_layout.normal[key_index];
-                auto str = kbkey_to_string(key);
-                auto len = strlen(str);
-                if (len > 1) {
-                    special_keys++;
-                    special_keys_width += 6 * len;
-                }
-                key_index++;
-            }
-            key_index = key_index_backup;
-            auto size_per_key = (SCREEN_WIDTH - special_keys_width) / (cols - special_keys);
-            auto extra_space = (SCREEN_WIDTH - special_keys_width) % (cols - special_keys);
-            uint8_t extra_space_used = 0;
-            for (size_t col = 0; col < cols; ++col) {
-                KBKey key = shift_active ? keyboard_layout.shifted[key_index] : keyboard_layout.normal[key_index];
-                auto str = kbkey_to_string(key);
-                auto chars = strlen(str);
-                size_t width = (chars > 1) ? (6 * chars) : size_per_key;
-                if (chars == 1 && extra_space_used < extra_space) {
-                    width += 1;
-                    extra_space_used++;
-                }
-                display.setTextColor(SSD1306_INVERSE);
-                if (key_index == selected_key) {
-                    display.fillRect(x_offset, y_offset, width, char_height, SSD1306_WHITE);
-                }
-                auto char_start_x = x_offset + (width - (6 * chars)) / 2;
-                display.setCursor(char_start_x, y_offset);
-                display.print(str);
-                x_offset += width;
-                key_index++;
-            }
-            y_offset += char_height;
+
+        widgets::begin(keyboard_screen, display);
+        if (!keyboard_screen.retained) {
+            display.drawFastHLine(0, KB_SEPARATOR_Y, SCREEN_WIDTH, SSD1306_WHITE);
+        }
+        keyboard_text.bounds = {static_cast<int16_t>(padding), 0, static_cast<int16_t>(SCREEN_WIDTH - padding), KB_TEXT_HEIGHT};
+        String shown_text = input_buffer.substring(start_pos, start_pos + max_shown_chars);
+        if (widgets::draw_label(keyboard_screen, keyboard_text, shown_text.c_str(), display)) {
+            display.drawFastHLine(padding + shown_chars * 6, 9, 6, SSD1306_WHITE); // Cursor
         }
-        display.display();
+        widgets::draw_keyboard_grid(keyboard_screen, keyboard_grid, kb_status.selected_key, shift_active, display);
+        widgets::end(keyboard_screen, display);
     }
 
     BooleanSwitchEvent handle_boolean_switch_input(
@@ -841,9 +969,19 @@ namespace menu {
         return event;
     }
 
+    widgets::Screen boolean_switch_screen;
+    widgets::TitleBar boolean_switch_titlebar;
+    bool boolean_switch_value = false; // Last drawn value
+
     void draw_boolean_switch(Adafruit_SSD1306& display, const char* title, bool value) {
-        display.clearDisplay();
-        draw_generic_titlebar(display, title);
+        widgets::begin(boolean_switch_screen, display);
+        widgets::draw_titlebar(boolean_switch_screen, boolean_switch_titlebar, title, display);
+        if (boolean_switch_screen.retained && boolean_switch_value == value) {
+            widgets::end(boolean_switch_screen, display);
+            return;
+        }
+        boolean_switch_value = value;
+        display.fillRect(30, 25, 60, 30, SSD1306_BLACK);
         display.setTextColor(SSD1306_INVERSE);
         display.drawRoundRect(30, 25, 60, 30, 16, SSD1306_WHITE);
         if (value) {
@@ -856,7 +994,8 @@ namespace menu {
             display.setCursor(68, 37);
             display.print("OFF");
         }
-        display.display();
+        display.setTextColor(SSD1306_WHITE);
+        widgets::end(boolean_switch_screen, display);
     }
 
     ConfirmationDialogResult handle_confirmation_dialog_input(
@@ -887,10 +1026,19 @@ namespace menu {
         return result;
     }
 
+    widgets::Screen confirmation_dialog_screen;
+    const char* confirmation_dialog_message = nullptr; // Last drawn message
+
     void draw_confirmation_dialog(
         Adafruit_SSD1306& display, 
         const char* message
     ) {
+        widgets::begin(confirmation_dialog_screen, display);
+        if (confirmation_dialog_screen.retained && confirmation_dialog_message == message) {
+            widgets::end(confirmation_dialog_screen, display);
+            return; // Nothing in the dialog changes while it is open
+        }
+        confirmation_dialog_message = message;
         display.clearDisplay();
         display.setTextSize(1);
         display.setTextColor(SSD1306_WHITE);
@@ -899,6 +1047,6 @@ namespace menu {
         display.drawFastHLine(0, 53, SCREEN_WIDTH, SSD1306_WHITE);
         display.setCursor(16, 55);
         display.print("A: Yes   B: No");
-        display.display();
+        widgets::end(confirmation_dialog_screen, display);
     }
 }
\ No newline at end of file
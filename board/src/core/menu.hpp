@@ -3,6 +3,8 @@
 #include <Adafruit_SSD1306.h>
 
 #include "core/events.hpp"
+#include "core/battery.hpp"
+#include "core/wifi.hpp"
 
 namespace menu {
     enum class App {
@@ -36,8 +38,48 @@ namespace menu {
     // Initialize the menu system and related tasks
     void init();
 
-    // This function is called when there is no event to process
-    void upkeep(Adafruit_SSD1306& display, uint64_t delay_ms = 100);
+    // Blocks until the current app has something to do: a button event, a redraw request from set_dirty()
+    // or a deadline requested with wake_up_at()/wake_up_in(). Returns an EventType::NONE event when
+    // woken up by anything other than a button event, apps should then call upkeep().
+    // An EventType::GESTURE event follows the button event that completed a gesture.
+    events::Event wait_for_event();
+
+    // Request wait_for_event() to return no later than timestamp_us (see timekeeper::now_us()).
+    // Only the earliest pending deadline is kept, it is cleared once it expires.
+    void wake_up_at(uint64_t timestamp_us);
+
+    // Request wait_for_event() to return no later than delay_us microseconds from now.
+    void wake_up_in(uint64_t delay_us);
+
+    // This function is called when there is no event to process, it redraws the display if needed.
+    // Redraws are held back while button events are waiting, so that input is never queued behind a frame
+    // and several set_dirty() calls end up in a single frame.
+    void upkeep(Adafruit_SSD1306& display);
+
+    // Target frame rate of the current app, reset to 0 whenever the current app changes.
+    // With 0 upkeep() redraws as soon as set_dirty() is called. Otherwise frames start at multiples of the frame
+    // period (1 s / fps since boot), upkeep() redraws at most once per frame and wait_for_event() returns at the
+    // start of every frame, so animations can advance before calling upkeep(). Frames are skipped and counted as
+    // dropped when a redraw took longer than the frame period or the last frame is still waiting for the panel.
+    void set_frame_rate(uint16_t fps);
+
+    struct FrameStats {
+        uint32_t rendered_frames; // Redraws done by upkeep()
+        uint32_t dropped_frames; // Frame starts skipped while a redraw was pending
+        uint32_t over_budget_frames; // Redraws longer than the frame period of the app
+        uint32_t last_render_us; // Time spent in the last redraw, flush included
+        uint32_t max_render_us;
+    };
+
+    // Counters of the redraws since boot or since reset_frame_stats()
+    FrameStats get_frame_stats();
+
+    void reset_frame_stats();
+
+    // Called by the status sources when what the title bar shows changes, the display is redrawn only if it did
+    void set_wifi_status(wifi::WiFiStatus status);
+    void set_battery_level(battery::BatteryLevel level);
+    void set_alarm_set(bool alarm_set);
 
     // Draw the WiFi icon based on the last known WiFi status
     void draw_wifi_icon(Adafruit_SSD1306& display);
@@ -45,10 +87,13 @@ namespace menu {
     // Draw the battery icon based on the last known battery level
     void draw_battery_icon(Adafruit_SSD1306& display);
 
-    // Helper to draw a title bar
+    // State shown by the title bar icons, changes whenever they need a redraw
+    uint32_t titlebar_status();
+
+    // Helper to draw a title bar, it is copied from a cache unless the title or the status changed since the last one
     void draw_generic_titlebar(Adafruit_SSD1306& display, const char* title);
 
-    // Helper to unify drawing of multi-option menus
+    // Helper to unify drawing of multi-option menus, only redraws what changed since the last call (see core/widgets.hpp)
     void draw_generic_menu(Adafruit_SSD1306& display, const char* title, const char *const options[], size_t option_count, size_t selected_index);
 
     // Helper to move cursor up in multi-option menus
@@ -0,0 +1,172 @@
+#include <WiFi.h>
+#include <algorithm>
+#include <atomic>
+
+#include "core/network.hpp"
+#include "core/wifi.hpp"
+#include "core/battery.hpp"
+#include "core/menu.hpp"
+#include "core/logger.hpp"
+#include "core/timekeeper.hpp"
+#include "apps/settings.hpp"
+#include "constants.hpp"
+
+namespace network {
+    uint64_t Backoff::failed() {
+        uint64_t delay_ms = NETWORK_BACKOFF_CAP_MS;
+        if (failures < 32 && (NETWORK_BACKOFF_BASE_MS << failures) < NETWORK_BACKOFF_CAP_MS) {
+            delay_ms = NETWORK_BACKOFF_BASE_MS << failures;
+        }
+        failures++;
+        return delay_ms / 2 + static_cast<uint64_t>(random(static_cast<long>(delay_ms / 2) + 1));
+    }
+
+    struct ScheduledJob {
+        Job job;
+        Backoff backoff;
+        uint64_t retry_at_ms; // timekeeper::now_us() in ms before which a failed job is not run again
+    };
+
+    // Only the scheduler task touches the backoff state, the count is published after the job is written
+    ScheduledJob jobs[MAX_NETWORK_JOBS];
+    std::atomic<size_t> job_count{0};
+
+    // The connection backoff survives deep sleep, timekeeper::now_us() keeps counting through it, so a watch that
+    // keeps waking up away from its access point does not try to connect on every wake up
+    RTC_DATA_ATTR Backoff connect_backoff;
+    RTC_DATA_ATTR uint64_t connect_retry_at_ms;
+
+    TaskHandle_t network_task_handle = nullptr;
+
+    uint64_t now_ms() {
+        return timekeeper::now_us() / 1000;
+    }
+
+    // Time until the job should run, its own schedule or its backoff, whichever is later
+    uint64_t wait_ms(const ScheduledJob& scheduled, uint64_t now) {
+        uint64_t due_in = scheduled.job.due_in_ms();
+        if (scheduled.retry_at_ms > now) {
+            due_in = std::max(due_in, scheduled.retry_at_ms - now);
+        }
+        return due_in;
+    }
+
+    // Polls the link for a while after WiFi.begin(), gives up early if the access point is not there
+    bool wait_for_connection() {
+        constexpr uint64_t CONNECT_POLL_INTERVAL_MS = 500;
+        constexpr uint64_t CONNECT_TIMEOUT_MS = 10000;
+        for (uint64_t waited_ms = 0; waited_ms < CONNECT_TIMEOUT_MS; waited_ms += CONNECT_POLL_INTERVAL_MS) {
+            wl_status_t status = WiFi.status();
+            if (status == WL_CONNECTED) {
+                return true;
+            }
+            if (status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED) {
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(CONNECT_POLL_INTERVAL_MS));
+        }
+        return WiFi.status() == WL_CONNECTED;
+    }
+
+    void radio_off() {
+        if (WiFi.getMode() != WIFI_OFF) {
+            WiFi.disconnect(true, true); // Disconnect and erase AP
+            WiFi.mode(WIFI_OFF);
+        }
+    }
+
+    // Runs the jobs due now or within NETWORK_COALESCE_MS, in registration order, so a job that depends on an
+    // earlier one (e.g. on the clock set by NTP) can become due in the same window
+    void run_window() {
+        size_t count = job_count.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            ScheduledJob& scheduled = jobs[i];
+            uint64_t now = now_ms();
+            if (wait_ms(scheduled, now) > NETWORK_COALESCE_MS) {
+                continue;
+            }
+            if (scheduled.job.run()) {
+                scheduled.backoff.succeeded();
+                scheduled.retry_at_ms = 0;
+            } else {
+                uint64_t delay_ms = scheduled.backoff.failed();
+                scheduled.retry_at_ms = now_ms() + delay_ms;
+                LOG_WARNING("Network job %s failed, retrying in %u s", scheduled.job.name, static_cast<unsigned>(delay_ms / 1000));
+            }
+        }
+    }
+
+    void network_task(void* param) {
+        WiFi.hostname("WatchMan");
+        radio_off(); // Until a job needs it
+        while (true) {
+            apps::settings::Settings settings = apps::settings::get_settings();
+            if (!settings.wifi_enabled) {
+                radio_off();
+                menu::set_wifi_status(wifi::get_status());
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Until wake()
+                continue;
+            }
+
+            uint64_t now = now_ms();
+            uint64_t wait = NETWORK_IDLE_CHECK_MS;
+            size_t count = job_count.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count; ++i) {
+                wait = std::min(wait, wait_ms(jobs[i], now));
+            }
+            if (wait == 0 && connect_retry_at_ms > now) {
+                wait = connect_retry_at_ms - now;
+            }
+            if (wait == 0) {
+                battery::BatteryLevel level = battery::get_battery_status().level;
+                if (level == battery::BatteryLevel::BATTERY_LOW || level == battery::BatteryLevel::BATTERY_EMPTY) {
+                    LOG_INFO("Battery low, network window skipped");
+                    wait = NETWORK_IDLE_CHECK_MS;
+                }
+            }
+            if (wait > 0) {
+                menu::set_wifi_status(wifi::get_status());
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait)); // Or until wake()
+                continue;
+            }
+
+            WiFi.mode(WIFI_STA);
+            WiFi.begin(settings.wifi_ssid, settings.wifi_password);
+            bool connected = wait_for_connection();
+            menu::set_wifi_status(wifi::get_status());
+            if (connected) {
+                connect_backoff.succeeded();
+                connect_retry_at_ms = 0;
+                run_window();
+            } else {
+                uint64_t delay_ms = connect_backoff.failed();
+                connect_retry_at_ms = now_ms() + delay_ms;
+                LOG_WARNING("WiFi connection failed, retrying in %u s", static_cast<unsigned>(delay_ms / 1000));
+            }
+            radio_off();
+            menu::set_wifi_status(wifi::get_status());
+        }
+    }
+
+    void add_job(const Job& job) {
+        size_t count = job_count.load(std::memory_order_relaxed);
+        if (count >= MAX_NETWORK_JOBS) {
+            LOG_ERROR("Too many network jobs, %s not added", job.name);
+            return;
+        }
+        jobs[count] = ScheduledJob{job, Backoff{0}, 0};
+        job_count.store(count + 1, std::memory_order_release);
+        wake();
+    }
+
+    void wake() {
+        if (network_task_handle != nullptr) {
+            xTaskNotifyGive(network_task_handle);
+        }
+    }
+
+    void init() {
+        // The jobs use HTTPS and ArduinoJson from this task
+        xTaskCreate(network_task, "NetworkTask", 8192, nullptr, 1, &network_task_handle);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+// Network scheduler: the modules that need the network register jobs instead of keeping the radio on themselves.
+// The scheduler task turns the radio on only when a job is due, runs every job due within NETWORK_COALESCE_MS in
+// that one radio-on window and turns the radio off again. Failed connections and failed jobs are retried with a
+// jittered exponential backoff, and no window is opened while the battery is low.
+namespace network {
+    // The n-th failure in a row waits a random time between half and all of NETWORK_BACKOFF_BASE_MS * 2^n, capped
+    // at NETWORK_BACKOFF_CAP_MS, so devices that lost the same access point do not retry in lockstep
+    struct Backoff {
+        uint32_t failures;
+
+        // Counts a failure and returns the delay before the next attempt
+        uint64_t failed();
+
+        void succeeded() {
+            failures = 0;
+        }
+    };
+
+    struct Job {
+        const char* name;
+        // Milliseconds until the job has work to do, 0 if due now and UINT64_MAX if it has none. Called by the
+        // scheduler task with the radio off, so it must not use the network.
+        uint64_t (*due_in_ms)();
+        // Does the work with WiFi connected, returns false to be retried with backoff
+        bool (*run)();
+    };
+
+    // Adds a job for the scheduler task, at most MAX_NETWORK_JOBS. Call after init().
+    void add_job(const Job& job);
+
+    // Makes the scheduler look at its jobs and the WiFi settings right away
+    void wake();
+
+    // Starts the scheduler task, call after menu::init()
+    void init();
+}
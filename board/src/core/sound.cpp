@@ -71,7 +71,7 @@ namespace sound {
     void async_play_interruptible_melody(const Note *melody, size_t length, bool loop)
     {
         if (async_melody_task_queue == nullptr) {
-            logger::warning("Async melody task not initialized");
+            LOG_WARNING("Async melody task not initialized");
             return; // Task not initialized
         }
         AsyncMelodyCommand command = {
@@ -82,7 +82,7 @@ namespace sound {
             }
         };
         if (xQueueSend(async_melody_task_queue, &command, 0) != pdTRUE) {
-            logger::warning("Async melody task queue full, dropping melody");
+            LOG_WARNING("Async melody task queue full, dropping melody");
         }
     }
 
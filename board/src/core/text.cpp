@@ -0,0 +1,106 @@
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <Arduino.h>
+
+#include "core/text.hpp"
+#include "fonts/classic.hpp"
+#include "constants.hpp"
+
+namespace text {
+    constexpr size_t GLYPH_COUNT = fonts::classic_last_char - fonts::classic_first_char + 1;
+    constexpr int16_t WIDTH = SCREEN_WIDTH; // Signed, text can start left of the screen
+    constexpr int16_t PAGE_COUNT = SCREEN_HEIGHT / 8;
+
+    // Size 2 columns: every font column with each dot doubled vertically, drawn twice side by side
+    uint16_t large_glyphs[GLYPH_COUNT][fonts::classic_width];
+    bool large_glyphs_ready = false;
+
+    void prepare_large_glyphs() {
+        for (size_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+            for (size_t column = 0; column < fonts::classic_width; column++) {
+                uint8_t dots = fonts::classic[glyph][column];
+                uint16_t stretched = 0;
+                for (size_t dot = 0; dot < 8; dot++) {
+                    if (dots & (1 << dot)) {
+                        stretched |= 0b11 << (dot * 2);
+                    }
+                }
+                large_glyphs[glyph][column] = stretched;
+            }
+        }
+        large_glyphs_ready = true;
+    }
+
+    // Writes a column of dots, LSB at the top, into the one to three pages it overlaps
+    void write_column(uint8_t* buffer, int16_t x, int16_t y, uint32_t dots, uint16_t color) {
+        if (x < 0 || x >= WIDTH) {
+            return;
+        }
+        int16_t page = y >> 3; // Rounds down for negative y too
+        dots <<= y & 7;
+        for (; dots != 0 && page < PAGE_COUNT; page++, dots >>= 8) {
+            if (page < 0) {
+                continue;
+            }
+            uint8_t& destination = buffer[page * WIDTH + x];
+            uint8_t bits = dots & 0xFF;
+            switch (color) {
+                case SSD1306_WHITE:
+                    destination |= bits;
+                    break;
+                case SSD1306_BLACK:
+                    destination &= ~bits;
+                    break;
+                case SSD1306_INVERSE:
+                    destination ^= bits;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    int16_t print(Adafruit_SSD1306& display, int16_t x, int16_t y, const char* str, uint8_t size, uint16_t color) {
+        uint8_t* buffer = display.getBuffer();
+        if (size == 2 && !large_glyphs_ready) {
+            prepare_large_glyphs();
+        }
+        for (; *str != '\0'; str++) {
+            unsigned char c = *str;
+            if (c == '\n') { // Same as print
+                x = 0;
+                y += size * GLYPH_HEIGHT;
+                continue;
+            }
+            if (c == '\r') {
+                continue;
+            }
+            if (c < fonts::classic_first_char || c > fonts::classic_last_char || (size != 1 && size != 2)) {
+                display.drawChar(x, y, c, color, color, size);
+            } else if (x < WIDTH && x + size * GLYPH_WIDTH > 0) {
+                size_t glyph = c - fonts::classic_first_char;
+                for (size_t column = 0; column < fonts::classic_width; column++) {
+                    if (size == 1) {
+                        write_column(buffer, x + column, y, fonts::classic[glyph][column], color);
+                    } else {
+                        uint16_t dots = large_glyphs[glyph][column];
+                        write_column(buffer, x + column * 2, y, dots, color);
+                        write_column(buffer, x + column * 2 + 1, y, dots, color);
+                    }
+                }
+            }
+            x += size * GLYPH_WIDTH;
+        }
+        return x;
+    }
+
+    int16_t printf(Adafruit_SSD1306& display, int16_t x, int16_t y, uint8_t size, uint16_t color, const char* format, ...) {
+        char buffer[64];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return print(display, x, y, buffer, size, color);
+    }
+}
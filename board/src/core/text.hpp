@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <Adafruit_SSD1306.h>
+
+// Text in the classic font written straight into the display buffer. The glyph columns are kept prerendered as
+// buffer bytes for sizes 1 and 2, so a glyph costs a few byte stores instead of a drawPixel or fillRect per dot.
+// Expects the display not to be rotated.
+namespace text {
+    constexpr int16_t GLYPH_WIDTH = 6; // Including the spacing column
+    constexpr int16_t GLYPH_HEIGHT = 8;
+
+    // Draws str with its top left corner at (x, y) like display.print with a transparent background, but what
+    // doesn't fit is clipped instead of wrapped. color is SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    // Other sizes and characters outside of printable ASCII fall back to display.drawChar.
+    // Returns the x of the next character, the display cursor is not used nor moved.
+    int16_t print(Adafruit_SSD1306& display, int16_t x, int16_t y, const char* str, uint8_t size = 1, uint16_t color = SSD1306_WHITE);
+
+    // Same as print with the text formatted like printf, up to 63 characters
+    int16_t printf(Adafruit_SSD1306& display, int16_t x, int16_t y, uint8_t size, uint16_t color, const char* format, ...)
+        __attribute__((format(printf, 6, 7)));
+}
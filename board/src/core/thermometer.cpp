@@ -0,0 +1,157 @@
+#include <math.h>
+#include <Arduino.h>
+#include <OneWire.h>
+#include <DallasTemperature.h>
+
+#include "core/thermometer.hpp"
+#include "core/timekeeper.hpp"
+#include "constants.hpp"
+
+namespace thermometer {
+    OneWire one_wire(TMP_PIN);
+    DallasTemperature sensors(&one_wire);
+
+    // Only touched by the task
+    DeviceAddress addresses[MAX_SENSORS];
+    size_t found_sensors = 0;
+    uint8_t applied_resolution = 0;
+
+    // Published to the UI
+    SemaphoreHandle_t readings_mutex = nullptr;
+    Reading internal_reading = {NAN, 0};
+    Reading external_readings[MAX_SENSORS] = {};
+    size_t published_sensor_count = 0;
+    volatile uint8_t resolution = TEMPERATURE_RESOLUTION_BITS;
+
+    Reading get_internal() {
+        xSemaphoreTake(readings_mutex, portMAX_DELAY);
+        Reading reading = internal_reading;
+        xSemaphoreGive(readings_mutex);
+        return reading;
+    }
+
+    Reading get_external(size_t index) {
+        Reading reading = {NAN, 0};
+        xSemaphoreTake(readings_mutex, portMAX_DELAY);
+        if (index < published_sensor_count) {
+            reading = external_readings[index];
+        }
+        xSemaphoreGive(readings_mutex);
+        return reading;
+    }
+
+    size_t sensor_count() {
+        xSemaphoreTake(readings_mutex, portMAX_DELAY);
+        size_t count = published_sensor_count;
+        xSemaphoreGive(readings_mutex);
+        return count;
+    }
+
+    void set_resolution(uint8_t bits) {
+        resolution = bits < 9 ? 9 : (bits > 12 ? 12 : bits);
+    }
+
+    uint8_t get_resolution() {
+        return resolution;
+    }
+
+    void scan_bus() {
+        sensors.begin();
+        sensors.setWaitForConversion(false); // The task sleeps through the conversion instead
+        found_sensors = 0;
+        size_t count = MIN(sensors.getDeviceCount(), MAX_SENSORS);
+        for (size_t i = 0; i < count; ++i) {
+            if (sensors.getAddress(addresses[found_sensors], i)) {
+                found_sensors++;
+            }
+        }
+        applied_resolution = 0;
+    }
+
+    // Returns false if a sensor didn't answer, so the bus is scanned again before the next conversion
+    bool read_external_sensors() {
+        uint8_t bits = resolution;
+        if (bits != applied_resolution) {
+            for (size_t i = 0; i < found_sensors; ++i) {
+                sensors.setResolution(addresses[i], bits);
+            }
+            applied_resolution = bits;
+        }
+        // One conversion for the whole bus, the sensors convert in parallel
+        sensors.requestTemperatures();
+        vTaskDelay(pdMS_TO_TICKS(DallasTemperature::millisToWaitForConversion(bits)));
+        float temperatures[MAX_SENSORS];
+        bool all_connected = true;
+        for (size_t i = 0; i < found_sensors; ++i) {
+            temperatures[i] = sensors.getTempC(addresses[i]);
+            if (temperatures[i] == DEVICE_DISCONNECTED_C) {
+                temperatures[i] = NAN;
+                all_connected = false;
+            }
+        }
+        uint64_t now = timekeeper::now_us();
+        xSemaphoreTake(readings_mutex, portMAX_DELAY);
+        for (size_t i = 0; i < found_sensors; ++i) {
+            external_readings[i] = {temperatures[i], now};
+        }
+        published_sensor_count = found_sensors;
+        xSemaphoreGive(readings_mutex);
+        return all_connected;
+    }
+
+    // Only touched by the task, or by read_once() before it starts
+    bool rescan = true;
+    volatile bool first_cycle_done = false;
+
+    // Reads the internal temperature and every sensor on the bus, sleeping through the conversion
+    void read_all() {
+        float internal = temperatureRead();
+        uint64_t now = timekeeper::now_us();
+        xSemaphoreTake(readings_mutex, portMAX_DELAY);
+        internal_reading = {internal, now};
+        xSemaphoreGive(readings_mutex);
+        if (rescan) {
+            scan_bus();
+        }
+        if (found_sensors > 0) {
+            rescan = !read_external_sensors();
+        } else {
+            xSemaphoreTake(readings_mutex, portMAX_DELAY);
+            published_sensor_count = 0;
+            xSemaphoreGive(readings_mutex);
+            rescan = true; // Sensors can be plugged in later
+        }
+        first_cycle_done = true;
+    }
+
+    bool ready() {
+        return first_cycle_done;
+    }
+
+    void thermometer_task(void* param) {
+        while (true) {
+            TickType_t start = xTaskGetTickCount();
+            read_all();
+            // The conversion time is part of the interval
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            TickType_t interval = pdMS_TO_TICKS(TEMPERATURE_SAMPLE_INTERVAL_MS);
+            vTaskDelay(elapsed < interval ? interval - elapsed : 1);
+        }
+    }
+
+    void create_mutex() {
+        if (readings_mutex == nullptr) {
+            readings_mutex = xSemaphoreCreateMutex();
+        }
+    }
+
+    void read_once() {
+        create_mutex();
+        read_all();
+    }
+
+    void init() {
+        create_mutex();
+        xTaskCreate(thermometer_task, "ThermometerTask", 2048, nullptr, 1, nullptr);
+    }
+}
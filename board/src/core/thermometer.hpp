@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Background acquisition of the internal temperature and of the DS18B20 sensors on TMP_PIN. The task starts a
+// conversion on every sensor at once, sleeps for the conversion time of the resolution and then reads them, so
+// the UI only ever reads the last published values and never waits on the 1-Wire bus.
+namespace thermometer {
+    constexpr size_t MAX_SENSORS = 4;
+
+    struct Reading {
+        float celsius; // NAN if there is no valid reading
+        uint64_t timestamp_us; // timekeeper::now_us() of the reading, 0 if never read
+    };
+
+    // Last internal temperature of the chip
+    Reading get_internal();
+
+    // Last reading of the external sensor, in the order they were found on the bus
+    Reading get_external(size_t index);
+
+    // Number of external sensors found in the last bus scan
+    size_t sensor_count();
+
+    // Resolution of the external sensors, from 9 bits (0.5 C, 94 ms per conversion) to 12 bits (0.0625 C, 750 ms).
+    // Applied from the next conversion.
+    void set_resolution(uint8_t bits);
+
+    uint8_t get_resolution();
+
+    // True once the internal temperature and every sensor found have been read
+    bool ready();
+
+    // Takes one reading of every sensor from the calling task, waiting for the conversion. For a wake up that only
+    // needs one sample and goes back to sleep, without starting the task.
+    void read_once();
+
+    // Starts the acquisition task, readings are taken every TEMPERATURE_SAMPLE_INTERVAL_MS
+    void init();
+}
@@ -0,0 +1,180 @@
+#include <cstdint>
+#include <cstring>
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "core/tilemap.hpp"
+#include "core/image.hpp"
+#include "core/logger.hpp"
+#include "maps/earth.hpp"
+#include "constants.hpp"
+
+namespace tilemap {
+    // Must match gen_map_tiles.py
+    constexpr uint16_t FORMAT_VERSION = 1;
+    constexpr size_t TILE_SIZE = 64;
+    constexpr size_t TILE_ROW_BYTES = TILE_SIZE / 8;
+    constexpr size_t TILE_BYTES = TILE_ROW_BYTES * TILE_SIZE;
+    constexpr size_t MAX_PACKED_TILE_BYTES = TILE_BYTES + (TILE_BYTES + 127) / 128; // PackBits worst case
+    constexpr size_t HEADER_SIZE = 12;
+    constexpr size_t LEVEL_ENTRY_SIZE = 8;
+    constexpr size_t MAX_LEVELS = 8;
+    constexpr uint8_t MAPS_PARTITION_SUBTYPE = 0x40; // See partitions.csv
+
+    constexpr size_t CACHE_SIZE = 8; // A viewport overlaps at most 3x2 tiles
+    // Tiles a screen row overlaps
+    constexpr size_t STRIP_TILES = static_cast<size_t>(SCREEN_WIDTH) / TILE_SIZE + 1;
+    constexpr size_t STRIP_BYTES = STRIP_TILES * TILE_ROW_BYTES;
+
+    struct Level {
+        uint16_t width;
+        uint16_t height;
+        uint32_t index_offset;
+    };
+
+    struct CachedTile {
+        bool valid;
+        uint8_t level;
+        uint16_t index;
+        uint32_t last_used;
+        uint8_t pixels[TILE_BYTES];
+    };
+
+    const esp_partition_t* partition = nullptr; // nullptr when using the levels built into the firmware
+    Level levels[MAX_LEVELS];
+    size_t loaded_levels = 0;
+    CachedTile cache[CACHE_SIZE] = {};
+    uint32_t cache_clock = 0;
+
+    bool read(size_t offset, void* destination, size_t size) {
+        if (partition != nullptr) {
+            return esp_partition_read(partition, offset, destination, size) == ESP_OK;
+        }
+        if (offset > sizeof(maps::earth) || size > sizeof(maps::earth) - offset) {
+            return false;
+        }
+        memcpy(destination, maps::earth + offset, size);
+        return true;
+    }
+
+    uint16_t get_u16(const uint8_t* data) {
+        return data[0] | (data[1] << 8);
+    }
+
+    uint32_t get_u32(const uint8_t* data) {
+        return get_u16(data) | (static_cast<uint32_t>(get_u16(data + 2)) << 16);
+    }
+
+    bool load_levels() {
+        uint8_t header[HEADER_SIZE];
+        if (!read(0, header, sizeof(header)) || memcmp(header, "WMAP", 4) != 0) {
+            return false;
+        }
+        size_t count = get_u16(header + 8);
+        if (get_u16(header + 4) != FORMAT_VERSION || get_u16(header + 6) != TILE_SIZE || count == 0 || count > MAX_LEVELS) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint8_t entry[LEVEL_ENTRY_SIZE];
+            if (!read(HEADER_SIZE + i * LEVEL_ENTRY_SIZE, entry, sizeof(entry))) {
+                return false;
+            }
+            levels[i] = Level{get_u16(entry), get_u16(entry + 2), get_u32(entry + 4)};
+            if (levels[i].width < SCREEN_WIDTH || levels[i].height < SCREEN_HEIGHT ||
+                levels[i].width % TILE_SIZE != 0 || levels[i].height % TILE_SIZE != 0) {
+                return false;
+            }
+        }
+        loaded_levels = count;
+        for (auto& tile : cache) {
+            tile.valid = false;
+        }
+        return true;
+    }
+
+    void init() {
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(MAPS_PARTITION_SUBTYPE), "maps");
+        if (partition != nullptr) {
+            if (load_levels()) {
+                LOG_INFO("Map loaded from the maps partition, %u zoom levels.", loaded_levels);
+                return;
+            }
+            LOG_WARNING("No valid map in the maps partition, using the built-in one.");
+            partition = nullptr;
+        }
+        if (!load_levels()) {
+            LOG_ERROR("The built-in map is not valid.");
+        }
+    }
+
+    size_t level_count() {
+        return loaded_levels;
+    }
+
+    size_t level_width(size_t level) {
+        return levels[level].width;
+    }
+
+    size_t level_height(size_t level) {
+        return levels[level].height;
+    }
+
+    // Returns the decoded pixels of a tile, row by row, decoding it into the least recently used cache slot if needed
+    const uint8_t* get_tile(size_t level, size_t tile_x, size_t tile_y) {
+        uint16_t index = static_cast<uint16_t>(tile_y * (levels[level].width / TILE_SIZE) + tile_x);
+        CachedTile* slot = &cache[0];
+        for (auto& tile : cache) {
+            if (tile.valid && tile.level == level && tile.index == index) {
+                tile.last_used = ++cache_clock;
+                return tile.pixels;
+            }
+            if (slot->valid && (!tile.valid || tile.last_used < slot->last_used)) {
+                slot = &tile;
+            }
+        }
+        slot->valid = true;
+        slot->level = static_cast<uint8_t>(level);
+        slot->index = index;
+        slot->last_used = ++cache_clock;
+
+        uint8_t offsets[8];
+        bool ok = read(levels[level].index_offset + index * 4, offsets, sizeof(offsets));
+        uint32_t start = get_u32(offsets);
+        uint32_t size = get_u32(offsets + 4) - start;
+        ok = ok && get_u32(offsets + 4) > start && size <= MAX_PACKED_TILE_BYTES;
+        if (ok && partition == nullptr) {
+            // Built-in tiles are decoded in place
+            image::RowDecoder decoder = {maps::earth + start, TILE_ROW_BYTES};
+            image::decode_rows(decoder, slot->pixels, TILE_SIZE);
+        } else if (ok) {
+            uint8_t packed[MAX_PACKED_TILE_BYTES];
+            ok = read(start, packed, size);
+            image::RowDecoder decoder = {packed, TILE_ROW_BYTES};
+            if (ok) {
+                image::decode_rows(decoder, slot->pixels, TILE_SIZE);
+            }
+        }
+        if (!ok) {
+            LOG_ERROR("Cannot read tile %u of map level %u.", index, level);
+            memset(slot->pixels, 0, sizeof(slot->pixels));
+        }
+        return slot->pixels;
+    }
+
+    void blit_viewport(size_t level, size_t x, size_t y, Adafruit_SSD1306& display) {
+        uint8_t strip[8 * STRIP_BYTES]; // 8 rows of the tiles under the screen
+        uint8_t* buffer = display.getBuffer();
+        size_t tiles_x = levels[level].width / TILE_SIZE;
+        size_t first_tile_x = x / TILE_SIZE;
+        for (size_t page = 0; page < static_cast<size_t>(SCREEN_HEIGHT) / 8; page++) {
+            for (size_t row = 0; row < 8; row++) {
+                size_t map_y = y + page * 8 + row;
+                for (size_t i = 0; i < STRIP_TILES; i++) {
+                    const uint8_t* tile = get_tile(level, (first_tile_x + i) % tiles_x, map_y / TILE_SIZE);
+                    memcpy(strip + row * STRIP_BYTES + i * TILE_ROW_BYTES, tile + (map_y % TILE_SIZE) * TILE_ROW_BYTES, TILE_ROW_BYTES);
+                }
+            }
+            image::blit_page(buffer + page * static_cast<size_t>(SCREEN_WIDTH), strip, STRIP_BYTES, x % TILE_SIZE);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <Adafruit_SSD1306.h>
+
+namespace tilemap {
+    // Uses the world map in the "maps" flash partition if it holds a valid tile store,
+    // otherwise the levels built into the firmware
+    void init();
+
+    // Number of zoom levels, level 0 is the smallest
+    size_t level_count();
+
+    size_t level_width(size_t level);
+    size_t level_height(size_t level);
+
+    // Fills the display buffer with the screen-sized window of the level whose top left corner is (x, y),
+    // x wraps around the level width. Only the tiles under the window are read and decoded.
+    void blit_viewport(size_t level, size_t x, size_t y, Adafruit_SSD1306& display);
+}
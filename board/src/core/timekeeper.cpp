@@ -1,10 +1,27 @@
 #include <Arduino.h>
+#include <atomic>
+#include <esp_sntp.h>
 
 #include "core/timekeeper.hpp"
+#include "core/network.hpp"
+#include "core/logger.hpp"
 #include "apps/settings.hpp"
 
 namespace timekeeper {
     RTC_DATA_ATTR static uint64_t accumulated_time_us = 0;
+    // The esp_timer restarts from 0 on every boot, the RTC clock keeps running through deep sleep even if not synced
+    RTC_DATA_ATTR static int64_t deepsleep_rtc_us = 0;
+    // now_us() of the last NTP sync. Kept through deep sleep, the RTC drifts while asleep and is synced again once it
+    // gets old.
+    RTC_DATA_ATTR static bool ntp_synced = false;
+    RTC_DATA_ATTR static uint64_t last_ntp_sync_us = 0;
+    std::atomic<uint32_t> ntp_sync_count{0}; // Syncs since boot, to tell when the one ntp_sync() asked for is done
+
+    int64_t rtc_us() {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+    }
 
     uint64_t now_us() {
         return esp_timer_get_time() + accumulated_time_us;
@@ -26,12 +43,18 @@ namespace timekeeper {
     }
 
     void wakeup() {
+        // Time asleep, the time since this boot is counted by the esp_timer
+        int64_t asleep_us = rtc_us() - deepsleep_rtc_us - esp_timer_get_time();
+        if (asleep_us > 0) {
+            accumulated_time_us += asleep_us;
+        }
         auto settings = apps::settings::get_settings();
         update_ntp_settings(settings.timezone);
     }
 
     void deepsleep() {
         accumulated_time_us = now_us();
+        deepsleep_rtc_us = rtc_us();
     }
     
     void set_time_from_tm(const tm &timeinfo) {
@@ -42,9 +65,47 @@ namespace timekeeper {
         settimeofday(&tv, nullptr);
     }
 
+    // Called by SNTP in the lwIP task whenever it sets the time, also for the syncs SNTP makes on its own while
+    // the radio is on for another job
+    void on_ntp_sync(struct timeval* tv) {
+        last_ntp_sync_us = now_us();
+        ntp_synced = true;
+        ntp_sync_count++;
+    }
+
     void update_ntp_settings(apps::settings::Timezone timezone) {
+        sntp_set_time_sync_notification_cb(on_ntp_sync);
         auto utc_offset = apps::settings::get_timezone_offset_seconds(timezone);
         auto daylight_offset = apps::settings::get_timezone_daylight_offset_seconds(timezone);
         configTime(utc_offset, daylight_offset, "pool.ntp.org", "time.nist.gov");
     }
+
+    // Due while the RTC is not set or was not set by NTP, then again NTP_RESYNC_INTERVAL_MS after the last sync
+    uint64_t ntp_due_in_ms() {
+        if (rtc_s() == 0 || !ntp_synced) {
+            return 0;
+        }
+        uint64_t since_ms = (now_us() - last_ntp_sync_us) / 1000;
+        return since_ms >= NTP_RESYNC_INTERVAL_MS ? 0 : NTP_RESYNC_INTERVAL_MS - since_ms;
+    }
+
+    bool ntp_sync() {
+        constexpr uint64_t NTP_POLL_INTERVAL_MS = 500;
+        constexpr uint64_t NTP_TIMEOUT_MS = 10000;
+        auto settings = apps::settings::get_settings();
+        uint32_t syncs = ntp_sync_count;
+        update_ntp_settings(settings.timezone); // Restarts SNTP, which sends its first request right away
+        for (uint64_t waited_ms = 0; waited_ms < NTP_TIMEOUT_MS && ntp_sync_count == syncs; waited_ms += NTP_POLL_INTERVAL_MS) {
+            vTaskDelay(pdMS_TO_TICKS(NTP_POLL_INTERVAL_MS));
+        }
+        if (ntp_sync_count == syncs) {
+            LOG_ERROR("NTP sync timed out");
+            return false;
+        }
+        return true;
+    }
+
+    void add_ntp_job() {
+        network::add_job({"NTP", ntp_due_in_ms, ntp_sync});
+    }
 }
\ No newline at end of file
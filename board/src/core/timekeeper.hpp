@@ -24,4 +24,8 @@ namespace timekeeper {
 
     // Updates NTP settings based on the given timezone
     void update_ntp_settings(apps::settings::Timezone timezone);
+
+    // Registers the network job that sets the RTC with NTP while it is not synced and again every
+    // NTP_RESYNC_INTERVAL_MS, call after network::init()
+    void add_ntp_job();
 }
\ No newline at end of file
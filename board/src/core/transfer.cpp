@@ -0,0 +1,177 @@
+#include <cstring>
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+
+#include "core/transfer.hpp"
+#include "core/datalog.hpp"
+#include "core/events.hpp"
+#include "core/timekeeper.hpp"
+
+namespace transfer {
+    constexpr uint8_t SYNC = 0xA5;
+    constexpr size_t HEADER_SIZE = 4; // Sync, type, length
+    constexpr size_t CRC_SIZE = 2;
+    constexpr size_t MAX_REQUEST_PAYLOAD = 16;
+    constexpr size_t MAX_DATA_PAYLOAD = 512 + 5; // Stream, first and 32 entries of 16 bytes
+    constexpr size_t ENTRY_SIZE = 16; // Both datalog::Record and events::TraceEntry
+    constexpr uint64_t FRAME_TIMEOUT_US = 200000; // A request is sent in one go, a gap means the rest got lost
+    static_assert(sizeof(datalog::Record) == ENTRY_SIZE && sizeof(events::TraceEntry) == ENTRY_SIZE, "Entries must fill the DATA frames");
+
+    uint8_t frame[HEADER_SIZE + MAX_DATA_PAYLOAD + CRC_SIZE];
+    TaskHandle_t transfer_task_handle = nullptr;
+
+    void put_u32(uint8_t* destination, uint32_t value) {
+        memcpy(destination, &value, sizeof(value)); // The ESP32-C3 is little endian like the protocol
+    }
+
+    uint32_t get_u32(const uint8_t* source) {
+        uint32_t value;
+        memcpy(&value, source, sizeof(value));
+        return value;
+    }
+
+    // The payload is already in place after the header, the whole frame goes out in a single write so the logger
+    // cannot end up in the middle of it
+    void send_frame(FrameType type, size_t payload_length) {
+        frame[0] = SYNC;
+        frame[1] = static_cast<uint8_t>(type);
+        frame[2] = payload_length & 0xFF;
+        frame[3] = payload_length >> 8;
+        uint16_t crc = esp_rom_crc16_le(0, frame + 1, HEADER_SIZE - 1 + payload_length);
+        frame[HEADER_SIZE + payload_length] = crc & 0xFF;
+        frame[HEADER_SIZE + payload_length + 1] = crc >> 8;
+        Serial.write(frame, HEADER_SIZE + payload_length + CRC_SIZE);
+    }
+
+    void send_error(ErrorCode code) {
+        frame[HEADER_SIZE] = static_cast<uint8_t>(code);
+        send_frame(FrameType::ERROR, 1);
+    }
+
+    void get_range(Stream stream, uint32_t& first, uint32_t& end) {
+        if (stream == Stream::RECORDS) {
+            datalog::Range range = datalog::get_range();
+            first = range.first;
+            end = range.end;
+        } else {
+            events::get_trace_range(first, end);
+        }
+    }
+
+    void send_info() {
+        uint8_t* payload = frame + HEADER_SIZE;
+        payload[0] = PROTOCOL_VERSION;
+        payload[1] = 2;
+        size_t length = 2;
+        for (Stream stream : {Stream::RECORDS, Stream::EVENTS}) {
+            uint32_t first, end;
+            get_range(stream, first, end);
+            payload[length] = ENTRY_SIZE & 0xFF;
+            payload[length + 1] = ENTRY_SIZE >> 8;
+            put_u32(payload + length + 2, first);
+            put_u32(payload + length + 6, end);
+            length += 10;
+        }
+        send_frame(FrameType::INFO, length);
+    }
+
+    void send_entries(Stream stream, uint32_t first, uint32_t count) {
+        uint32_t range_first, range_end;
+        get_range(stream, range_first, range_end);
+        // A READ past the end gets an END at the end of the stream, not entries that were never written
+        uint32_t next = MIN(MAX(first, range_first), range_end);
+        uint32_t end = range_end - next < count ? range_end : next + count;
+        uint8_t* payload = frame + HEADER_SIZE;
+        while (next < end) {
+            uint32_t entries = MIN(end - next, (MAX_DATA_PAYLOAD - 5) / ENTRY_SIZE);
+            payload[0] = static_cast<uint8_t>(stream);
+            put_u32(payload + 1, next);
+            uint8_t* entry = payload + 5;
+            for (uint32_t i = 0; i < entries; ++i, entry += ENTRY_SIZE) {
+                bool found;
+                if (stream == Stream::RECORDS) {
+                    found = datalog::get_record(next + i, *reinterpret_cast<datalog::Record*>(entry));
+                } else {
+                    found = events::get_trace_entry(next + i, *reinterpret_cast<events::TraceEntry*>(entry));
+                }
+                if (!found) {
+                    memset(entry, 0xFF, ENTRY_SIZE);
+                }
+            }
+            send_frame(FrameType::DATA, 5 + entries * ENTRY_SIZE);
+            next += entries;
+        }
+        payload[0] = static_cast<uint8_t>(stream);
+        put_u32(payload + 1, next);
+        send_frame(FrameType::END, 5);
+    }
+
+    void handle_request(FrameType type, const uint8_t* payload, size_t length) {
+        switch (type) {
+            case FrameType::HELLO:
+                send_info();
+                break;
+            case FrameType::READ:
+                if (length != 9 || payload[0] > static_cast<uint8_t>(Stream::EVENTS)) {
+                    send_error(ErrorCode::BAD_REQUEST);
+                } else {
+                    send_entries(static_cast<Stream>(payload[0]), get_u32(payload + 1), get_u32(payload + 5));
+                }
+                break;
+            default:
+                send_error(ErrorCode::UNKNOWN_REQUEST);
+                break;
+        }
+    }
+
+    // Called from the event task of the USB-CDC driver when bytes arrive, the transfer task sleeps until then
+    void on_serial_rx(void* arg, esp_event_base_t base, int32_t id, void* data) {
+        if (transfer_task_handle != nullptr) {
+            xTaskNotifyGive(transfer_task_handle);
+        }
+    }
+
+    // Bytes that are not part of a request with a valid CRC are dropped, the host retries after a timeout
+    void transfer_task(void* param) {
+        uint8_t request[HEADER_SIZE + MAX_REQUEST_PAYLOAD + CRC_SIZE];
+        size_t received = 0;
+        uint64_t last_byte_us = 0;
+        while (true) {
+            int c = Serial.read();
+            if (c < 0) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // Bytes that arrived since the read are already counted
+                continue;
+            }
+            uint64_t now = timekeeper::now_us();
+            if (received > 0 && now - last_byte_us > FRAME_TIMEOUT_US) {
+                received = 0;
+            }
+            last_byte_us = now;
+            if (received == 0 && c != SYNC) {
+                continue;
+            }
+            request[received++] = c;
+            if (received < HEADER_SIZE) {
+                continue;
+            }
+            size_t length = request[2] | (request[3] << 8);
+            if (length > MAX_REQUEST_PAYLOAD) {
+                received = 0;
+                continue;
+            }
+            if (received < HEADER_SIZE + length + CRC_SIZE) {
+                continue;
+            }
+            received = 0;
+            uint16_t crc = request[HEADER_SIZE + length] | (request[HEADER_SIZE + length + 1] << 8);
+            if (crc == esp_rom_crc16_le(0, request + 1, HEADER_SIZE - 1 + length)) {
+                handle_request(static_cast<FrameType>(request[1]), request + HEADER_SIZE, length);
+            }
+        }
+    }
+
+    void init() {
+        xTaskCreate(transfer_task, "TransferTask", 3072, nullptr, 1, &transfer_task_handle);
+        Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, on_serial_rx);
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+// Binary export of the data log and of the button event trace on the USB-CDC serial port, see
+// scripts/export_log.py for the host side. Frames are
+//     0xA5, type, payload length (u16), payload, CRC (u16)
+// little endian, the CRC is esp_rom_crc16_le(0, ...) (CRC-16/X-25) of type, length and payload. Text printed by
+// the logger can sit between frames, the host skips whatever is not a frame with a valid CRC.
+//
+// Requests from the host:
+//     HELLO                                   -> INFO: version (u8), stream count (u8), then for each stream
+//                                                the entry size (u16) and the range [first, end) (u32, u32)
+//     READ: stream (u8), first (u32), count (u32) -> DATA frames: stream (u8), first (u32), entries,
+//                                                then END: stream (u8), next (u32)
+// Entries are sent in order from max(first, start of the stream), so a transfer cut short resumes with a READ
+// from the last entry received + 1. A READ from past the end of the stream only gets the END, with next at the
+// end. A log record that cannot be read is sent erased (all bytes 0xFF).
+namespace transfer {
+    constexpr uint8_t PROTOCOL_VERSION = 1;
+
+    enum class FrameType : uint8_t {
+        HELLO = 0x01,
+        READ = 0x02,
+        INFO = 0x81,
+        DATA = 0x82,
+        END = 0x83,
+        ERROR = 0xFF // code (u8)
+    };
+
+    enum class ErrorCode : uint8_t {
+        UNKNOWN_REQUEST = 1,
+        BAD_REQUEST = 2, // Wrong payload length or unknown stream
+    };
+
+    enum class Stream : uint8_t {
+        RECORDS = 0, // datalog::Record
+        EVENTS = 1 // events::TraceEntry
+    };
+
+    // Starts the task answering requests on Serial, call after logger::init()
+    void init();
+}
@@ -0,0 +1,196 @@
+#include <cstdint>
+#include <cstring>
+#include <Arduino.h>
+
+#include "core/widgets.hpp"
+#include "core/framebuffer.hpp"
+#include "core/menu.hpp"
+#include "core/text.hpp"
+#include "constants.hpp"
+
+namespace widgets {
+    constexpr int16_t ROW_HEIGHT = 8; // Rows are aligned to the display pages
+    constexpr int16_t LIST_TOP = 8; // Under the title bar
+    constexpr size_t LIST_ROWS = 7;
+    constexpr int16_t SCROLLBAR_WIDTH = 4;
+    constexpr int16_t SCROLLBAR_X = SCREEN_WIDTH - SCROLLBAR_WIDTH;
+    constexpr int16_t SCROLLBAR_PADDING = 1;
+    constexpr int16_t SCROLLBAR_TRACK_HEIGHT = SCREEN_HEIGHT - LIST_TOP - SCROLLBAR_PADDING * 2 - 2; // Inside the border
+
+    void begin(Screen& screen, Adafruit_SSD1306& display) {
+        screen.retained = screen.frame != 0 && screen.frame == framebuffer::frame_count();
+        if (!screen.retained) {
+            display.clearDisplay();
+        }
+    }
+
+    void end(Screen& screen, Adafruit_SSD1306& display) {
+        framebuffer::flush(display);
+        screen.frame = framebuffer::frame_count();
+        screen.retained = false;
+    }
+
+    void copy_text(char (&destination)[MAX_TEXT_LENGTH + 1], const char* text) {
+        strncpy(destination, text, MAX_TEXT_LENGTH);
+        destination[MAX_TEXT_LENGTH] = '\0';
+    }
+
+    bool draw_titlebar(const Screen& screen, TitleBar& titlebar, const char* title, Adafruit_SSD1306& display) {
+        uint32_t status = menu::titlebar_status();
+        if (screen.retained && titlebar.status == status && strncmp(titlebar.title, title, MAX_TEXT_LENGTH) == 0) {
+            return false;
+        }
+        menu::draw_generic_titlebar(display, title);
+        copy_text(titlebar.title, title);
+        titlebar.status = status;
+        return true;
+    }
+
+    // Same scrolling as the original menu: the selected option stays in the middle row when possible
+    size_t first_visible_option(size_t count, size_t selected) {
+        if (count <= LIST_ROWS || selected < LIST_ROWS / 2 + 1) {
+            return 0;
+        }
+        if (selected >= count - (LIST_ROWS / 2 + 1)) {
+            return count - LIST_ROWS;
+        }
+        return selected - LIST_ROWS / 2;
+    }
+
+    // Clears columns [x, x + width) of the pages, cheaper than fillRect for page-aligned areas
+    void clear_pages(Adafruit_SSD1306& display, size_t first_page, size_t pages, int16_t x = 0, int16_t width = SCREEN_WIDTH) {
+        uint8_t* buffer = display.getBuffer();
+        for (size_t page = first_page; page < first_page + pages; ++page) {
+            memset(buffer + page * SCREEN_WIDTH + x, 0, width);
+        }
+    }
+
+    void draw_list_row(const List& list, size_t index, Adafruit_SSD1306& display) {
+        int16_t y = LIST_TOP + static_cast<int16_t>(index - list.first) * ROW_HEIGHT;
+        clear_pages(display, y / 8, 1);
+        text::print(display, 0, y, index == list.selected ? "> " : "  ");
+        text::print(display, 2 * text::GLYPH_WIDTH, y, list.options[index]);
+    }
+
+    void draw_scrollbar(const List& list, Adafruit_SSD1306& display) {
+        // The whole column, scrolling moves the old scrollbar along with the rows
+        clear_pages(display, LIST_TOP / 8, LIST_ROWS, SCROLLBAR_X, SCROLLBAR_WIDTH);
+        display.drawRect(SCROLLBAR_X, LIST_TOP + SCROLLBAR_PADDING, SCROLLBAR_WIDTH, SCROLLBAR_TRACK_HEIGHT + 2, SSD1306_WHITE);
+        uint16_t scrollbar_height = SCROLLBAR_TRACK_HEIGHT * LIST_ROWS / list.count;
+        size_t max_offset = SCROLLBAR_TRACK_HEIGHT - static_cast<size_t>(scrollbar_height);
+        uint16_t scrollbar_offset = max_offset * list.selected / (list.count - 1);
+        display.fillRect(SCROLLBAR_X, LIST_TOP + 1 + SCROLLBAR_PADDING + scrollbar_offset, SCROLLBAR_WIDTH, scrollbar_height, SSD1306_WHITE);
+    }
+
+    bool draw_list(const Screen& screen, List& list, const char* const options[], size_t count, size_t selected, Adafruit_SSD1306& display) {
+        if (count == 0) {
+            bool changed = !screen.retained || list.count != 0;
+            if (changed) {
+                clear_pages(display, LIST_TOP / 8, LIST_ROWS);
+            }
+            list = List{options, 0, 0, 0};
+            return changed;
+        }
+        size_t first = first_visible_option(count, selected);
+        size_t visible = MIN(count, LIST_ROWS);
+        bool full = !screen.retained || list.options != options || list.count != count;
+        if (!full && list.selected == selected) {
+            return false;
+        }
+        size_t last_selected = list.selected;
+        size_t last_first = list.first;
+        list.options = options;
+        list.count = count;
+        list.selected = selected;
+        list.first = first;
+        if (!full && first != last_first) {
+            size_t shift = first > last_first ? first - last_first : last_first - first;
+            if (shift >= visible) {
+                full = true;
+            } else {
+                // Rows are pages, move the ones still visible and draw only the rows scrolled in
+                uint8_t* rows = display.getBuffer() + (LIST_TOP / 8) * SCREEN_WIDTH;
+                size_t kept = visible - shift;
+                if (first > last_first) {
+                    memmove(rows, rows + shift * SCREEN_WIDTH, kept * SCREEN_WIDTH);
+                    for (size_t i = first + kept; i < first + visible; ++i) {
+                        draw_list_row(list, i, display);
+                    }
+                } else {
+                    memmove(rows + shift * SCREEN_WIDTH, rows, kept * SCREEN_WIDTH);
+                    for (size_t i = first; i < first + shift; ++i) {
+                        draw_list_row(list, i, display);
+                    }
+                }
+            }
+        }
+        if (full) {
+            clear_pages(display, LIST_TOP / 8, LIST_ROWS);
+            for (size_t i = first; i < first + visible; ++i) {
+                draw_list_row(list, i, display);
+            }
+        } else {
+            // Only the cursor moved
+            if (last_selected >= first && last_selected < first + visible) {
+                draw_list_row(list, last_selected, display);
+            }
+            draw_list_row(list, selected, display);
+        }
+        if (count > LIST_ROWS) {
+            draw_scrollbar(list, display);
+        }
+        return true;
+    }
+
+    bool draw_label(const Screen& screen, Label& label, const char* text, Adafruit_SSD1306& display) {
+        if (screen.retained && strncmp(label.text, text, MAX_TEXT_LENGTH) == 0) {
+            return false;
+        }
+        copy_text(label.text, text);
+        display.fillRect(label.bounds.x, label.bounds.y, label.bounds.width, label.bounds.height, SSD1306_BLACK);
+        text::print(display, label.bounds.x, label.bounds.y, label.text);
+        return true;
+    }
+
+    bool draw_icon(const Screen& screen, Icon& icon, const uint8_t* bitmap, Adafruit_SSD1306& display) {
+        if (screen.retained && icon.bitmap == bitmap) {
+            return false;
+        }
+        icon.bitmap = bitmap;
+        uint16_t background = icon.color == SSD1306_WHITE ? SSD1306_BLACK : SSD1306_WHITE;
+        display.fillRect(icon.bounds.x, icon.bounds.y, icon.bounds.width, icon.bounds.height, background);
+        if (bitmap != nullptr) {
+            display.drawBitmap(icon.bounds.x, icon.bounds.y, bitmap, icon.bounds.width, icon.bounds.height, icon.color);
+        }
+        return true;
+    }
+
+    void draw_key(const KeyboardGrid& grid, size_t index, Adafruit_SSD1306& display) {
+        Bounds bounds;
+        const char* label = nullptr;
+        grid.get_key(index, grid.shifted, bounds, label);
+        bool selected = index == grid.selected;
+        display.fillRect(bounds.x, bounds.y, bounds.width, bounds.height, selected ? SSD1306_WHITE : SSD1306_BLACK);
+        int16_t text_width = static_cast<int16_t>(strlen(label)) * text::GLYPH_WIDTH;
+        text::print(display, bounds.x + (bounds.width - text_width) / 2, bounds.y, label, 1, selected ? SSD1306_BLACK : SSD1306_WHITE);
+    }
+
+    bool draw_keyboard_grid(const Screen& screen, KeyboardGrid& grid, size_t selected, bool shifted, Adafruit_SSD1306& display) {
+        bool full = !screen.retained || grid.shifted != shifted;
+        if (!full && grid.selected == selected) {
+            return false;
+        }
+        size_t last_selected = grid.selected;
+        grid.selected = selected;
+        grid.shifted = shifted;
+        if (full) {
+            for (size_t i = 0; i < grid.key_count; ++i) {
+                draw_key(grid, i, display);
+            }
+        } else {
+            draw_key(grid, last_selected, display);
+            draw_key(grid, selected, display);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Adafruit_SSD1306.h>
+
+// Retained-mode widgets: each widget remembers what it drew last, so drawing it again only touches the pixels
+// that changed. The widgets of a screen are drawn between begin() and end(), if anything else was flushed since
+// the last end() of the screen the display is cleared and every widget is drawn from scratch.
+namespace widgets {
+    constexpr size_t MAX_TEXT_LENGTH = 21; // Characters of the default font in a screen row
+
+    struct Screen {
+        uint32_t frame = 0; // framebuffer::frame_count() after the last end(), 0 if never drawn
+        bool retained = false; // Between begin() and end(), true if the display buffer still holds the last frame
+    };
+
+    struct Bounds {
+        int16_t x;
+        int16_t y;
+        int16_t width;
+        int16_t height;
+    };
+
+    // Title bar with the status icons, see menu::draw_generic_titlebar
+    struct TitleBar {
+        char title[MAX_TEXT_LENGTH + 1];
+        uint32_t status; // menu::titlebar_status() when last drawn
+    };
+
+    // One option per row under the title bar, with a scrollbar if they don't fit
+    struct List {
+        const char* const* options;
+        size_t count;
+        size_t selected;
+        size_t first; // First visible option
+    };
+
+    // Single line of text, cleared to the bounds before drawing
+    struct Label {
+        Bounds bounds;
+        char text[MAX_TEXT_LENGTH + 1];
+    };
+
+    struct Icon {
+        Bounds bounds;
+        const uint8_t* bitmap; // Row-major 1bpp bitmap of bounds.width x bounds.height, nullptr draws nothing
+        uint16_t color;
+    };
+
+    // Grid of keys, the key geometry and labels come from the owner. Selecting a key only redraws two keys.
+    struct KeyboardGrid {
+        size_t key_count;
+        // Fills in the cell and the label of a key for the given layer
+        void (*get_key)(size_t index, bool shifted, Bounds& bounds, const char*& label);
+        size_t selected;
+        bool shifted;
+    };
+
+    // Starts drawing the screen, clears the display if it no longer holds the last frame of this screen.
+    void begin(Screen& screen, Adafruit_SSD1306& display);
+
+    // Sends the changes to the panel.
+    void end(Screen& screen, Adafruit_SSD1306& display);
+
+    // The draw functions return true if they changed the display buffer.
+
+    bool draw_titlebar(const Screen& screen, TitleBar& titlebar, const char* title, Adafruit_SSD1306& display);
+
+    bool draw_list(const Screen& screen, List& list, const char* const options[], size_t count, size_t selected, Adafruit_SSD1306& display);
+
+    bool draw_label(const Screen& screen, Label& label, const char* text, Adafruit_SSD1306& display);
+
+    bool draw_icon(const Screen& screen, Icon& icon, const uint8_t* bitmap, Adafruit_SSD1306& display);
+
+    bool draw_keyboard_grid(const Screen& screen, KeyboardGrid& grid, size_t selected, bool shifted, Adafruit_SSD1306& display);
+}
@@ -9,9 +9,7 @@ namespace wifi {
         DISABLED_BY_USER = 4
     };
 
-    // Get the current WiFi status and approximate signal strength
+    // Get the current WiFi status and approximate signal strength. The radio is only on during the windows of the
+    // network scheduler, see core/network.hpp, so this is DISCONNECTED most of the time.
     WiFiStatus get_status();
-
-    // Initialize the WiFi system and start the WiFi management task
-    void init();
 }
\ No newline at end of file
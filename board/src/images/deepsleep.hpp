@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <stdint.h>
 #include <cstddef>
+#include "core/image.hpp"
 
 namespace images {
     constexpr uint8_t deepsleep[] PROGMEM = {
@@ -73,4 +74,40 @@ namespace images {
     };
     constexpr size_t deepsleep_width = 128;
     constexpr size_t deepsleep_height = 64;
+    constexpr uint8_t deepsleep_packed_data[] PROGMEM = {
+        0xf1, 0x55, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf8, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xf9, 0x00, 0x00, 0x02, 0xfb, 0x00, 0xf9, 0x00, 0x01, 0x7f, 0x84, 0xfc, 0x00, 0x00, 0x01, 0x00,
+        0x80, 0xfa, 0x00, 0x01, 0x7f, 0x88, 0xfb, 0x00, 0xf9, 0x00, 0x01, 0x06, 0x0f, 0xfc, 0x00, 0x00,
+        0x01, 0x00, 0x80, 0xfc, 0x00, 0x02, 0x7f, 0xf8, 0x06, 0xfa, 0x00, 0xfb, 0x00, 0x02, 0x7f, 0xf8,
+        0x18, 0xfb, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x00, 0x02, 0x7f, 0xf8, 0x18, 0xfa, 0x00, 0xfa,
+        0x00, 0x01, 0x38, 0x60, 0xfb, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfb, 0x00, 0x01, 0x38, 0x60, 0xfa,
+        0x00, 0xfa, 0x00, 0x02, 0x38, 0x7f, 0x80, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x00, 0x03,
+        0x01, 0xc0, 0x7f, 0x80, 0xfb, 0x00, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xfa, 0x00, 0x00, 0x01, 0x00,
+        0x80, 0xfc, 0x00, 0x01, 0x01, 0xc0, 0xf9, 0x00, 0xfb, 0x00, 0x00, 0x0e, 0xf9, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xfc, 0x00, 0x00, 0x0e, 0xf8, 0x00, 0xfb, 0x00, 0x00, 0x0e, 0xf9, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xfc, 0x00, 0x00, 0x70, 0xf8, 0x00, 0xfb, 0x00, 0x00, 0x70, 0xf9, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xfc, 0x00, 0x00, 0x70, 0xf8, 0x00, 0xfb, 0x00, 0x01, 0x7f, 0xf8, 0xfa, 0x00, 0x00,
+        0x01, 0x00, 0x80, 0xfc, 0x00, 0x01, 0x7f, 0xf8, 0xf9, 0x00, 0xfb, 0x00, 0x01, 0x7f, 0xf8, 0xfa,
+        0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2,
+        0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xfd,
+        0x00, 0x05, 0x38, 0x10, 0x00, 0x10, 0x00, 0x10, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00,
+        0x07, 0x41, 0x87, 0x18, 0x19, 0x80, 0xd3, 0x19, 0xc0, 0xfd, 0x00, 0xfd, 0x00, 0x07, 0x5a, 0x54,
+        0xa4, 0x12, 0x41, 0x14, 0xa5, 0x20, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x07, 0x4a,
+        0x54, 0xa4, 0x12, 0x40, 0x97, 0xbd, 0x20, 0xfd, 0x00, 0xfd, 0x00, 0x07, 0x4a, 0x54, 0x9c, 0x12,
+        0x40, 0x54, 0x21, 0xc0, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x08, 0x39, 0x94, 0x84,
+        0x09, 0x81, 0x93, 0x19, 0x0a, 0x80, 0xfe, 0x00, 0xfb, 0x00, 0x00, 0x18, 0xfe, 0x00, 0x00, 0x01,
+        0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00,
+        0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x00,
+        0xf2, 0x00, 0x00, 0x01, 0xf1, 0xaa,
+    };
+    constexpr uint16_t deepsleep_packed_bands[] PROGMEM = {
+        0, 30, 62, 123, 200, 266, 303, 408,
+    };
+    constexpr image::PackedImage deepsleep_packed = {
+        deepsleep_packed_data, deepsleep_packed_bands, deepsleep_width, deepsleep_height
+    };
 }
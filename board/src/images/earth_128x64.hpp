@@ -1,76 +0,0 @@
-// This file was generated by gen_images.py
-#pragma once
-#include <Arduino.h>
-#include <stdint.h>
-#include <cstddef>
-
-namespace images {
-    constexpr uint8_t earth_128x64[] PROGMEM = {
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11111111, 0b10011111, 0b11111111, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00011001, 0b11111101, 0b11111111, 0b11111111, 0b10000000, 0b00000111, 0b00100000, 0b00000000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000011, 0b10011100, 0b10000000, 0b10011111, 0b11111111, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00111111, 0b10000000, 0b01000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00001111, 0b00100101, 0b01111000, 0b00000111, 0b11111111, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b01000111, 0b11111111, 0b11101100, 0b00000000, 0b00000000,
-        0b00000001, 0b11110000, 0b00000000, 0b01110011, 0b01111111, 0b00000111, 0b11111111, 0b00000000, 0b00000000, 0b10110000, 0b00000100, 0b11011111, 0b11111111, 0b11111111, 0b11111111, 0b10000000,
-        0b11000011, 0b11111111, 0b11111111, 0b11111101, 0b10110101, 0b11000111, 0b11111000, 0b00000000, 0b00000011, 0b11111110, 0b10111111, 0b11011111, 0b11111111, 0b11111111, 0b11111111, 0b11111111,
-        0b00100111, 0b11111111, 0b11111111, 0b11111111, 0b10100111, 0b10000011, 0b11000000, 0b01110000, 0b00001111, 0b01111101, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111,
-        0b00000011, 0b11111111, 0b11111111, 0b11111110, 0b00000110, 0b00000001, 0b11000000, 0b00000000, 0b00111110, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11011110,
-        0b00000001, 0b11000001, 0b11111111, 0b11111110, 0b00000111, 0b01000000, 0b00000000, 0b00000000, 0b00011110, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11100010, 0b01000000,
-        0b00000000, 0b00000000, 0b01111111, 0b11111111, 0b10001111, 0b11100000, 0b00000000, 0b00000001, 0b00010100, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000, 0b11100000,
-        0b00000000, 0b00000000, 0b01111111, 0b11111111, 0b11101111, 0b11111000, 0b00000000, 0b00000101, 0b10111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11100000, 0b10000000,
-        0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11101000, 0b00000000, 0b00000000, 0b01111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11010000, 0b00000000,
-        0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11011000, 0b00000000, 0b00000001, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11000000, 0b00000000, 0b00000000, 0b11111111, 0b11101011, 0b10011111, 0b11111111, 0b11111111, 0b11111111, 0b10000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111110, 0b00000000, 0b00000000, 0b00000111, 0b11000101, 0b11000001, 0b11011111, 0b11111111, 0b11111111, 0b11111110, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111100, 0b00000000, 0b00000000, 0b00000111, 0b00010010, 0b10111111, 0b11011111, 0b11111111, 0b11111111, 0b11100100, 0b00100000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000111, 0b11111111, 0b11111100, 0b00000000, 0b00000000, 0b00000010, 0b01110000, 0b00001111, 0b11111111, 0b11111111, 0b11111111, 0b11110110, 0b01100000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000011, 0b11111111, 0b11111000, 0b00000000, 0b00000000, 0b00000011, 0b11110000, 0b00000111, 0b11111111, 0b11111111, 0b11111111, 0b11100000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000001, 0b11111111, 0b11110000, 0b00000000, 0b00000000, 0b00000111, 0b11111110, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11110000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b01111100, 0b00010000, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11011111, 0b11111111, 0b11111111, 0b11110010, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111011, 0b11101111, 0b11111111, 0b11111111, 0b11100000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00011100, 0b00010000, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111011, 0b11111100, 0b01111111, 0b11111111, 0b10010000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00011100, 0b10000011, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111101, 0b11111000, 0b00111110, 0b00111101, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111100, 0b11110000, 0b00011100, 0b00111110, 0b00010000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111110, 0b11000000, 0b00011000, 0b00011110, 0b00010000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00100011, 0b00000000, 0b00000000, 0b00011111, 0b11111111, 0b11111111, 0b00100000, 0b00011000, 0b00000110, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00010111, 0b11100000, 0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11000000, 0b00000000, 0b00010000, 0b00001000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11111000, 0b00000000, 0b00000111, 0b10111111, 0b11111111, 0b11000000, 0b00000000, 0b00001000, 0b00100000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11111100, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b10000000, 0b00000000, 0b00110100, 0b11000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11111110, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b00000000, 0b00000000, 0b00001001, 0b11000010, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11000000, 0b00000000, 0b00001111, 0b11111110, 0b00000000, 0b00000000, 0b00001100, 0b11000011, 0b01100010, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11110000, 0b00000000, 0b00000111, 0b11111100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111101, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11111111, 0b11110000, 0b00000000, 0b00000111, 0b11111100, 0b00000000, 0b00000000, 0b00000000, 0b11110100, 0b01111000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11111111, 0b11100000, 0b00000000, 0b00000111, 0b11111110, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b00000000, 0b00000000,
-        0b00010000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11111111, 0b11100000, 0b00000000, 0b00000111, 0b11111110, 0b00000000, 0b00000000, 0b00000000, 0b00000101, 0b10010000, 0b00000000,
-        0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11111111, 0b11100000, 0b00000000, 0b00000111, 0b11111100, 0b11000000, 0b00000000, 0b00000000, 0b00001111, 0b11010000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11111111, 0b11000000, 0b00000000, 0b00000111, 0b11111000, 0b11000000, 0b00000000, 0b00000000, 0b00011111, 0b11111000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11111111, 0b11000000, 0b00000000, 0b00000011, 0b11111000, 0b11000000, 0b00000000, 0b00000000, 0b01111111, 0b11111100, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11111110, 0b00000000, 0b00000000, 0b00000011, 0b11110000, 0b10000000, 0b00000000, 0b00000000, 0b01111111, 0b11111110, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11111110, 0b00000000, 0b00000000, 0b00000011, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111110, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11111110, 0b00000000, 0b00000000, 0b00000001, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111110, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11111100, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b11111100, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111100, 0b00000010,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000010,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001000, 0b00000100,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00010000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111100, 0b00000011, 0b11111111, 0b11111111, 0b11110000, 0b00000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000001, 0b01000110, 0b00011111, 0b11111111, 0b10111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000,
-        0b00000000, 0b00000000, 0b00000000, 0b00001101, 0b10000100, 0b11100000, 0b00000000, 0b00011111, 0b11111111, 0b11111111, 0b11111111, 0b01111111, 0b11111111, 0b11111111, 0b11111111, 0b11111000,
-        0b00000000, 0b00001111, 0b11111111, 0b11111111, 0b11111111, 0b10000000, 0b00000001, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000,
-        0b00000010, 0b01111111, 0b11111111, 0b11111111, 0b11101001, 0b00000001, 0b10001111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11100000,
-        0b00000000, 0b01111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000, 0b00111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11000000,
-        0b11100011, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111,
-        0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111, 0b11111111,
-    };
-    constexpr size_t earth_128x64_width = 128;
-    constexpr size_t earth_128x64_height = 64;
-}
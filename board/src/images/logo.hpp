@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <stdint.h>
 #include <cstddef>
+#include "core/image.hpp"
 
 namespace images {
     constexpr uint8_t logo[] PROGMEM = {
@@ -73,4 +74,61 @@ namespace images {
     };
     constexpr size_t logo_width = 128;
     constexpr size_t logo_height = 64;
+    constexpr uint8_t logo_packed_data[] PROGMEM = {
+        0xf1, 0xff, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x00, 0x03, 0x07, 0xff, 0xff, 0xe0, 0xfc, 0x00, 0x00,
+        0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0x01, 0xf8, 0x38, 0x1c, 0x1f, 0x80, 0xfd, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xfd, 0x00, 0x05, 0x3e, 0x00, 0xc0, 0x03, 0x00, 0x7c, 0xfd, 0x00, 0x00, 0x01, 0x00,
+        0x80, 0xfd, 0x00, 0x05, 0xc0, 0x01, 0x00, 0x00, 0x80, 0x03, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xfe, 0x00, 0x07, 0x07, 0x00, 0x06, 0x07, 0xe0, 0x60, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0x00,
+        0x80, 0xfe, 0x00, 0x07, 0x38, 0x00, 0x08, 0x18, 0x18, 0x10, 0x00, 0x1c, 0xfe, 0x00, 0x00, 0x01,
+        0x0f, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x08, 0x60, 0x06, 0x10, 0x00, 0x03, 0x80, 0x00, 0x00,
+        0x01, 0x0f, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x10, 0x80, 0x01, 0x08, 0x00, 0x00, 0x60, 0x00,
+        0x00, 0x01, 0x0f, 0x80, 0x00, 0x00, 0x18, 0x00, 0x00, 0x21, 0x03, 0xc0, 0x84, 0x00, 0x00, 0x18,
+        0x00, 0x00, 0x01, 0x0f, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x22, 0x0c, 0x30, 0x44, 0x00, 0x00,
+        0x06, 0x00, 0x00, 0x01, 0x0f, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x42, 0x10, 0x08, 0x42, 0x00,
+        0x00, 0x01, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x02, 0xfe, 0x00, 0x03, 0x44, 0x20, 0x04, 0x22,
+        0xfe, 0x00, 0x02, 0x40, 0x00, 0x01, 0x02, 0x80, 0x00, 0x0c, 0xfe, 0x00, 0x03, 0x44, 0x43, 0xc2,
+        0x22, 0xfe, 0x00, 0x02, 0x30, 0x00, 0x01, 0x02, 0x80, 0x00, 0x10, 0xfe, 0x00, 0x03, 0x88, 0x47,
+        0xe2, 0x11, 0xfe, 0x00, 0x02, 0x08, 0x00, 0x01, 0x02, 0x80, 0x00, 0x20, 0xfe, 0x00, 0x03, 0x88,
+        0x8f, 0xf1, 0x11, 0xfe, 0x00, 0x02, 0x04, 0x00, 0x01, 0x02, 0x80, 0x00, 0xc0, 0xfe, 0x00, 0x03,
+        0x88, 0x8f, 0xf1, 0x11, 0xfe, 0x00, 0x02, 0x03, 0x00, 0x01, 0x02, 0x80, 0x00, 0xc0, 0xfe, 0x00,
+        0x03, 0x88, 0x8f, 0xf1, 0x11, 0xfe, 0x00, 0x02, 0x03, 0x00, 0x01, 0x02, 0x80, 0x00, 0x20, 0xfe,
+        0x00, 0x03, 0x88, 0x8f, 0xf1, 0x11, 0xfe, 0x00, 0x02, 0x04, 0x00, 0x01, 0x02, 0x80, 0x00, 0x10,
+        0xfe, 0x00, 0x03, 0x88, 0x47, 0xe2, 0x11, 0xfe, 0x00, 0x02, 0x08, 0x00, 0x01, 0x02, 0x80, 0x00,
+        0x0c, 0xfe, 0x00, 0x03, 0x44, 0x43, 0xc2, 0x22, 0xfe, 0x00, 0x02, 0x30, 0x00, 0x01, 0x02, 0x80,
+        0x00, 0x02, 0xfe, 0x00, 0x03, 0x44, 0x20, 0x04, 0x22, 0xfe, 0x00, 0x02, 0x40, 0x00, 0x01, 0x0f,
+        0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x42, 0x10, 0x08, 0x42, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01,
+        0x0f, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x22, 0x0c, 0x30, 0x44, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x01, 0x0f, 0x80, 0x00, 0x00, 0x18, 0x00, 0x00, 0x21, 0x03, 0xc0, 0x84, 0x00, 0x00, 0x18, 0x00,
+        0x00, 0x01, 0x0f, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x10, 0x80, 0x01, 0x08, 0x00, 0x00, 0x60,
+        0x00, 0x00, 0x01, 0x0f, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x08, 0x60, 0x06, 0x10, 0x00, 0x03,
+        0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x07, 0x38, 0x00, 0x08, 0x18, 0x18, 0x10, 0x00,
+        0x1c, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x07, 0x07, 0x00, 0x06, 0x07, 0xe0, 0x60,
+        0x00, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0xc0, 0x01, 0x00, 0x00, 0x80,
+        0x03, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0x3e, 0x00, 0xc0, 0x03, 0x00, 0x7c,
+        0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0x01, 0xf8, 0x38, 0x1c, 0x1f, 0x80, 0xfd,
+        0x00, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x00, 0x03, 0x07, 0xff, 0xff, 0xe0, 0xfc, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xfc, 0xfd, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0x2f, 0xbf, 0x7f, 0x7b, 0xbf, 0xfc, 0xfd, 0x00, 0x00,
+        0x01, 0x00, 0x80, 0xfd, 0x00, 0x05, 0x2f, 0xb3, 0x31, 0x79, 0x33, 0x1c, 0xfd, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xfd, 0x00, 0x05, 0x2d, 0xbd, 0x6f, 0x1a, 0xbd, 0x6c, 0xfd, 0x00, 0x00, 0x01, 0x00,
+        0x80, 0xfd, 0x00, 0x05, 0x2d, 0xb1, 0x6f, 0x6b, 0xb1, 0x6c, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80,
+        0xfd, 0x00, 0x05, 0x35, 0x6d, 0x6f, 0x6b, 0xad, 0x6c, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd,
+        0x00, 0x05, 0x3a, 0xf1, 0xb1, 0x6b, 0xb1, 0x6c, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00,
+        0x00, 0x3f, 0xfd, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01,
+        0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x00,
+        0x00, 0x01, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x01, 0xf1, 0xff,
+    };
+    constexpr uint16_t logo_packed_bands[] PROGMEM = {
+        0, 44, 126, 262, 398, 534, 616, 717,
+    };
+    constexpr image::PackedImage logo_packed = {
+        logo_packed_data, logo_packed_bands, logo_width, logo_height
+    };
 }
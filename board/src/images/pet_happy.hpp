@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <stdint.h>
 #include <cstddef>
+#include "core/image.hpp"
 
 namespace images {
     constexpr uint8_t pet_happy[] PROGMEM = {
@@ -73,4 +74,55 @@ namespace images {
     };
     constexpr size_t pet_happy_width = 512;
     constexpr size_t pet_happy_height = 64;
+    constexpr uint8_t pet_happy_packed_data[] PROGMEM = {
+        0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00,
+        0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00,
+        0xfd, 0x00, 0x01, 0x03, 0xc0, 0xfd, 0x00, 0x01, 0x03, 0xc0, 0xcd, 0x00, 0xfd, 0x00, 0x01, 0x0f,
+        0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xcd, 0x00, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01,
+        0x1f, 0xf8, 0xf9, 0x00, 0x01, 0x07, 0xe0, 0xfd, 0x00, 0x01, 0x07, 0xe0, 0xe9, 0x00, 0x01, 0x07,
+        0xe0, 0xfd, 0x00, 0x01, 0x07, 0xe0, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xfd, 0x00, 0x01,
+        0x3f, 0xfc, 0xf9, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xe9, 0x00, 0x01, 0x1f,
+        0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01,
+        0x7f, 0xfe, 0xf9, 0x00, 0x01, 0x3f, 0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xe9, 0x00, 0x01, 0x3f,
+        0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01,
+        0x7f, 0xfe, 0xf9, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xe9, 0x00, 0x01, 0x7f,
+        0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0xfd, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff,
+        0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01,
+        0x1f, 0xf8, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xfd, 0x00, 0xff, 0xff,
+        0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff,
+        0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xfd, 0x00,
+        0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00,
+        0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xfd, 0x00,
+        0xfd, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff, 0xff,
+        0xf9, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xf9, 0x00, 0xff, 0xff, 0xfd, 0x00,
+        0xff, 0xff, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xf9, 0x00,
+        0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xe9, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01,
+        0x7f, 0xfe, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xf9, 0x00,
+        0x01, 0x3f, 0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xe9, 0x00, 0x01, 0x3f, 0xfc, 0xfd, 0x00, 0x01,
+        0x3f, 0xfc, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xf9, 0x00,
+        0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xe9, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01,
+        0x1f, 0xf8, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xf8, 0xf9, 0x00,
+        0x01, 0x07, 0xe0, 0xfd, 0x00, 0x01, 0x07, 0xe0, 0xe9, 0x00, 0x01, 0x07, 0xe0, 0xfd, 0x00, 0x01,
+        0x07, 0xe0, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xcd, 0x00,
+        0xfd, 0x00, 0x07, 0x03, 0xc0, 0x00, 0xff, 0xff, 0x00, 0x03, 0xc0, 0xf6, 0x00, 0xff, 0xff, 0xf3,
+        0x00, 0xff, 0xff, 0xf3, 0x00, 0xff, 0xff, 0xfa, 0x00, 0xfb, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80,
+        0xf5, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf5, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf5, 0x00,
+        0x03, 0x01, 0xff, 0xff, 0x80, 0xfb, 0x00, 0xfb, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf5, 0x00,
+        0x03, 0x01, 0xff, 0xff, 0x80, 0xf5, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf5, 0x00, 0x03, 0x01,
+        0xff, 0xff, 0x80, 0xfb, 0x00, 0xfa, 0x00, 0xff, 0xff, 0xf3, 0x00, 0xff, 0xff, 0xf3, 0x00, 0xff,
+        0xff, 0xf3, 0x00, 0xff, 0xff, 0xfa, 0x00, 0xfa, 0x00, 0x01, 0x7f, 0xfe, 0xf3, 0x00, 0x01, 0x7f,
+        0xfe, 0xf3, 0x00, 0x01, 0x7f, 0xfe, 0xf3, 0x00, 0x01, 0x7f, 0xfe, 0xfa, 0x00, 0xfa, 0x00, 0x01,
+        0x3f, 0xfc, 0xf3, 0x00, 0x01, 0x3f, 0xfc, 0xf3, 0x00, 0x01, 0x3f, 0xfc, 0xf3, 0x00, 0x01, 0x3f,
+        0xfc, 0xfa, 0x00, 0xfa, 0x00, 0x01, 0x0f, 0xf0, 0xf3, 0x00, 0x01, 0x0f, 0xf0, 0xf3, 0x00, 0x01,
+        0x0f, 0xf0, 0xf3, 0x00, 0x01, 0x0f, 0xf0, 0xfa, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1,
+        0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1,
+        0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1,
+        0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xc1, 0x00,
+    };
+    constexpr uint16_t pet_happy_packed_bands[] PROGMEM = {
+        0, 16, 32, 254, 489, 637, 653, 669,
+    };
+    constexpr image::PackedImage pet_happy_packed = {
+        pet_happy_packed_data, pet_happy_packed_bands, pet_happy_width, pet_happy_height
+    };
 }
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <stdint.h>
 #include <cstddef>
+#include "core/image.hpp"
 
 namespace images {
     constexpr uint8_t playing_music[] PROGMEM = {
@@ -73,4 +74,33 @@ namespace images {
     };
     constexpr size_t playing_music_width = 128;
     constexpr size_t playing_music_height = 64;
+    constexpr uint8_t playing_music_packed_data[] PROGMEM = {
+        0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff,
+        0xf1, 0xff, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf9, 0x00,
+        0x00, 0x18, 0xfa, 0x00, 0xf9, 0x00, 0x00, 0x3c, 0xfa, 0x00, 0xf9, 0x00, 0x00, 0x3e, 0xfa, 0x00,
+        0xf9, 0x00, 0x00, 0x3e, 0xfa, 0x00, 0xf9, 0x00, 0x01, 0x7f, 0x80, 0xfb, 0x00, 0xf9, 0x00, 0x01,
+        0x7f, 0xf0, 0xfb, 0x00, 0xf9, 0x00, 0x01, 0x73, 0xf8, 0xfb, 0x00, 0xf9, 0x00, 0x01, 0x70, 0xf0,
+        0xfb, 0x00, 0xf9, 0x00, 0x00, 0xe0, 0xfa, 0x00, 0xf9, 0x00, 0x00, 0xe0, 0xfa, 0x00, 0xf9, 0x00,
+        0x00, 0xe0, 0xfa, 0x00, 0xf9, 0x00, 0x00, 0xe0, 0xfa, 0x00, 0xf9, 0x00, 0x00, 0xe0, 0xfa, 0x00,
+        0xfa, 0x00, 0x01, 0x01, 0xc0, 0xfa, 0x00, 0xfa, 0x00, 0x01, 0x01, 0xc0, 0xfa, 0x00, 0xfa, 0x00,
+        0x03, 0x01, 0xc0, 0x00, 0x06, 0xfc, 0x00, 0xfa, 0x00, 0x03, 0x01, 0xc0, 0x00, 0x07, 0xfc, 0x00,
+        0xfa, 0x00, 0x04, 0x03, 0x80, 0x00, 0x0f, 0x80, 0xfd, 0x00, 0xfa, 0x00, 0x04, 0x03, 0x80, 0x00,
+        0x0d, 0x80, 0xfd, 0x00, 0xfa, 0x00, 0x04, 0x03, 0x80, 0x00, 0x08, 0xc0, 0xfd, 0x00, 0xfb, 0x00,
+        0x04, 0x3f, 0xf3, 0x80, 0x00, 0x18, 0xfc, 0x00, 0xfb, 0x00, 0x04, 0x7f, 0xfb, 0x80, 0x00, 0x18,
+        0xfc, 0x00, 0xfb, 0x00, 0xff, 0xff, 0x02, 0x00, 0x07, 0xb0, 0xfc, 0x00, 0xfc, 0x00, 0x05, 0x01,
+        0xff, 0xff, 0x00, 0x0f, 0xf0, 0xfc, 0x00, 0xfc, 0x00, 0x05, 0x03, 0xff, 0xff, 0x00, 0x0f, 0xe0,
+        0xfc, 0x00, 0xfc, 0x00, 0x05, 0x03, 0xff, 0xff, 0x00, 0x0f, 0xe0, 0xfc, 0x00, 0xfc, 0x00, 0x05,
+        0x03, 0xff, 0xfe, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0xfc, 0x00, 0x05, 0x03, 0xff, 0xfe, 0x00, 0x07,
+        0x80, 0xfc, 0x00, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xfe, 0xf9, 0x00, 0xfc, 0x00, 0x02, 0x03, 0xff,
+        0xfe, 0xf9, 0x00, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xfc, 0xf9, 0x00, 0xfc, 0x00, 0x02, 0x01, 0xff,
+        0xf8, 0xf9, 0x00, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xf9, 0x00, 0xfb, 0x00, 0x01, 0x7f, 0xe0, 0xf9,
+        0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1,
+        0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x00,
+    };
+    constexpr uint16_t playing_music_packed_bands[] PROGMEM = {
+        0, 16, 36, 88, 144, 226, 298, 319,
+    };
+    constexpr image::PackedImage playing_music_packed = {
+        playing_music_packed_data, playing_music_packed_bands, playing_music_width, playing_music_height
+    };
 }
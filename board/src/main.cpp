@@ -6,14 +6,21 @@
 
 #include "constants.hpp"
 #include "core/image.hpp"
+#include "core/framebuffer.hpp"
 #include "images/logo.hpp"
 #include "core/events.hpp"
 #include "core/sound.hpp"
 #include "core/jingle.hpp"
 #include "core/menu.hpp"
-#include "core/wifi.hpp"
+#include "core/network.hpp"
+#include "core/battery.hpp"
+#include "core/thermometer.hpp"
+#include "core/datalog.hpp"
+#include "core/deepsleep.hpp"
+#include "core/transfer.hpp"
 #include "core/logger.hpp"
 #include "core/timekeeper.hpp"
+#include "core/tilemap.hpp"
 #include "apps/alarm.hpp"
 
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
@@ -28,15 +35,23 @@ void setup() {
     if (wakeup_cause == ESP_SLEEP_WAKEUP_UNDEFINED) {
         // Fresh boot
         timekeeper::first_boot();
-        logger::info("WatchMan Starting...");
+        LOG_INFO("WatchMan Starting...");
     } else {
         // Wake from sleep
         timekeeper::wakeup();
-        logger::info("WatchMan Restarting from sleep...");
+        LOG_INFO("WatchMan Restarting from sleep...");
+    }
+    if (deepsleep::woke_up_for_sample()) {
+        // Only a data log sample is due: no display and no UI, back to deep sleep as soon as it is taken
+        pinMode(BAT_PIN, INPUT);
+        thermometer::read_once();
+        datalog::sample_once();
+        deepsleep::enter_deep_sleep();
+        LOG_INFO("Alarm imminent, booting.");
     }
     ledcSetup(0, 5000, 8); // initialize ledc state so it doesn't conflict with i2c
     Wire.begin(SDA_PIN, SCL_PIN);
-    logger::info("I2C Initialized.");
+    LOG_INFO("I2C Initialized.");
 
     pinMode(A_PIN, INPUT_PULLUP);
     pinMode(B_PIN, INPUT_PULLUP);
@@ -48,42 +63,59 @@ void setup() {
     pinMode(BAT_PIN, INPUT);
 
     pinMode(BUZZER_PIN, OUTPUT);
-    logger::info("Pins Configured.");
+    LOG_INFO("Pins Configured.");
 
     if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR)) {
-        logger::error("Monitor allocation failed");
+        LOG_ERROR("Monitor allocation failed");
         hlt();
     }
     
     display.ssd1306_command(SSD1306_DISPLAYON);
-    image::display_image(images::logo, display);
-    logger::info("Display Initialized.");
-
-    wifi::init();
-    logger::info("WiFi System Initialized.");
+    framebuffer::init();
+    image::display_image(images::logo_packed, display);
+    LOG_INFO("Display Initialized.");
 
     events::enable_events();
-    logger::info("Event System Initialized.");
+    LOG_INFO("Event System Initialized.");
 
     menu::init();
-    logger::info("Menu System Initialized.");
+    LOG_INFO("Menu System Initialized.");
+
+    network::init();
+    timekeeper::add_ntp_job();
+    LOG_INFO("Network Scheduler Initialized.");
+
+    battery::init();
+    LOG_INFO("Battery Monitor Initialized.");
+
+    thermometer::init();
+    LOG_INFO("Thermometer Initialized.");
+
+    datalog::init();
+    LOG_INFO("Data Log Initialized.");
+
+    transfer::init();
+    LOG_INFO("Serial Export Initialized.");
 
     sound::init();
-    logger::info("Sound System Initialized.");
+    LOG_INFO("Sound System Initialized.");
 
     apps::alarm::init();
-    logger::info("Alarm App Initialized.");
+    LOG_INFO("Alarm App Initialized.");
+
+    tilemap::init();
+    LOG_INFO("Map Tiles Initialized.");
 
     if (wakeup_cause == ESP_SLEEP_WAKEUP_TIMER) {
-        logger::info("Imminent alarm, skipping boot jingle.");
+        LOG_INFO("Imminent alarm, skipping boot jingle.");
         menu::current_app = menu::App::ALARM;
     } else {
         sound::play_melody(boot_jingle_melody, sizeof(boot_jingle_melody)/sizeof(boot_jingle_melody[0]));
     }
     display.clearDisplay();
-    display.display();
+    framebuffer::flush(display);
     events::clear_event_queue();
-    logger::info("Setup Complete.");
+    LOG_INFO("Setup Complete.");
 }
 
 void loop() {
@@ -0,0 +1,615 @@
+// This file was generated by gen_map_tiles.py
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+
+namespace maps {
+    // Zoom levels 128x64, 256x128, 512x256 in the tile store format
+    constexpr uint8_t earth[] PROGMEM = {
+        0x57, 0x4d, 0x41, 0x50, 0x01, 0x00, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00,
+        0x24, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+        0x54, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00,
+        0xc4, 0x03, 0x00, 0x00, 0xdb, 0x04, 0x00, 0x00, 0x75, 0x06, 0x00, 0x00, 0xda, 0x07, 0x00, 0x00,
+        0x2a, 0x09, 0x00, 0x00, 0x6d, 0x09, 0x00, 0x00, 0xb9, 0x0a, 0x00, 0x00, 0x7b, 0x0b, 0x00, 0x00,
+        0xa1, 0x0c, 0x00, 0x00, 0xa1, 0x0c, 0x00, 0x00, 0x4e, 0x0d, 0x00, 0x00, 0x50, 0x0e, 0x00, 0x00,
+        0xe3, 0x0f, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00, 0xf3, 0x11, 0x00, 0x00, 0x86, 0x12, 0x00, 0x00,
+        0xe1, 0x12, 0x00, 0x00, 0xd4, 0x13, 0x00, 0x00, 0xe4, 0x13, 0x00, 0x00, 0xd9, 0x14, 0x00, 0x00,
+        0x50, 0x16, 0x00, 0x00, 0x8a, 0x17, 0x00, 0x00, 0xbf, 0x18, 0x00, 0x00, 0xf4, 0x19, 0x00, 0x00,
+        0x95, 0x1b, 0x00, 0x00, 0xed, 0x1b, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x15, 0x1c, 0x00, 0x00,
+        0x9f, 0x1d, 0x00, 0x00, 0x38, 0x1e, 0x00, 0x00, 0x8b, 0x1f, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+        0x10, 0x21, 0x00, 0x00, 0xa1, 0x22, 0x00, 0x00, 0xfc, 0x22, 0x00, 0x00, 0x22, 0x23, 0x00, 0x00,
+        0x37, 0x24, 0x00, 0x00, 0xa0, 0x24, 0x00, 0x00, 0xc3, 0x24, 0x00, 0x00, 0x07, 0x25, 0x00, 0x00,
+        0x24, 0x25, 0x00, 0x00, 0xcc, 0x25, 0x00, 0x00, 0xe5, 0x00, 0x03, 0xff, 0x9f, 0xff, 0xf0, 0xfe,
+        0x00, 0x25, 0x19, 0xfd, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0x9c, 0x80, 0x9f, 0xff, 0x80, 0x00,
+        0x00, 0x0f, 0x25, 0x78, 0x07, 0xff, 0x00, 0x01, 0xf0, 0x00, 0x73, 0x7f, 0x07, 0xff, 0x00, 0xc3,
+        0xff, 0xff, 0xfd, 0xb5, 0xc7, 0xf8, 0x00, 0x27, 0xfe, 0xff, 0x11, 0xa7, 0x83, 0xc0, 0x70, 0x03,
+        0xff, 0xff, 0xfe, 0x06, 0x01, 0xc0, 0x00, 0x01, 0xc1, 0xff, 0xfe, 0x07, 0x40, 0xfd, 0x00, 0x13,
+        0x7f, 0xff, 0x8f, 0xe0, 0x00, 0x01, 0x00, 0x00, 0x7f, 0xff, 0xef, 0xf8, 0x00, 0x05, 0x00, 0x00,
+        0x0f, 0xff, 0xff, 0xe8, 0xfd, 0x00, 0x0b, 0x0f, 0xff, 0xff, 0xd8, 0x00, 0x01, 0x00, 0x00, 0x0f,
+        0xff, 0xff, 0xc0, 0xfd, 0x00, 0x25, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0xff,
+        0xfc, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xff,
+        0xf8, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x04, 0x7c,
+        0x10, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x04, 0x1c,
+        0x10, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x04, 0x1c, 0x83, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x04, 0x07,
+        0x80, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x03, 0x23, 0x00,
+        0x00, 0x1f, 0xfd, 0x00, 0x03, 0x17, 0xe0, 0x00, 0x0f, 0xfd, 0x00, 0x03, 0x07, 0xf8, 0x00, 0x07,
+        0xfd, 0x00, 0x01, 0x07, 0xfc, 0xfb, 0x00, 0x01, 0x0f, 0xfe, 0xfb, 0x00, 0x02, 0x0f, 0xff, 0xc0,
+        0xfc, 0x00, 0x02, 0x0f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0xf0, 0xfc, 0x00, 0x04, 0x07,
+        0xff, 0xe0, 0x00, 0x10, 0xfe, 0x00, 0x04, 0x07, 0xff, 0xe0, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x01,
+        0xff, 0xe0, 0xfb, 0x00, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x01, 0xff, 0xc0, 0xfc, 0x00, 0x01, 0x01,
+        0xfe, 0xfb, 0x00, 0x01, 0x01, 0xfe, 0xfb, 0x00, 0x01, 0x01, 0xfe, 0xfb, 0x00, 0x01, 0x01, 0xfc,
+        0xfb, 0x00, 0x01, 0x01, 0xf0, 0xfb, 0x00, 0x01, 0x03, 0xc0, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xfb,
+        0x00, 0x01, 0x03, 0x80, 0xfb, 0x00, 0x01, 0x03, 0x80, 0xfb, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00,
+        0x03, 0xe1, 0x00, 0x00, 0x20, 0xfa, 0x00, 0x00, 0x80, 0xfb, 0x00, 0x03, 0x01, 0xc0, 0x00, 0x01,
+        0xfe, 0x00, 0x06, 0x0d, 0x84, 0xe0, 0x00, 0x1f, 0x00, 0x0f, 0xfe, 0xff, 0x0c, 0x80, 0x01, 0xff,
+        0x02, 0x7f, 0xff, 0xff, 0xe9, 0x01, 0x8f, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x03, 0xc0, 0x3f, 0xff,
+        0xe3, 0xf2, 0xff, 0xe1, 0x00, 0x04, 0x07, 0x20, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x04, 0x03, 0x00,
+        0x3f, 0x80, 0x40, 0xfe, 0x00, 0x03, 0x18, 0x47, 0xff, 0xec, 0xfe, 0x00, 0x02, 0xb0, 0x04, 0xdf,
+        0xfe, 0xff, 0x04, 0x80, 0x03, 0xfe, 0xbf, 0xdf, 0xfd, 0xff, 0x01, 0x0f, 0x7d, 0xfb, 0xff, 0x00,
+        0x3e, 0xfb, 0xff, 0x01, 0xde, 0x1e, 0xfc, 0xff, 0x02, 0xe2, 0x40, 0x14, 0xfc, 0xff, 0x02, 0xc0,
+        0xe0, 0xbf, 0xfc, 0xff, 0x02, 0xe0, 0x80, 0x7f, 0xfc, 0xff, 0x01, 0xd0, 0x00, 0xfb, 0xff, 0x04,
+        0xc0, 0x00, 0xff, 0xeb, 0x9f, 0xfe, 0xff, 0x13, 0x80, 0x00, 0xc5, 0xc1, 0xdf, 0xff, 0xff, 0xfe,
+        0x00, 0x00, 0x12, 0xbf, 0xdf, 0xff, 0xff, 0xe4, 0x20, 0x00, 0x70, 0x0f, 0xfe, 0xff, 0x04, 0xf6,
+        0x60, 0x00, 0xf0, 0x07, 0xfe, 0xff, 0x03, 0xe0, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0x1f, 0xf0, 0x00,
+        0x00, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xfb, 0xef, 0xff, 0xff, 0xe0, 0x00,
+        0x00, 0xff, 0xfb, 0xfc, 0x7f, 0xff, 0x90, 0x00, 0x00, 0xff, 0xfd, 0xf8, 0x3e, 0x3d, 0xfe, 0x00,
+        0x14, 0xff, 0xfc, 0xf0, 0x1c, 0x3e, 0x10, 0x00, 0x00, 0xff, 0xfe, 0xc0, 0x18, 0x1e, 0x10, 0x00,
+        0x00, 0xff, 0xff, 0x20, 0x18, 0x06, 0xfe, 0x00, 0xff, 0xff, 0x27, 0xc0, 0x00, 0x10, 0x08, 0x00,
+        0x00, 0xbf, 0xff, 0xc0, 0x00, 0x08, 0x20, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x34, 0xc0, 0x00,
+        0x00, 0x0f, 0xff, 0x00, 0x00, 0x09, 0xc2, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0c, 0xc3, 0x62,
+        0x00, 0x07, 0xfc, 0xfd, 0x00, 0x03, 0x3d, 0x00, 0x07, 0xfc, 0xfe, 0x00, 0x04, 0xf4, 0x78, 0x00,
+        0x07, 0xfe, 0xfe, 0x00, 0x04, 0x01, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0x00, 0x24, 0x05, 0x90, 0x00,
+        0x07, 0xfc, 0xc0, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x07, 0xf8, 0xc0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
+        0x03, 0xf8, 0xc0, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x03, 0xf0, 0x80, 0x00, 0x00, 0x7f, 0xfe, 0x00,
+        0x03, 0xf0, 0xfe, 0x00, 0x04, 0x7f, 0xfe, 0x00, 0x01, 0xe0, 0xfe, 0x00, 0x04, 0x7f, 0xfe, 0x00,
+        0x01, 0xc0, 0xfe, 0x00, 0x01, 0x70, 0xfc, 0xfa, 0x00, 0x01, 0x3c, 0x02, 0xfa, 0x00, 0x00, 0x02,
+        0xfb, 0x00, 0x01, 0x08, 0x04, 0xfa, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x10, 0xd7, 0x00, 0x09,
+        0x3c, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x46, 0x1f, 0xff, 0xbf, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff,
+        0x00, 0x7f, 0xfe, 0xff, 0x00, 0xf8, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0xe0, 0xfa, 0xff,
+        0x00, 0xc0, 0xf1, 0xff, 0xca, 0x00, 0x00, 0x01, 0xfa, 0x00, 0x00, 0x0f, 0xfb, 0x00, 0x01, 0x03,
+        0x93, 0xfc, 0x00, 0x01, 0x0c, 0x04, 0xfb, 0x00, 0x02, 0x5b, 0x93, 0xe1, 0xfc, 0x00, 0x02, 0x01,
+        0xc0, 0x08, 0xfc, 0x00, 0x02, 0xfe, 0x0c, 0x77, 0xfc, 0x00, 0x0c, 0xef, 0xfc, 0x2c, 0x00, 0x03,
+        0xfe, 0x00, 0x04, 0x00, 0x7f, 0x0e, 0x80, 0x3f, 0xfe, 0xff, 0x04, 0xfe, 0xf3, 0x3f, 0xf0, 0x0f,
+        0xfd, 0xff, 0x03, 0xef, 0xf7, 0xff, 0x37, 0xfb, 0xff, 0x01, 0x0c, 0x3b, 0xfb, 0xff, 0x01, 0x01,
+        0x87, 0xfb, 0xff, 0x01, 0x00, 0x1f, 0xfc, 0xff, 0x04, 0xfc, 0x04, 0x1f, 0xfe, 0x7f, 0xfe, 0xff,
+        0x04, 0xf8, 0x00, 0x07, 0xe0, 0x03, 0xfe, 0xff, 0x0d, 0xf8, 0x00, 0x00, 0xd0, 0x00, 0xbf, 0xff,
+        0xff, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x04, 0x00, 0x08, 0x00, 0x00, 0x3f, 0xfe,
+        0xff, 0x04, 0x00, 0x40, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0x00, 0x0c, 0xfe, 0x00, 0x00, 0x07, 0xfe,
+        0xff, 0xfd, 0x00, 0x00, 0x05, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0x01, 0x7f, 0xff, 0xff, 0xfc, 0x00,
+        0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00,
+        0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff,
+        0xfc, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0f,
+        0xff, 0xff, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x02, 0xff, 0xff, 0xfc, 0x00,
+        0x02, 0x03, 0x7f, 0xfd, 0xfc, 0x00, 0x02, 0x01, 0x7f, 0xf0, 0xfb, 0x00, 0x01, 0xbf, 0xe0, 0xfb,
+        0x00, 0x01, 0x5f, 0xe0, 0xfb, 0x00, 0x01, 0x2f, 0xe0, 0xfb, 0x00, 0x01, 0x07, 0xe0, 0xfb, 0x00,
+        0x01, 0x03, 0xe0, 0xfb, 0x00, 0x01, 0x03, 0xf0, 0xfb, 0x00, 0x01, 0x01, 0xfb, 0xfa, 0x00, 0x00,
+        0x7f, 0xfa, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x01, 0xb9, 0x00, 0xd8, 0x00, 0x09, 0x3f, 0x80,
+        0x01, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x87, 0xfe, 0xff, 0x04, 0xaf, 0x00, 0xdb, 0xfe, 0x7f,
+        0xfe, 0xff, 0x03, 0xf8, 0x00, 0xff, 0xf3, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0xbf, 0x84, 0xfd, 0xff,
+        0x04, 0xe0, 0x00, 0x80, 0x00, 0x87, 0xfe, 0xff, 0x04, 0xc0, 0x00, 0xba, 0x00, 0x00, 0xfe, 0xff,
+        0x3e, 0xe0, 0x00, 0x6f, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x5f, 0xff,
+        0xff, 0x80, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x4e, 0x3f, 0x00, 0x0f, 0xff,
+        0xfc, 0x00, 0x00, 0xde, 0x27, 0xe0, 0x3f, 0xff, 0x80, 0x00, 0x00, 0xe8, 0x0f, 0xf0, 0x3f, 0xfe,
+        0x00, 0x9c, 0x00, 0xdc, 0x7f, 0xc0, 0x1f, 0xf0, 0x01, 0x7e, 0x00, 0x00, 0x07, 0x60, 0x0f, 0xe0,
+        0xfe, 0x00, 0x04, 0x01, 0x78, 0x40, 0x07, 0xe0, 0xfd, 0x00, 0x09, 0x7e, 0x20, 0x00, 0xc0, 0x00,
+        0x00, 0x01, 0x00, 0x7e, 0x30, 0xfb, 0x00, 0x01, 0x3f, 0xf0, 0xfd, 0x00, 0x03, 0x1e, 0xc0, 0xbf,
+        0xf8, 0xfd, 0x00, 0x03, 0x06, 0xfc, 0xff, 0xfe, 0xfd, 0x00, 0x04, 0x37, 0xfc, 0xff, 0xff, 0x80,
+        0xfe, 0x00, 0x04, 0x77, 0xfe, 0x7f, 0xff, 0x80, 0xfe, 0x00, 0x04, 0x67, 0xff, 0xff, 0xfc, 0x80,
+        0xfe, 0x00, 0x04, 0x05, 0xff, 0xff, 0x69, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0xff, 0xe3, 0xc0,
+        0xfe, 0x00, 0x03, 0x07, 0xff, 0xff, 0xf4, 0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0xb0, 0xfc, 0x00,
+        0x01, 0xff, 0xfe, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf8, 0xfc,
+        0x00, 0x02, 0x3f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xfc, 0x00, 0x02, 0x3f, 0xff,
+        0xe0, 0xfc, 0x00, 0x02, 0x08, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0x80, 0xfc, 0x00, 0x03,
+        0x1f, 0xfe, 0x00, 0x20, 0xfd, 0x00, 0x01, 0x3f, 0xfe, 0xfb, 0x00, 0x01, 0x7f, 0x86, 0xfb, 0x00,
+        0x01, 0x7f, 0x02, 0xfc, 0x00, 0x03, 0x04, 0xff, 0x03, 0x40, 0xfd, 0x00, 0x01, 0x01, 0xff, 0xfb,
+        0x00, 0x01, 0x03, 0xff, 0xfb, 0x00, 0x02, 0x07, 0xff, 0x07, 0xfc, 0x00, 0x03, 0x07, 0xff, 0xe0,
+        0x68, 0xfd, 0x00, 0x03, 0x0f, 0xff, 0xc0, 0x0e, 0xfd, 0x00, 0x04, 0x07, 0xff, 0xc0, 0x4e, 0x40,
+        0xfe, 0x00, 0x02, 0x07, 0xff, 0xc0, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x07,
+        0xff, 0xf8, 0xfc, 0x00, 0x02, 0x07, 0xff, 0x38, 0xfc, 0x00, 0x03, 0x07, 0xff, 0x18, 0x0b, 0xfd,
+        0x00, 0x04, 0x03, 0xff, 0x0c, 0x1b, 0xf8, 0xfe, 0x00, 0x04, 0x01, 0xff, 0x07, 0x7f, 0xfc, 0xfe,
+        0x00, 0x04, 0x01, 0xff, 0x00, 0x7f, 0xfe, 0xfd, 0x00, 0x04, 0xff, 0x00, 0x7f, 0xff, 0xc0, 0xfe,
+        0x00, 0x04, 0x7f, 0x00, 0x7f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xfc, 0x00, 0xff,
+        0xff, 0x00, 0xf8, 0xfd, 0x00, 0xcc, 0x00, 0x00, 0x44, 0xfe, 0x00, 0x04, 0x07, 0xe0, 0x00, 0x22,
+        0xc0, 0xfe, 0x00, 0x01, 0x7f, 0x18, 0xfb, 0x00, 0x01, 0x18, 0x80, 0xf7, 0x00, 0x00, 0x1f, 0xfa,
+        0x00, 0x02, 0xe0, 0x00, 0x03, 0xfd, 0x00, 0x03, 0x03, 0x80, 0x24, 0x3f, 0xfd, 0x00, 0x1f, 0x07,
+        0x00, 0x75, 0xff, 0x00, 0x00, 0xde, 0x00, 0x00, 0x20, 0xf7, 0xef, 0x00, 0x17, 0xff, 0xe0, 0x12,
+        0x2f, 0x73, 0xff, 0x00, 0x1f, 0xff, 0xfc, 0x9f, 0xff, 0xf7, 0xff, 0x00, 0x3f, 0xff, 0x9b, 0xfd,
+        0xff, 0x03, 0x00, 0xff, 0x3f, 0xb7, 0xfd, 0xff, 0x01, 0x03, 0xfd, 0xfb, 0xff, 0x01, 0x0f, 0xf8,
+        0xfb, 0xff, 0x02, 0x0f, 0xf8, 0xf7, 0xfc, 0xff, 0x01, 0x07, 0xfc, 0xfb, 0xff, 0x02, 0x00, 0x74,
+        0xbf, 0xfc, 0xff, 0x01, 0x03, 0x71, 0xfb, 0xff, 0x01, 0x03, 0x85, 0xfb, 0xff, 0x00, 0x8f, 0xfa,
+        0xff, 0x00, 0xdf, 0xfa, 0xff, 0x00, 0x3f, 0xe8, 0xff, 0x02, 0xfd, 0xdf, 0xf3, 0xfd, 0xff, 0x03,
+        0xbf, 0xfc, 0xdf, 0xc7, 0xfe, 0xff, 0x04, 0xfc, 0xcf, 0xf8, 0x07, 0xc7, 0xfe, 0xff, 0x04, 0xe0,
+        0x63, 0xf0, 0x03, 0xe3, 0xfe, 0xff, 0x04, 0x82, 0x3b, 0xd7, 0xff, 0xf3, 0xfe, 0xff, 0x04, 0x02,
+        0x09, 0x9f, 0xff, 0xf3, 0xfe, 0xff, 0x04, 0x00, 0x70, 0xcf, 0xff, 0xe1, 0xfe, 0xff, 0x03, 0x7f,
+        0x00, 0x05, 0xbf, 0xfc, 0xff, 0x02, 0x00, 0x20, 0xbf, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xfc,
+        0xff, 0x02, 0xe1, 0x80, 0x7f, 0xfc, 0xff, 0x00, 0xf9, 0xf7, 0xff, 0x00, 0xef, 0xfa, 0xff, 0x00,
+        0xe7, 0xfb, 0xff, 0x02, 0xbf, 0xf1, 0x7f, 0xfc, 0xff, 0x02, 0x9f, 0xf8, 0xbe, 0xfc, 0xff, 0x02,
+        0xcf, 0xff, 0x80, 0xfc, 0xff, 0x03, 0xcf, 0xff, 0xe0, 0x3f, 0xfd, 0xff, 0x04, 0xef, 0xff, 0xc0,
+        0x3f, 0xfc, 0xfe, 0xff, 0x04, 0xe7, 0xff, 0xc0, 0x0f, 0xf8, 0xfe, 0xff, 0x04, 0xf3, 0xff, 0x80,
+        0x0f, 0xf0, 0xfe, 0xff, 0x04, 0xf1, 0xfe, 0x00, 0x07, 0xe0, 0xfe, 0xff, 0x04, 0xf9, 0xfc, 0x00,
+        0x07, 0xc0, 0xfe, 0xff, 0x04, 0xfd, 0xe0, 0x00, 0x07, 0xc0, 0xfe, 0xff, 0x04, 0xfe, 0x02, 0x00,
+        0x03, 0xc0, 0xfe, 0xff, 0x04, 0xfe, 0x18, 0x00, 0x03, 0x80, 0xfd, 0xff, 0x03, 0xf8, 0x00, 0x01,
+        0xc0, 0xfd, 0xff, 0x03, 0xf0, 0x00, 0x01, 0x40, 0xfd, 0xff, 0x04, 0xf0, 0x00, 0x00, 0x60, 0x8f,
+        0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff,
+        0x00, 0xc0, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xfd, 0x00, 0xc9, 0x00, 0x00, 0x3c, 0xfa, 0x00,
+        0x01, 0x02, 0xe0, 0xfa, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x04, 0x1f, 0xff, 0x80, 0x00, 0x34, 0xfe,
+        0x00, 0xff, 0xff, 0xfb, 0x00, 0xff, 0xff, 0x01, 0xfc, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x04, 0xfa,
+        0x0f, 0xe0, 0x00, 0x00, 0xfb, 0xff, 0x01, 0xc0, 0x00, 0xfa, 0xff, 0x00, 0xbf, 0xdb, 0xff, 0x01,
+        0xf7, 0xf8, 0xfc, 0xff, 0x02, 0xfe, 0x0f, 0x40, 0xfd, 0xff, 0x03, 0xfc, 0x18, 0x34, 0x00, 0xfd,
+        0xff, 0x03, 0xf0, 0x00, 0xf8, 0x00, 0xfd, 0xff, 0x03, 0xe0, 0x01, 0xf8, 0x00, 0xfd, 0xff, 0x03,
+        0xa0, 0x01, 0xf0, 0x00, 0xfd, 0xff, 0x03, 0xfc, 0x01, 0xc0, 0x00, 0xfd, 0xff, 0x03, 0xfc, 0x00,
+        0x80, 0x00, 0xfd, 0xff, 0x00, 0xf6, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0xfd, 0xff,
+        0x00, 0xf4, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xe6, 0xfe, 0x00, 0xfd, 0xff, 0x03, 0xc4, 0x40, 0x00,
+        0x00, 0xfd, 0xff, 0x03, 0x87, 0x80, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0xfe, 0xff,
+        0x01, 0xf8, 0x08, 0xfe, 0x00, 0xff, 0xff, 0x02, 0xf8, 0x20, 0x08, 0xfe, 0x00, 0xff, 0xff, 0x02,
+        0xf8, 0x70, 0x18, 0xfe, 0x00, 0xff, 0xff, 0x02, 0xfe, 0x38, 0x38, 0xfe, 0x00, 0xff, 0xff, 0x02,
+        0xf8, 0x31, 0xe0, 0xfe, 0x00, 0xff, 0xff, 0x01, 0xfc, 0x05, 0xfd, 0x00, 0xff, 0xff, 0x01, 0xfe,
+        0x04, 0xfd, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0xff,
+        0xff, 0x01, 0xfe, 0x08, 0xfd, 0x00, 0xff, 0xff, 0x02, 0xfc, 0x10, 0x04, 0xfe, 0x00, 0xff, 0xff,
+        0x00, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xf2, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xc2, 0xfc, 0x00,
+        0x01, 0x3f, 0xfa, 0xfb, 0x00, 0x01, 0x1f, 0xf2, 0xfb, 0x00, 0x02, 0x0f, 0xf0, 0x02, 0xfc, 0x00,
+        0x02, 0x0b, 0xf8, 0x03, 0xfc, 0x00, 0x02, 0x03, 0xfc, 0x02, 0xfc, 0x00, 0x02, 0x03, 0xfc, 0x03,
+        0xfc, 0x00, 0x02, 0x23, 0xfc, 0x02, 0xfb, 0x00, 0x02, 0x3c, 0x01, 0x40, 0xfc, 0x00, 0x02, 0x10,
+        0x01, 0x80, 0xfd, 0x00, 0x03, 0x03, 0x00, 0x00, 0xc0, 0xfd, 0x00, 0x03, 0x01, 0x00, 0x10, 0x40,
+        0xfc, 0x00, 0x01, 0xc0, 0x18, 0xfc, 0x00, 0x02, 0x04, 0xc0, 0x70, 0xfc, 0x00, 0x02, 0x0b, 0x60,
+        0xf0, 0xfc, 0x00, 0x03, 0x01, 0xa3, 0xf8, 0x50, 0xfd, 0x00, 0xfa, 0x00, 0x00, 0x01, 0xb9, 0x00,
+        0x00, 0x02, 0xf2, 0x00, 0x00, 0x80, 0x81, 0x00, 0x81, 0x00, 0xbc, 0x00, 0x01, 0x01, 0xf3, 0xfc,
+        0x00, 0x02, 0x1f, 0x40, 0x7f, 0xfe, 0x00, 0xfc, 0xff, 0xff, 0x00, 0x01, 0xef, 0x7f, 0xfd, 0xff,
+        0x02, 0x00, 0x08, 0x3f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x03, 0xfc, 0xff, 0x02, 0x00, 0x04, 0x3f,
+        0xfc, 0xff, 0x02, 0x07, 0x0c, 0x7f, 0xfc, 0xff, 0x01, 0xfc, 0x1f, 0xe3, 0xff, 0x03, 0x01, 0xff,
+        0xff, 0xf8, 0xfd, 0x00, 0x04, 0x01, 0xff, 0xff, 0xef, 0x80, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0xff,
+        0x00, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x01, 0xfd, 0xff,
+        0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xfe, 0xfd,
+        0x00, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03,
+        0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x1f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x07, 0xff,
+        0xff, 0xf8, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0xf0,
+        0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0xe0, 0xfd, 0x00,
+        0x02, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xfc,
+        0xfc, 0x00, 0x02, 0x03, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x03,
+        0xff, 0xf8, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xe0, 0xfc, 0x00,
+        0x01, 0x07, 0xff, 0xfb, 0x00, 0x01, 0x07, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01,
+        0x0f, 0xf0, 0xfb, 0x00, 0x01, 0x0f, 0xf0, 0xfb, 0x00, 0x01, 0x07, 0xe0, 0xfb, 0x00, 0x01, 0x07,
+        0xc0, 0xfb, 0x00, 0x01, 0x0f, 0xc0, 0xfb, 0x00, 0x01, 0x1f, 0x80, 0xfb, 0x00, 0x01, 0x0f, 0xc0,
+        0xfb, 0x00, 0x00, 0x1f, 0xfa, 0x00, 0x00, 0x1e, 0xfa, 0x00, 0x01, 0x0f, 0x06, 0xfb, 0x00, 0x00,
+        0x0f, 0xfa, 0x00, 0x01, 0x01, 0xe0, 0xda, 0x00, 0x00, 0x01, 0xfa, 0x00, 0x01, 0x01, 0x80, 0xfb,
+        0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x38, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xfb, 0x00, 0x01, 0x06,
+        0x60, 0xfb, 0x00, 0x01, 0x07, 0xf0, 0xfd, 0x00, 0x03, 0x02, 0x00, 0x1f, 0x78, 0xfd, 0x00, 0x03,
+        0xff, 0xd1, 0x31, 0xfc, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x0f,
+        0xfe, 0xff, 0x03, 0x80, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xfe, 0xff, 0x04,
+        0xfd, 0x83, 0x00, 0x07, 0xc1, 0xfd, 0xff, 0x04, 0xe0, 0x04, 0x3f, 0xc0, 0x3f, 0xfd, 0xff, 0x02,
+        0xf0, 0x00, 0x1f, 0xfc, 0xff, 0x00, 0xf9, 0xdc, 0xff, 0x03, 0x01, 0xff, 0xff, 0xfe, 0xfd, 0x00,
+        0x03, 0x01, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x02, 0x7f, 0xff,
+        0xf8, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf8, 0xfc, 0x00, 0x02,
+        0x3f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf8, 0xfc,
+        0x00, 0x03, 0x3f, 0xff, 0xf8, 0x90, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xf8, 0x10, 0xfd, 0x00, 0x03,
+        0x7f, 0xff, 0xf8, 0x30, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xf0, 0xf0, 0xfd, 0x00, 0x03, 0x7f, 0xff,
+        0xe0, 0xf0, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0x80, 0xe0, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0x80, 0xe0,
+        0xfd, 0x00, 0x03, 0x1f, 0xff, 0xc1, 0xe0, 0xfd, 0x00, 0x03, 0x1f, 0xff, 0xc1, 0xc0, 0xfd, 0x00,
+        0x03, 0x1f, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x01, 0x1f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb,
+        0x00, 0x01, 0x07, 0xfe, 0xfb, 0x00, 0x01, 0x07, 0xfc, 0xfb, 0x00, 0x01, 0x07, 0xf8, 0xfb, 0x00,
+        0x01, 0x03, 0xe0, 0xa6, 0x00, 0x00, 0x60, 0xa4, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x03, 0x5f, 0xf4,
+        0x00, 0x0f, 0xfe, 0x00, 0x07, 0x87, 0xff, 0xff, 0xc0, 0xff, 0x31, 0x7c, 0x57, 0xfe, 0xff, 0x00,
+        0xdf, 0xfa, 0xff, 0x00, 0x9f, 0xfa, 0xff, 0x00, 0x7f, 0xa8, 0xff, 0x03, 0x01, 0xc3, 0xf0, 0x0c,
+        0xfc, 0x00, 0x03, 0xe1, 0xe7, 0x03, 0x20, 0xfd, 0x00, 0x04, 0xf1, 0xe4, 0x0b, 0x78, 0x08, 0xfe,
+        0x00, 0x03, 0x70, 0x05, 0x00, 0xff, 0xfd, 0x00, 0x04, 0x10, 0x04, 0x00, 0x1f, 0xf2, 0xfe, 0x00,
+        0x04, 0x0f, 0xe0, 0x00, 0x1f, 0x80, 0xfd, 0x00, 0x03, 0xfa, 0x20, 0x2e, 0xc0, 0xfc, 0x00, 0x03,
+        0x80, 0x00, 0x60, 0x20, 0xfd, 0x00, 0x02, 0x06, 0x04, 0x04, 0xfc, 0x00, 0x01, 0x07, 0xc4, 0xfb,
+        0x00, 0x01, 0x27, 0xc6, 0xfb, 0x00, 0x01, 0x7f, 0x87, 0xfb, 0x00, 0x0a, 0xff, 0xe7, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0xc0, 0xfd, 0x00,
+        0x04, 0x1f, 0xff, 0xff, 0xe0, 0x01, 0xfe, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x03,
+        0x7f, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x7f, 0xff,
+        0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfc, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfc,
+        0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x1f, 0xc0, 0xff, 0xf8, 0xfd, 0x00,
+        0x03, 0x3f, 0x00, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x03, 0x0f, 0xe0, 0x00,
+        0x08, 0xfd, 0x00, 0x03, 0x0e, 0xc0, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x0c, 0xfd, 0x00, 0x03, 0x01,
+        0x00, 0x00, 0x04, 0xfc, 0x00, 0x02, 0xc0, 0x00, 0x30, 0xfa, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x01,
+        0x01, 0xc0, 0xfa, 0x00, 0x00, 0x80, 0xeb, 0x00, 0x00, 0x02, 0xb0, 0x00, 0x03, 0x04, 0xe1, 0xc0,
+        0x07, 0xfd, 0x00, 0xfd, 0xff, 0x03, 0xfe, 0x00, 0x04, 0x00, 0xfc, 0xff, 0x02, 0xfe, 0x00, 0x00,
+        0xfb, 0xff, 0x01, 0xe0, 0x00, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0x80, 0xfb, 0xff, 0x01,
+        0xfc, 0x00, 0xfb, 0xff, 0x01, 0xf0, 0x00, 0xfb, 0xff, 0x01, 0xf9, 0x80, 0xfb, 0xff, 0x01, 0xf8,
+        0x00, 0xfb, 0xff, 0x01, 0xc0, 0x00, 0xfb, 0xff, 0x01, 0xf0, 0x00, 0xfa, 0xff, 0x00, 0x00, 0xe1,
+        0xff, 0x81, 0x00, 0xa9, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x60, 0xfb, 0x00, 0x02, 0x0f, 0xff,
+        0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x03, 0xe0, 0xc0, 0x00, 0x0f, 0xfc, 0xff, 0x02, 0xf8,
+        0x00, 0x0f, 0xfb, 0xff, 0x01, 0x00, 0x01, 0xfb, 0xff, 0x02, 0x78, 0x00, 0x7f, 0xfc, 0xff, 0x02,
+        0xfe, 0x0f, 0x3f, 0xfd, 0xff, 0x02, 0xd3, 0xf0, 0x3f, 0xfc, 0xff, 0x03, 0x00, 0xe0, 0x0f, 0xcf,
+        0xfd, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0x00, 0x03, 0x81, 0x7f, 0xfd, 0xff, 0xff,
+        0x00, 0x00, 0x03, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0xff, 0xff, 0x00, 0x15, 0x07, 0xff,
+        0xff, 0xdf, 0xff, 0xff, 0x00, 0x20, 0x07, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0x00, 0x00, 0x01, 0x3f,
+        0xfe, 0x72, 0x00, 0xff, 0xfe, 0x00, 0x04, 0x3f, 0xfc, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x03, 0xf9,
+        0x80, 0x00, 0x02, 0xfd, 0x00, 0x03, 0xf3, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x04, 0x01, 0xc6, 0x00,
+        0x00, 0x01, 0xfe, 0x00, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x38, 0xfb, 0x00, 0x01, 0x01, 0x80, 0xfb,
+        0x00, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x60, 0xf4, 0x00, 0x01, 0x01, 0xe0, 0xb3, 0x00, 0x9a, 0x00,
+        0x00, 0x02, 0xfa, 0x00, 0x00, 0x7e, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfd, 0x00,
+        0x03, 0x10, 0x1f, 0xc6, 0x1f, 0xfe, 0x00, 0x1c, 0x04, 0x78, 0x00, 0x73, 0xc0, 0x00, 0x00, 0x01,
+        0xf0, 0x40, 0x30, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x70, 0x0c, 0x08, 0xe9, 0xff, 0x00, 0x00, 0x36,
+        0x9f, 0x86, 0x4e, 0xfc, 0x07, 0xfe, 0x00, 0x44, 0x7d, 0xff, 0xc8, 0x78, 0xe7, 0x00, 0x00, 0x10,
+        0x03, 0xe0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x7c, 0x7f, 0x00, 0x01, 0xff,
+        0xfc, 0x01, 0xf0, 0x3a, 0x7e, 0x00, 0x03, 0xfe, 0xff, 0xfd, 0xe0, 0xfe, 0x70, 0x00, 0x00, 0xf9,
+        0xff, 0xff, 0xf0, 0x1c, 0xe0, 0x00, 0x00, 0x40, 0xff, 0xff, 0xf0, 0x01, 0xf0, 0x00, 0x30, 0x00,
+        0x00, 0x7f, 0xfe, 0x01, 0xfc, 0x4f, 0xfb, 0x78, 0x3f, 0xff, 0xfe, 0x04, 0xfe, 0xfe, 0xff, 0x04,
+        0xf9, 0xfe, 0x5e, 0x5f, 0xbf, 0xfe, 0xff, 0x04, 0xf8, 0x03, 0xf0, 0x0f, 0x3f, 0xfd, 0xff, 0x03,
+        0xfd, 0xff, 0xff, 0x7f, 0xca, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x00, 0xf0, 0xfa, 0xff, 0x00, 0xe0,
+        0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x01, 0xf0,
+        0xdf, 0xfb, 0xff, 0x01, 0xf8, 0xbf, 0xfa, 0xff, 0x00, 0x1f, 0xfa, 0xff, 0x00, 0x1f, 0xfa, 0xff,
+        0x00, 0x1b, 0xfa, 0xff, 0x00, 0x19, 0xfa, 0xff, 0x00, 0x09, 0xfa, 0xff, 0x01, 0x00, 0x7f, 0xfb,
+        0xff, 0x01, 0x00, 0x3f, 0xfb, 0xff, 0x01, 0x00, 0x1f, 0xfb, 0xff, 0x01, 0x00, 0x37, 0xfb, 0xff,
+        0x01, 0x00, 0x0f, 0xfb, 0xff, 0x02, 0x00, 0x03, 0x7f, 0xfc, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x01,
+        0x00, 0x01, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff,
+        0xaf, 0x00, 0x07, 0x1e, 0xff, 0xc0, 0x00, 0x00, 0x03, 0x07, 0xdf, 0xfe, 0xff, 0x02, 0x80, 0xf4,
+        0xfb, 0xfd, 0xff, 0x08, 0xd0, 0x7f, 0xff, 0xff, 0x3f, 0xfe, 0x7f, 0xff, 0x0f, 0xfe, 0xff, 0x04,
+        0xf7, 0xdf, 0xff, 0xf8, 0x7f, 0xfe, 0xff, 0x04, 0xfe, 0xff, 0xff, 0x00, 0x0f, 0xfc, 0xff, 0x01,
+        0xfe, 0x0f, 0xfd, 0xff, 0x03, 0x03, 0xff, 0xf8, 0x7f, 0xfd, 0xff, 0x03, 0x8f, 0xff, 0x80, 0x61,
+        0xfb, 0xff, 0x01, 0xc0, 0x03, 0xfd, 0xff, 0x05, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x3f, 0xfe, 0xff,
+        0x00, 0xfe, 0xfe, 0x00, 0x04, 0x07, 0xff, 0xff, 0xdf, 0xdc, 0xfd, 0x00, 0xff, 0xff, 0x00, 0x07,
+        0xfc, 0x00, 0x04, 0x7f, 0xff, 0x3d, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x7f, 0xff, 0x7d, 0xfc, 0x7c,
+        0xfe, 0x00, 0x04, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x1d, 0x77, 0xff, 0x6f, 0xff, 0xff,
+        0xf0, 0x00, 0x00, 0x0b, 0xff, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0x01, 0xf3, 0x5f,
+        0xff, 0x00, 0x00, 0x3f, 0xff, 0x61, 0xf8, 0x0f, 0xff, 0xfe, 0x00, 0x54, 0xff, 0xe7, 0xf0, 0x1c,
+        0xff, 0xc0, 0x00, 0x07, 0xff, 0xf7, 0xf8, 0x1c, 0x7f, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+        0x7f, 0xff, 0x80, 0x0f, 0xff, 0xfc, 0x80, 0x01, 0xff, 0xbf, 0x00, 0x0f, 0xff, 0xfb, 0x80, 0x31,
+        0xff, 0x8e, 0x00, 0x03, 0xff, 0xf3, 0xf0, 0x7f, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xe7, 0xdc, 0x00,
+        0x7f, 0xf8, 0x00, 0x01, 0xff, 0x01, 0x00, 0x40, 0x3f, 0x78, 0x00, 0x00, 0xff, 0x00, 0x70, 0x20,
+        0x0b, 0xc8, 0x00, 0x00, 0x7f, 0x00, 0x03, 0x3f, 0xc0, 0x20, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+        0xe0, 0xfe, 0x00, 0x0d, 0x1f, 0x00, 0x00, 0x3f, 0xf8, 0x08, 0x00, 0x00, 0x01, 0x00, 0x02, 0x3f,
+        0xfc, 0x1c, 0xfc, 0x00, 0x02, 0x7f, 0xfc, 0x1e, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0x7f, 0xfc, 0x00,
+        0x02, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x19, 0x80, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x00, 0xf0,
+        0x01, 0x8f, 0xff, 0xff, 0x80, 0x00, 0x00, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xff,
+        0xf0, 0xfe, 0xff, 0x04, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0xfe, 0xff, 0x04, 0xfe, 0x00, 0x00, 0xff,
+        0xf0, 0xfd, 0xff, 0x03, 0x80, 0x00, 0xff, 0xf4, 0xfd, 0xff, 0x04, 0x80, 0x00, 0xff, 0xf9, 0x7f,
+        0xfe, 0xff, 0x03, 0x80, 0x00, 0xff, 0xfd, 0xfe, 0xff, 0x02, 0xfc, 0x80, 0x00, 0xfc, 0xff, 0x02,
+        0xf1, 0x80, 0x00, 0xfd, 0xff, 0x03, 0x84, 0x03, 0xc0, 0x00, 0xfd, 0xff, 0x03, 0x39, 0x83, 0xf0,
+        0x00, 0xfe, 0xff, 0x04, 0xfd, 0xf8, 0x0f, 0xf8, 0x00, 0xfd, 0xff, 0x03, 0xe8, 0x0f, 0xf0, 0x00,
+        0xfd, 0xff, 0x03, 0xf0, 0x00, 0x48, 0x00, 0xfc, 0xff, 0x02, 0x60, 0x00, 0x00, 0xfc, 0xff, 0x02,
+        0xe0, 0x00, 0x00, 0xb1, 0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd,
+        0xff, 0x03, 0xcc, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x80,
+        0x00, 0x00, 0xfd, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0xfd, 0xff,
+        0x00, 0xc4, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0x84, 0xfe, 0x00,
+        0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xfa, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf8,
+        0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0x80,
+        0xfe, 0x00, 0xfd, 0xff, 0x00, 0x80, 0xfe, 0x00, 0xfe, 0xff, 0x04, 0xf3, 0xc0, 0x00, 0x08, 0x00,
+        0xfe, 0xff, 0x00, 0xe8, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xf0,
+        0xfd, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x80, 0xfc, 0x00, 0xff, 0xff,
+        0xfb, 0x00, 0x18, 0xff, 0xfc, 0x00, 0x01, 0xc6, 0xe0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x5f,
+        0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x02, 0x7f, 0xf8, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x04, 0xff,
+        0x80, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0xf0,
+        0xfa, 0x00, 0x00, 0xe0, 0xfb, 0x00, 0x00, 0x02, 0xeb, 0x00, 0x01, 0x01, 0x70, 0xfb, 0x00, 0x01,
+        0x02, 0xec, 0xfb, 0x00, 0x01, 0x01, 0xfc, 0xfb, 0x00, 0x01, 0x01, 0x78, 0xfa, 0x00, 0x00, 0xbc,
+        0xfb, 0x00, 0x01, 0x0f, 0x6e, 0xfb, 0x00, 0x01, 0x3f, 0x0f, 0xfb, 0x00, 0x01, 0x3f, 0x2f, 0xfb,
+        0x00, 0xff, 0x1f, 0xfb, 0x00, 0x01, 0x3c, 0x7f, 0xfa, 0x00, 0x00, 0x0f, 0xfa, 0x00, 0x00, 0x36,
+        0xf2, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x07,
+        0xfa, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x01, 0x8e, 0x00, 0x02, 0x3e, 0xfc, 0x01, 0xfd, 0x00,
+        0x02, 0xfd, 0xe7, 0xf8, 0xfc, 0x00, 0x03, 0x7f, 0xfe, 0x02, 0x80, 0xfd, 0x00, 0x02, 0x0f, 0xf3,
+        0xc0, 0xfc, 0x00, 0x02, 0x07, 0xc0, 0xc0, 0xfb, 0x00, 0x00, 0x80, 0xea, 0x00, 0x00, 0x10, 0xd9,
+        0x00, 0x01, 0x0d, 0x80, 0xfb, 0x00, 0x01, 0xf7, 0xf8, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xfd,
+        0x00, 0x04, 0x02, 0x7f, 0xff, 0xff, 0xf8, 0xfe, 0x00, 0x00, 0x1d, 0xfd, 0xff, 0x03, 0x01, 0x00,
+        0x00, 0x07, 0xfd, 0xff, 0x03, 0xe1, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x1f,
+        0xfe, 0xff, 0x1d, 0x83, 0x9f, 0x00, 0x00, 0x3f, 0xff, 0x0f, 0xff, 0xc0, 0x7f, 0x00, 0x00, 0xff,
+        0xfe, 0x1f, 0xff, 0xcf, 0x7f, 0x00, 0x01, 0xff, 0xfc, 0x3f, 0xff, 0xfb, 0xff, 0x00, 0x0f, 0xff,
+        0xf3, 0xfd, 0xff, 0x03, 0x00, 0x7f, 0xff, 0xc3, 0xfd, 0xff, 0x03, 0x00, 0xff, 0xff, 0x81, 0xfd,
+        0xff, 0x03, 0x01, 0xff, 0xff, 0x81, 0xfd, 0xff, 0x0c, 0x00, 0xff, 0xff, 0xc1, 0xff, 0x7f, 0xff,
+        0xff, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xfe, 0xff, 0x04, 0x00, 0x7e, 0xff, 0xe0, 0xbf, 0xfe, 0xff,
+        0x04, 0x00, 0x78, 0x7f, 0x01, 0xbf, 0xfe, 0xff, 0x04, 0x00, 0x01, 0x7f, 0x30, 0x9f, 0xfe, 0xff,
+        0x03, 0x00, 0x0e, 0x3f, 0xa1, 0xfd, 0xff, 0x03, 0x00, 0x0f, 0x3e, 0x03, 0xfd, 0xff, 0x03, 0x00,
+        0x0f, 0xf8, 0x03, 0xfd, 0xff, 0x03, 0x00, 0x0f, 0xc0, 0x27, 0xfd, 0xff, 0x02, 0x00, 0x07, 0x73,
+        0xfc, 0xff, 0x00, 0x80, 0xfa, 0xff, 0x00, 0xe1, 0xfa, 0xff, 0x00, 0xe3, 0xfa, 0xff, 0x00, 0xe7,
+        0xfa, 0xff, 0x00, 0x1f, 0xfa, 0xff, 0x00, 0x7f, 0xd5, 0xff, 0x01, 0xf3, 0xe3, 0xfb, 0xff, 0x02,
+        0xe1, 0xc3, 0xff, 0x9f, 0x00, 0x01, 0x60, 0x20, 0xfd, 0x00, 0x0a, 0x1b, 0xc7, 0xf7, 0xf8, 0x00,
+        0x00, 0x60, 0x00, 0x1d, 0x18, 0xe0, 0xf7, 0x00, 0x00, 0x06, 0xe8, 0x00, 0x00, 0x01, 0xfe, 0x00,
+        0x01, 0x03, 0xc0, 0xfc, 0x00, 0x01, 0x03, 0xff, 0xfb, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x04, 0x08,
+        0x03, 0x00, 0x00, 0xf8, 0xfd, 0x00, 0x03, 0x1f, 0x00, 0x07, 0xe0, 0xfd, 0x00, 0x39, 0x3f, 0x00,
+        0x0f, 0x80, 0x00, 0x0c, 0x20, 0x1f, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x3f, 0x13, 0xdf, 0xff, 0x00,
+        0x3f, 0x00, 0x00, 0x7e, 0x77, 0xff, 0xff, 0x00, 0x07, 0x80, 0x01, 0xff, 0x7e, 0xf9, 0xff, 0x00,
+        0x00, 0x08, 0x00, 0xff, 0x3f, 0xfd, 0xff, 0x00, 0x00, 0x07, 0xe1, 0xff, 0x7f, 0xff, 0xff, 0x06,
+        0x0c, 0x19, 0xff, 0x3f, 0x1b, 0xff, 0xff, 0xe0, 0xfd, 0xff, 0x03, 0x9d, 0xff, 0xff, 0x87, 0xfd,
+        0xff, 0x00, 0x3f, 0xfb, 0xff, 0x01, 0xfc, 0x7f, 0x81, 0xff, 0x9f, 0xff, 0x01, 0xfe, 0x0f, 0xfb,
+        0xff, 0x01, 0xf8, 0x0f, 0xfb, 0xff, 0x99, 0x00, 0x01, 0x0f, 0xf0, 0xfb, 0x00, 0x01, 0x1f, 0xe0,
+        0xfb, 0x00, 0x01, 0x07, 0xfc, 0xfa, 0x00, 0x01, 0x1d, 0xfc, 0xfb, 0x00, 0x02, 0x03, 0x00, 0xc0,
+        0xfb, 0x00, 0x01, 0x7e, 0x40, 0xfb, 0x00, 0x02, 0xff, 0x3f, 0x80, 0xfe, 0x00, 0x00, 0x07, 0xfe,
+        0xff, 0x00, 0xc0, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xfd,
+        0x00, 0xfe, 0xff, 0x04, 0xee, 0x00, 0x00, 0x40, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0x00, 0xfa,
+        0xff, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x8c, 0xfa, 0xff, 0x00, 0xcf, 0x81, 0xff, 0x81, 0xff, 0xe1,
+        0xff, 0x81, 0x00, 0xe7, 0x00, 0x00, 0x18, 0xfc, 0x00, 0x01, 0x0e, 0x60, 0xfb, 0x00, 0x02, 0x1f,
+        0xfe, 0xf8, 0xf3, 0x00, 0x00, 0x60, 0xf3, 0x00, 0x01, 0x03, 0xff, 0xfb, 0x00, 0x02, 0x01, 0xff,
+        0xf8, 0xfc, 0x00, 0xfe, 0xff, 0x04, 0x87, 0x80, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xf0, 0xfe,
+        0x00, 0xfd, 0xff, 0x03, 0xf9, 0xf3, 0xbf, 0xf8, 0xfb, 0xff, 0x00, 0x9f, 0xd1, 0xff, 0x00, 0xfe,
+        0xfa, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x00, 0xfe, 0xfc, 0xff, 0x02, 0x9f, 0xff, 0xf7, 0xfc, 0xff,
+        0x02, 0x3f, 0xff, 0x80, 0xfe, 0xff, 0x04, 0xfe, 0x0c, 0x7f, 0xfc, 0x00, 0xfe, 0xff, 0x04, 0xf8,
+        0x01, 0xfe, 0x70, 0x00, 0xfe, 0xff, 0x11, 0xf0, 0x07, 0x80, 0x00, 0x00, 0xff, 0xe0, 0x03, 0xd0,
+        0x0f, 0x60, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x3e, 0xfe, 0x00, 0x0c, 0xff, 0x00, 0x00, 0x01,
+        0xff, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x03,
+        0xff, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x03, 0xfe, 0xfe, 0x00, 0x0c, 0x98, 0x00, 0x00, 0x03,
+        0xfe, 0x04, 0x00, 0x00, 0xf3, 0x10, 0x00, 0x03, 0xf0, 0xfe, 0x00, 0x04, 0xff, 0xb0, 0x00, 0x03,
+        0xf0, 0xfe, 0x00, 0x0c, 0xff, 0xb0, 0x00, 0x03, 0xc0, 0x00, 0x02, 0x00, 0xff, 0xf0, 0x00, 0x01,
+        0xc0, 0xfe, 0x00, 0x03, 0xff, 0xb8, 0x00, 0x01, 0xfe, 0x00, 0x02, 0x01, 0xff, 0x38, 0xfb, 0x00,
+        0x01, 0xff, 0x38, 0xfb, 0x00, 0x01, 0xff, 0x34, 0xfb, 0x00, 0x01, 0xff, 0x20, 0xfb, 0x00, 0x01,
+        0xfe, 0x20, 0xfb, 0x00, 0x01, 0xfc, 0x30, 0xfb, 0x00, 0x01, 0xf8, 0x28, 0xfb, 0x00, 0x02, 0xf0,
+        0x00, 0x04, 0xfc, 0x00, 0x81, 0x00, 0x81, 0x00, 0xed, 0x00, 0x00, 0x40, 0xf2, 0x00, 0x00, 0x10,
+        0x81, 0x00, 0xa6, 0x00, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff,
+        0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff,
+        0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0xff, 0x00,
+        0x00, 0x3f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xfc, 0xff,
+        0xff, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x07,
+        0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x3f,
+        0xfd, 0xff, 0xfe, 0x00, 0x00, 0x1b, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x1c, 0xfd, 0xff, 0xfe, 0x00,
+        0x00, 0x0c, 0xfd, 0xff, 0xfe, 0x00, 0x04, 0x0e, 0x7f, 0xff, 0xff, 0xe7, 0xfe, 0x00, 0x00, 0x03,
+        0xfe, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x03, 0x3f, 0xff, 0xfe, 0xfd, 0x00, 0x03, 0x03, 0x9f,
+        0xff, 0xfc, 0xfc, 0x00, 0x02, 0xcf, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x67, 0xff, 0xfc, 0xfc, 0x00,
+        0x02, 0x63, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x61, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x18, 0xff, 0xfc,
+        0xfc, 0x00, 0x02, 0x08, 0x7f, 0xfc, 0xfb, 0x00, 0x01, 0x3f, 0xf8, 0xfb, 0x00, 0x01, 0x1f, 0xfc,
+        0xfb, 0x00, 0x01, 0x1f, 0xfc, 0xfb, 0x00, 0x01, 0x3f, 0xfe, 0xfb, 0x00, 0x01, 0x1f, 0xff, 0xfb,
+        0x00, 0x02, 0x0f, 0xff, 0x01, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xdf, 0xfb, 0x00, 0xff, 0xff, 0xfb,
+        0x00, 0x01, 0x3f, 0xff, 0xfb, 0x00, 0x01, 0x07, 0xbf, 0xfa, 0x00, 0x00, 0x0f, 0xfa, 0x00, 0x00,
+        0x07, 0xfa, 0x00, 0x00, 0x03, 0x81, 0x00, 0xe9, 0x00, 0xfd, 0xff, 0x00, 0x8f, 0xfe, 0x00, 0xfd,
+        0xff, 0x00, 0x38, 0xfe, 0x00, 0xfe, 0xff, 0x01, 0xf8, 0x10, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xf0,
+        0xfd, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff,
+        0x00, 0x80, 0xfd, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00,
+        0xff, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xf4, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xf8,
+        0xfc, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0xff, 0xff,
+        0x00, 0xf8, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xe0, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x80, 0xfc, 0x00,
+        0xff, 0xff, 0xfb, 0x00, 0x04, 0xff, 0xfc, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x01, 0xff, 0xf8, 0xfb,
+        0x00, 0x01, 0xff, 0xf8, 0xfb, 0x00, 0x01, 0x23, 0xf8, 0xfb, 0x00, 0x01, 0x80, 0x38, 0xfa, 0x00,
+        0x00, 0x1c, 0xfa, 0x00, 0x00, 0x1c, 0xfa, 0x00, 0x00, 0x1c, 0xfa, 0x00, 0x01, 0x0e, 0x60, 0xfb,
+        0x00, 0x00, 0x0e, 0xfa, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x01, 0x08, 0x40, 0xeb, 0x00, 0x01, 0x6f,
+        0x01, 0xfb, 0x00, 0x02, 0xa1, 0xe0, 0x20, 0xfd, 0x00, 0x03, 0xf8, 0x00, 0x78, 0x80, 0xfd, 0x00,
+        0x02, 0xf8, 0x00, 0x1e, 0xfc, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0xfd, 0x00, 0x03, 0xf0, 0x00,
+        0x00, 0xfe, 0xfd, 0x00, 0x04, 0xf0, 0x00, 0x71, 0xf8, 0x60, 0xfe, 0x00, 0x00, 0xe0, 0xfa, 0x00,
+        0x00, 0xe0, 0xfa, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0xc0,
+        0xfe, 0x00, 0x04, 0x40, 0x00, 0x00, 0xff, 0xc0, 0xfb, 0x00, 0x01, 0x3f, 0xc0, 0xfe, 0x00, 0x04,
+        0x40, 0x00, 0x00, 0x0f, 0xc0, 0xfb, 0x00, 0x03, 0x07, 0x80, 0x00, 0x28, 0xfd, 0x00, 0x03, 0x03,
+        0x80, 0x01, 0xce, 0xfd, 0x00, 0x0d, 0x01, 0xc0, 0x07, 0xff, 0xe7, 0x40, 0x00, 0x00, 0x01, 0xe0,
+        0x07, 0xdf, 0xff, 0x80, 0xfe, 0x00, 0x04, 0x73, 0xcf, 0xff, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x3e,
+        0x7f, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x06, 0x7f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f,
+        0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfe, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff,
+        0x00, 0xf0, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x3f, 0xfd, 0xff,
+        0xfe, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x7f,
+        0xfd, 0xff, 0x02, 0x80, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xc0, 0x00, 0x01, 0xfc, 0xff, 0x00, 0x80,
+        0xfa, 0x00, 0x00, 0x01, 0xfa, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x01, 0x04, 0x03, 0xfb, 0x00, 0x01,
+        0x1f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x0f,
+        0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x1f, 0xff, 0xfe, 0x00, 0x04, 0x80, 0x00,
+        0x00, 0x1f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xfc, 0xfb, 0x00, 0x01,
+        0x01, 0xc0, 0xfa, 0x00, 0x00, 0x80, 0xfa, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x01, 0x01, 0xff, 0xfb,
+        0x00, 0x01, 0x03, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x1f, 0xff, 0xfb, 0x00,
+        0x01, 0x1f, 0xff, 0xfb, 0x00, 0x01, 0x3f, 0xff, 0xfb, 0x00, 0x01, 0x1f, 0xff, 0xfb, 0x00, 0x01,
+        0x3f, 0xff, 0xfb, 0x00, 0x01, 0x7f, 0xff, 0xfc, 0x00, 0x02, 0x21, 0xff, 0xff, 0xfc, 0x00, 0x02,
+        0x03, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x3f, 0xff,
+        0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0xfe,
+        0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff,
+        0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x02,
+        0x3f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x7f, 0xff,
+        0xff, 0xfc, 0x00, 0x02, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x02,
+        0x07, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x03, 0xff, 0xff, 0xfb, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x01, 0x7f, 0xff, 0xfb, 0x00,
+        0x01, 0x3f, 0xff, 0xfb, 0x00, 0x01, 0x0f, 0x04, 0xd1, 0x00, 0xff, 0xff, 0x3a, 0xcf, 0xff, 0xff,
+        0xe0, 0xf7, 0xff, 0xff, 0xfb, 0xc3, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xe1, 0xf1, 0xff, 0xff,
+        0x80, 0x00, 0x7f, 0xf8, 0x01, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xf8, 0x04, 0x78, 0x1f, 0xff,
+        0x00, 0x00, 0x0f, 0xf0, 0x04, 0x3e, 0x0f, 0xff, 0x83, 0xf0, 0x1f, 0xc0, 0x0c, 0x0f, 0xcf, 0xf6,
+        0x3f, 0xff, 0xff, 0x80, 0x0c, 0x03, 0x27, 0xa3, 0xfe, 0xff, 0x04, 0x00, 0x0c, 0x01, 0x87, 0xc7,
+        0xfe, 0xff, 0x04, 0xa0, 0x00, 0x01, 0x03, 0xe3, 0xfe, 0xff, 0xff, 0x00, 0x02, 0x3e, 0x01, 0xf1,
+        0xfe, 0xff, 0x04, 0x00, 0x02, 0x1c, 0x01, 0x81, 0xfe, 0xff, 0x06, 0x3f, 0xff, 0x00, 0x00, 0x40,
+        0x33, 0x8f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xff, 0x00, 0x02, 0x1c, 0x01, 0x9f,
+        0xfe, 0xff, 0xfd, 0x00, 0x03, 0x1f, 0xff, 0xff, 0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00,
+        0xc0, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x04, 0xfc, 0x07, 0xc0, 0x00, 0x3f, 0xfe, 0xff, 0x04,
+        0xfe, 0x07, 0xf4, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xc7, 0xe8, 0xff, 0x00, 0xfe, 0xf1, 0xff, 0x00,
+        0x1f, 0xfa, 0xff, 0x00, 0x8f, 0xfa, 0xff, 0x00, 0x87, 0xfa, 0xff, 0x00, 0xc7, 0xfa, 0xff, 0x00,
+        0xc3, 0xfa, 0xff, 0x00, 0xe1, 0xfa, 0xff, 0x00, 0xe0, 0xfa, 0xff, 0x00, 0xf0, 0xfa, 0xff, 0x00,
+        0xf8, 0xfa, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x01, 0xfc, 0x7f, 0xfb, 0xff, 0x01, 0xfc, 0x3f, 0xfb,
+        0xff, 0x01, 0xfc, 0x1f, 0xfb, 0xff, 0x01, 0xfe, 0x1f, 0xfa, 0xff, 0x00, 0x0f, 0xfa, 0xff, 0x00,
+        0x07, 0xfa, 0xff, 0x00, 0x07, 0xfa, 0xff, 0x00, 0x87, 0xfa, 0xff, 0x00, 0xe7, 0xfa, 0xff, 0x00,
+        0xf3, 0xfa, 0xff, 0x00, 0xfb, 0xfa, 0xff, 0x00, 0xfd, 0xfa, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x00,
+        0xfc, 0xfa, 0xff, 0x00, 0xfe, 0xd1, 0xff, 0x00, 0x80, 0xfa, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x01,
+        0x00, 0x07, 0xfb, 0xff, 0x01, 0x00, 0x0b, 0xfb, 0xff, 0x01, 0x00, 0x01, 0xfb, 0xff, 0x01, 0x00,
+        0x03, 0xfb, 0xff, 0x01, 0x00, 0x03, 0xfb, 0xff, 0x01, 0x00, 0x03, 0xfc, 0xff, 0x00, 0xfe, 0x01,
+        0xf1, 0x7f, 0xfb, 0xff, 0x00, 0xf0, 0xfa, 0xff, 0x01, 0xf0, 0x7f, 0xfb, 0xff, 0x01, 0xf0, 0x3f,
+        0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xfc, 0x17, 0xfb, 0xff, 0x01, 0xfe, 0x0f, 0xfb,
+        0xff, 0x01, 0xfe, 0x0f, 0xfb, 0xff, 0x01, 0xfe, 0x0f, 0xfb, 0xff, 0x01, 0xfc, 0x07, 0xfb, 0xff,
+        0x01, 0xfc, 0x07, 0xfa, 0xff, 0x00, 0x07, 0xab, 0xff, 0x00, 0xf8, 0xfa, 0xff, 0x01, 0xf8, 0x7f,
+        0xfb, 0xff, 0x01, 0xfc, 0x7f, 0xfb, 0xff, 0x01, 0xfe, 0x1f, 0xfa, 0xff, 0x01, 0x07, 0x3f, 0xfb,
+        0xff, 0x01, 0x40, 0xbf, 0xfb, 0xff, 0x02, 0xc1, 0x8f, 0xfd, 0xfc, 0xff, 0x02, 0xc3, 0x80, 0x00,
+        0xfb, 0xff, 0x01, 0xc0, 0x00, 0xfb, 0xff, 0x02, 0xf0, 0x00, 0x3f, 0xfc, 0xff, 0x02, 0xfc, 0x00,
+        0x0f, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x1e, 0xfc, 0xff, 0x27, 0xf0, 0x00, 0x0e, 0xff, 0xff, 0xf0,
+        0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xc0,
+        0xff, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0x00,
+        0xff, 0xfe, 0xfe, 0x00, 0x04, 0xff, 0xfe, 0x00, 0xff, 0xf8, 0xfe, 0x00, 0x04, 0x7f, 0xfc, 0x00,
+        0xff, 0xe0, 0xfe, 0x00, 0x04, 0x7f, 0xf0, 0x00, 0xff, 0xe0, 0xfe, 0x00, 0x03, 0x7f, 0xe0, 0x00,
+        0xff, 0xfd, 0x00, 0x03, 0x3f, 0xc0, 0x00, 0xfc, 0xfd, 0x00, 0x03, 0x3f, 0xe0, 0x00, 0xc0, 0xfd,
+        0x00, 0x04, 0x1f, 0xe0, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x04, 0x1f, 0xe0, 0x00, 0x00, 0x80, 0xfe,
+        0x00, 0x04, 0x0f, 0xc0, 0x00, 0x07, 0x80, 0xfe, 0x00, 0x04, 0x0f, 0xc0, 0x00, 0x7f, 0x80, 0xfe,
+        0x00, 0x04, 0x0f, 0xc0, 0x00, 0xff, 0x80, 0xfe, 0x00, 0x03, 0x07, 0xa0, 0x00, 0xff, 0xfd, 0x00,
+        0x03, 0x07, 0x30, 0x00, 0xff, 0xfd, 0x00, 0x03, 0x02, 0x30, 0x00, 0xfe, 0xfc, 0x00, 0x02, 0x38,
+        0x00, 0xfe, 0xfc, 0x00, 0x02, 0x38, 0x00, 0xfc, 0xfc, 0x00, 0x02, 0x38, 0x00, 0xfc, 0xfa, 0x00,
+        0x00, 0xf8, 0xfa, 0x00, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0xe0, 0xfa, 0x00,
+        0x00, 0x80, 0xea, 0x00, 0xe2, 0xff, 0x00, 0xee, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0x80,
+        0xfc, 0xff, 0x02, 0xfb, 0xff, 0x80, 0xfc, 0xff, 0x02, 0xe3, 0xfe, 0x00, 0xfc, 0xff, 0x02, 0xc4,
+        0x1c, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x1e, 0x00, 0xfc, 0xff, 0x02, 0xc0, 0x3f, 0x00, 0xfc, 0xff,
+        0x02, 0xde, 0x07, 0x80, 0xfc, 0xff, 0x02, 0xf8, 0x0f, 0x80, 0xfc, 0xff, 0x02, 0xe0, 0x07, 0x80,
+        0xfc, 0xff, 0x02, 0xc0, 0x0f, 0x07, 0xfc, 0xff, 0x02, 0xe0, 0x0c, 0x9f, 0xfc, 0xff, 0x02, 0xf0,
+        0x00, 0x27, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x74, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x70, 0xfc, 0xff,
+        0x02, 0xfc, 0x00, 0x20, 0xfc, 0xff, 0x02, 0xfc, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x00,
+        0xfc, 0xff, 0x02, 0xfc, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xfc, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf8,
+        0x00, 0x80, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xe0, 0x02, 0x00, 0xfc, 0xff,
+        0x02, 0xe0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xe0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x8c, 0x00, 0x00,
+        0xfc, 0xff, 0x02, 0x18, 0x00, 0x00, 0xfd, 0xff, 0x03, 0xfc, 0x18, 0x00, 0x00, 0xfd, 0xff, 0x04,
+        0xe0, 0x08, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x1f, 0xff, 0xff, 0x8c,
+        0xfd, 0x00, 0x03, 0x0f, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xfe, 0x0c, 0xfd, 0x00,
+        0x03, 0x03, 0xff, 0xfe, 0x1c, 0xfd, 0x00, 0x1d, 0x01, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x00, 0x00,
+        0x01, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0xdf, 0xff, 0x80, 0x00, 0x0e, 0x00, 0x00,
+        0x03, 0x9f, 0xff, 0xc0, 0x00, 0x1c, 0xfe, 0x00, 0x04, 0x1f, 0xff, 0xe0, 0x00, 0x18, 0xfe, 0x00,
+        0x04, 0x0f, 0xff, 0xf0, 0x00, 0x1c, 0xfe, 0x00, 0x40, 0x0f, 0xff, 0xf0, 0x00, 0x0e, 0x00, 0x00,
+        0x08, 0x0e, 0xff, 0xf0, 0x00, 0x08, 0x00, 0x00, 0x08, 0x0e, 0xff, 0xf0, 0x00, 0x08, 0x00, 0x00,
+        0x08, 0x0c, 0x1f, 0xf0, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x04, 0x1f, 0xe0, 0x00, 0x03, 0x60, 0x00,
+        0x00, 0x0c, 0x0f, 0xc0, 0x00, 0x21, 0xa0, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0xc0, 0x00,
+        0x08, 0x0e, 0x06, 0x00, 0x00, 0x81, 0x10, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x04, 0x01, 0xf0, 0x00,
+        0x00, 0x06, 0xfe, 0x00, 0x18, 0x03, 0xf0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00,
+        0x00, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x07, 0x80, 0xfe, 0x00,
+        0x04, 0xf1, 0xf0, 0x00, 0x0f, 0x80, 0xfe, 0x00, 0x03, 0x71, 0xf0, 0x00, 0x3f, 0xfd, 0x00, 0x03,
+        0x3c, 0xf0, 0x00, 0x7e, 0xfd, 0x00, 0x03, 0x9e, 0x78, 0x01, 0xff, 0xfd, 0x00, 0x16, 0x0f, 0x30,
+        0x01, 0xff, 0x00, 0x02, 0x00, 0x00, 0x07, 0xd8, 0x1f, 0xff, 0x80, 0x22, 0x00, 0x00, 0x17, 0xf0,
+        0x1f, 0xff, 0x1f, 0xc6, 0x00, 0x02, 0xe0, 0x20, 0x20, 0xfc, 0x00, 0x02, 0xc0, 0x38, 0x80, 0xfc,
+        0x00, 0x02, 0x80, 0x7e, 0x80, 0xfb, 0x00, 0x00, 0xfc, 0xfb, 0x00, 0x01, 0x01, 0x10, 0xf2, 0x00,
+        0x00, 0xc0, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xfb, 0x00, 0x01, 0x01,
+        0xc0, 0xfb, 0x00, 0x01, 0x07, 0x80, 0xfb, 0x00, 0x01, 0x17, 0x80, 0xfb, 0x00, 0x01, 0x1f, 0x80,
+        0xfb, 0x00, 0x01, 0x3f, 0x80, 0xfb, 0x00, 0x00, 0xfd, 0xfa, 0x00, 0x00, 0x60, 0xfa, 0x00, 0x00,
+        0x40, 0xb1, 0x00, 0x00, 0x20, 0x81, 0x00, 0x9f, 0x00, 0x00, 0x40, 0xb6, 0x00, 0x81, 0x00, 0xe0,
+        0x00, 0x00, 0x08, 0xe5, 0x00, 0x02, 0x40, 0x00, 0x80, 0xf5, 0x00, 0x00, 0x10, 0xdf, 0x00, 0x00,
+        0x01, 0x81, 0x00, 0x82, 0x00, 0x00, 0x04, 0xf2, 0x00, 0xfa, 0x00, 0x00, 0x02, 0x81, 0x00, 0x81,
+        0x00, 0x81, 0x00, 0x89, 0x00, 0x01, 0x00, 0x03, 0xfc, 0xff, 0x02, 0xc0, 0x40, 0x03, 0xfc, 0xff,
+        0x02, 0xfc, 0x00, 0x03, 0xfd, 0xff, 0x03, 0xfd, 0xef, 0x00, 0x07, 0xfb, 0xff, 0x01, 0x00, 0x03,
+        0xfb, 0xff, 0x01, 0x00, 0x03, 0xfb, 0xff, 0x01, 0x00, 0x07, 0xfb, 0xff, 0x01, 0x00, 0x07, 0xfb,
+        0xff, 0x01, 0x00, 0x07, 0xfb, 0xff, 0x01, 0x00, 0x03, 0xfb, 0xff, 0x01, 0x00, 0x01, 0xfb, 0xff,
+        0x01, 0x00, 0x01, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0xff,
+        0x00, 0x00, 0x7f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xfc,
+        0xff, 0xff, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0xff, 0x00, 0x00,
+        0x0f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0xff, 0xff,
+        0x00, 0x00, 0x03, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x01, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfd,
+        0xff, 0xfe, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0xfe, 0x00, 0x00,
+        0x0f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfd, 0xff, 0xfe,
+        0x00, 0x00, 0x07, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfd,
+        0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xfe, 0xfe,
+        0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfe,
+        0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+        0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+        0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xc0, 0xfe,
+        0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x04, 0x1f, 0xff, 0xff, 0xfe, 0x80, 0xfe,
+        0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0x1f, 0xff, 0xff, 0xfc, 0xfd, 0x00, 0x03, 0x3f,
+        0xff, 0xff, 0xfc, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xfd,
+        0xf0, 0xfd, 0x00, 0x02, 0x3f, 0xff, 0xfe, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xfe, 0xfc, 0x00, 0x02,
+        0x7f, 0xff, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0xff,
+        0xff, 0x00, 0xf8, 0xfc, 0x00, 0xff, 0xff, 0xfb, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x01, 0xff,
+        0xff, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x01, 0x7f, 0xfc, 0xfc, 0x00, 0x02, 0x01,
+        0x7f, 0xf8, 0xfb, 0x00, 0x01, 0x7f, 0xf0, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0xf1,
+        0x00, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x80, 0xfa, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x01, 0xff, 0x80,
+        0xfb, 0x00, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xfe, 0xfb,
+        0x00, 0x01, 0xff, 0xfe, 0xfb, 0x00, 0x01, 0xff, 0xfe, 0xfb, 0x00, 0x01, 0xff, 0xfe, 0xfb, 0x00,
+        0x01, 0xff, 0xfe, 0xfb, 0x00, 0x01, 0xff, 0xfc, 0xfb, 0x00, 0x01, 0xff, 0xfc, 0xfb, 0x00, 0x01,
+        0xff, 0xf8, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xe0, 0xfb, 0x00, 0x01, 0xff,
+        0xc0, 0xfb, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0x80,
+        0xfb, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0x80, 0xfb,
+        0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff,
+        0xfa, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0xf8,
+        0xfa, 0x00, 0x00, 0xc0, 0x81, 0x00, 0x8a, 0x00, 0x01, 0x00, 0x03, 0xfc, 0xff, 0x02, 0xfc, 0x00,
+        0x07, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x07, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x03, 0xfc, 0xff, 0x02,
+        0xe0, 0x00, 0x01, 0xfc, 0xff, 0x02, 0xc0, 0x00, 0x00, 0xfc, 0xff, 0x03, 0x80, 0x00, 0x00, 0x7f,
+        0xfd, 0xff, 0x03, 0x80, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0xfe,
+        0x00, 0x00, 0x3f, 0xfd, 0xff, 0x03, 0x80, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x03, 0x80, 0x00, 0x00,
+        0x1f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x03,
+        0x80, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x03, 0x80, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xc0, 0x00,
+        0x00, 0x0f, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x1f,
+        0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x3f, 0xfd, 0xff,
+        0x03, 0xc0, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x03, 0xc0,
+        0x00, 0x00, 0x7f, 0xfd, 0xff, 0x03, 0x80, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x03, 0x01, 0x00, 0x00,
+        0x7f, 0xfe, 0xff, 0x04, 0xfc, 0x01, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x04, 0xf8, 0x01, 0x00, 0x00,
+        0x3f, 0xfe, 0xff, 0x04, 0xe0, 0x01, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00,
+        0x1f, 0xfe, 0xff, 0x04, 0xc0, 0x01, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x04, 0xc0, 0x01, 0x00, 0x00,
+        0x0f, 0xfe, 0xff, 0x04, 0xe0, 0x03, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x04, 0xe0, 0x03, 0x00, 0x00,
+        0x07, 0xfe, 0xff, 0x04, 0xe0, 0x03, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x04, 0xe0, 0x03, 0x00, 0x00,
+        0x07, 0xfe, 0xff, 0x04, 0xc0, 0x01, 0x00, 0x00, 0x03, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0x03, 0xff,
+        0xff, 0xfe, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0xfe, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0xfe,
+        0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0xfe, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x02,
+        0x7f, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xfc,
+        0x00, 0x02, 0x3f, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xfc, 0x00, 0x01, 0x3f, 0xff,
+        0xfb, 0x00, 0x01, 0x1f, 0xf8, 0xfb, 0x00, 0x00, 0x0c, 0x8d, 0x00, 0x81, 0x00, 0xf1, 0x00, 0x00,
+        0x82, 0xfa, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x00, 0x0f, 0xfa, 0x00, 0x00,
+        0x1f, 0xfa, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x00,
+        0xfe, 0xfa, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x02, 0xfc, 0x00, 0x20, 0xfc,
+        0x00, 0x01, 0xf8, 0x01, 0xfb, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0xf0,
+        0xfa, 0x00, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0xc0, 0x81, 0x00, 0xa2, 0x00,
+        0x35, 0x00, 0x03, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xa0, 0x00, 0x01, 0xf0, 0x0f, 0xff, 0x23, 0x06,
+        0x1e, 0x00, 0x05, 0xf8, 0x07, 0xfc, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0xfd, 0x07, 0xfc, 0x3c, 0x10,
+        0x0e, 0x00, 0x00, 0xff, 0x47, 0xfc, 0x74, 0x00, 0x8f, 0x00, 0x00, 0x7e, 0x01, 0x1c, 0x7c, 0x08,
+        0x67, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x37, 0xfd, 0x00, 0x03, 0x0e, 0x00, 0x00, 0x32, 0xfd, 0x00,
+        0x09, 0x06, 0x00, 0x00, 0x20, 0x00, 0x05, 0x00, 0x00, 0x01, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0xfe,
+        0x00, 0x01, 0xff, 0xe8, 0xfb, 0x00, 0x04, 0x3f, 0xe0, 0x00, 0x18, 0x10, 0xfd, 0x00, 0x02, 0xbb,
+        0xd9, 0x58, 0xfa, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x01, 0x10, 0xc0, 0xfb, 0x00, 0x00, 0x01, 0xf8,
+        0x00, 0x00, 0x28, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x3f, 0xfb,
+        0x00, 0x01, 0x0c, 0x7f, 0xfb, 0x00, 0x01, 0x3f, 0x7f, 0xfb, 0x00, 0x01, 0x7f, 0xff, 0xfb, 0x00,
+        0x01, 0x7f, 0xff, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0f, 0xff,
+        0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x07, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe,
+        0xff, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x00,
+        0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd,
+        0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe,
+        0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfd, 0x00, 0x00,
+        0x0f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfd,
+        0x00, 0x03, 0x07, 0xff, 0xff, 0x9f, 0xfd, 0x00, 0x03, 0x07, 0xff, 0xf0, 0x01, 0xfd, 0x00, 0x03,
+        0x07, 0xff, 0x80, 0x01, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0x07, 0x80, 0x8f, 0x00,
+        0xf9, 0x00, 0x00, 0x40, 0xfb, 0x00, 0x01, 0x80, 0x08, 0xfa, 0x00, 0x02, 0x1e, 0x00, 0x40, 0xfc,
+        0x00, 0x03, 0x3f, 0xc0, 0x00, 0x80, 0xfd, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x80, 0xfd, 0x00, 0x01,
+        0xff, 0xfe, 0xfb, 0x00, 0x03, 0x1f, 0xff, 0x01, 0x80, 0xfd, 0x00, 0x03, 0x07, 0xff, 0xbf, 0x08,
+        0xfd, 0x00, 0x03, 0x07, 0xff, 0xe0, 0x04, 0xfd, 0x00, 0x03, 0x03, 0xff, 0x80, 0x01, 0xfd, 0x00,
+        0x02, 0x0f, 0xff, 0xc0, 0xfc, 0x00, 0x04, 0x08, 0xf8, 0xe0, 0x00, 0x10, 0xfd, 0x00, 0x03, 0x70,
+        0x78, 0x00, 0x0c, 0xfc, 0x00, 0x02, 0x38, 0x00, 0x08, 0xfd, 0x00, 0x03, 0x20, 0x02, 0x00, 0x02,
+        0xfd, 0x00, 0x02, 0x30, 0x00, 0x30, 0xfd, 0x00, 0x01, 0x60, 0x30, 0xfb, 0x00, 0x01, 0xe0, 0x30,
+        0xfb, 0x00, 0x01, 0xc0, 0x38, 0xfb, 0x00, 0x01, 0xe0, 0x38, 0xfb, 0x00, 0x01, 0x80, 0x3e, 0xfe,
+        0x00, 0x04, 0x04, 0x00, 0x00, 0xc0, 0x3e, 0xfe, 0x00, 0x04, 0x05, 0x00, 0x00, 0xf0, 0x7e, 0xfe,
+        0x00, 0x04, 0x03, 0x00, 0x00, 0xfc, 0x7f, 0xfc, 0x00, 0x02, 0x03, 0xfe, 0xff, 0xfc, 0x00, 0x03,
+        0x04, 0xff, 0xff, 0x80, 0xfd, 0x00, 0x03, 0x04, 0xff, 0xff, 0x80, 0xfc, 0x00, 0xff, 0xff, 0x00,
+        0xe0, 0xfc, 0x00, 0xff, 0xff, 0x18, 0xf0, 0x00, 0x00, 0x24, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x08, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xfc,
+        0x00, 0xff, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x00, 0x80, 0xfd,
+        0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00,
+        0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0xfe,
+        0xff, 0x00, 0xe0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd,
+        0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xfe, 0xff, 0x00,
+        0x80, 0xfd, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x02, 0xef, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x4f, 0xff,
+        0xfe, 0xfc, 0x00, 0x02, 0x17, 0xff, 0xfe, 0xfe, 0x00, 0x04, 0x01, 0x00, 0x1b, 0xff, 0xfc, 0xfe,
+        0x00, 0x04, 0x01, 0x80, 0x01, 0xff, 0xfc, 0xfd, 0x00, 0x03, 0x80, 0x01, 0xff, 0xfc, 0xfd, 0x00,
+        0x03, 0x60, 0x00, 0xfd, 0xe0, 0xfd, 0x00, 0x03, 0x7c, 0x00, 0x08, 0x80, 0xfd, 0x00, 0x00, 0x7c,
+        0xfb, 0x00, 0x01, 0x01, 0xf0, 0xfa, 0x00, 0x02, 0x70, 0x00, 0x02, 0xfd, 0x00, 0x04, 0x05, 0x60,
+        0x00, 0x03, 0xe0, 0xfe, 0x00, 0x04, 0x07, 0x40, 0x00, 0x01, 0xe0, 0xfe, 0x00, 0x04, 0x0f, 0x00,
+        0x00, 0x01, 0xe0, 0xfe, 0x00, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0x7e, 0xfb, 0x00, 0x02, 0x01, 0xf0,
+        0x00, 0x81, 0x00, 0x81, 0x00, 0xa2, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xff, 0xfc,
+        0x00, 0x02, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x04, 0x01, 0xfc, 0xaf, 0x7f, 0xff, 0xfd, 0x00, 0xfd,
+        0xff, 0xfe, 0x00, 0x01, 0xc0, 0x1f, 0xfe, 0xff, 0xfe, 0x00, 0x04, 0xfc, 0x00, 0x3f, 0xff, 0xff,
+        0xfc, 0x00, 0x02, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x01, 0x30,
+        0x0f, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x04, 0x00, 0x3e, 0x00, 0xe0, 0x7f, 0xfe,
+        0xff, 0xff, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0x01, 0xe0, 0x03, 0xc4, 0xff, 0x81, 0x00, 0x81, 0x00,
+        0xc3, 0x00, 0x01, 0x1f, 0x80, 0xfc, 0x00, 0x11, 0x13, 0xfe, 0x1e, 0x00, 0x07, 0x7b, 0x00, 0x00,
+        0x03, 0xff, 0xff, 0x04, 0x10, 0x03, 0xfe, 0x30, 0x00, 0x3f, 0xfa, 0xff, 0x00, 0xbf, 0x81, 0xff,
+        0xe0, 0xff, 0xff, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x03, 0xff, 0x80, 0xfc, 0x00,
+        0x02, 0x07, 0xff, 0x80, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x01, 0xff, 0xe0,
+        0xfc, 0x00, 0x02, 0x07, 0xff, 0xc0, 0xfc, 0x00, 0x01, 0x07, 0xff, 0xfb, 0x00, 0x01, 0x03, 0xff,
+        0xfb, 0x00, 0x01, 0x07, 0xfc, 0xfb, 0x00, 0x03, 0x05, 0xfc, 0x00, 0x34, 0xfc, 0x00, 0x02, 0xfe,
+        0x00, 0x2c, 0xfd, 0x00, 0x01, 0x02, 0xfe, 0xfa, 0x00, 0x00, 0xfb, 0xfa, 0x00, 0x01, 0x37, 0x80,
+        0xfb, 0x00, 0x01, 0x17, 0xf8, 0xfb, 0x00, 0x00, 0x01, 0xc6, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00,
+        0x10, 0xfb, 0x00, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x60, 0xfa, 0x00, 0x01, 0x02, 0xc0, 0xfb, 0x00,
+        0x00, 0xbe, 0xfb, 0x00, 0x01, 0x06, 0xc0, 0xfb, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x01, 0x5f, 0xc0,
+        0xfc, 0x00, 0x01, 0x01, 0xb4, 0xfb, 0x00, 0x01, 0x03, 0xe0, 0xfa, 0x00, 0x00, 0x70, 0xfb, 0x00,
+        0x01, 0x38, 0x7c, 0xfb, 0x00, 0x02, 0x7d, 0xff, 0x80, 0xfc, 0x00, 0x01, 0x2e, 0xff, 0xfc, 0x00,
+        0x03, 0x0c, 0x7f, 0xff, 0xc0, 0xfd, 0x00, 0x03, 0x07, 0xff, 0x7f, 0xc0, 0xfc, 0x00, 0x0c, 0x7c,
+        0x7f, 0xc0, 0x00, 0x00, 0xe2, 0x03, 0x0f, 0x07, 0xff, 0xe0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xc0,
+        0x00, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xc0,
+        0xfe, 0x00, 0xff, 0xff, 0x01, 0xfb, 0xf8, 0xfd, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x02,
+        0xff, 0xfe, 0x0f, 0xfd, 0x00, 0x04, 0x1f, 0xff, 0xe3, 0x80, 0x0f, 0xfe, 0x00, 0x0f, 0x7f, 0xff,
+        0xff, 0xf0, 0x39, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x70, 0x0f, 0xfd, 0xff,
+        0x04, 0xf8, 0x01, 0xe0, 0x1f, 0x80, 0xfc, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0x03, 0xf7, 0xc0, 0x1f,
+        0xfe, 0xfc, 0xff, 0x00, 0xc3, 0xb7, 0xff, 0x98, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x04, 0x81,
+        0x00, 0xcc, 0x00, 0x00, 0x08, 0xfb, 0x00, 0x01, 0x23, 0x08, 0xfb, 0x00, 0xff, 0xff, 0xfc, 0x00,
+        0x02, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xfd, 0x00, 0x03, 0x20, 0x7f, 0xff,
+        0xff, 0xfd, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0x03, 0xfe, 0xff, 0xfe, 0x00, 0x00,
+        0x3f, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x01, 0xc0, 0x03,
+        0xfb, 0xff, 0x01, 0xe0, 0x07, 0xfb, 0xff, 0x02, 0xe0, 0x00, 0x23, 0xfc, 0xff, 0x02, 0xe0, 0x00,
+        0x0f, 0xfc, 0xff, 0x01, 0x00, 0x47, 0xfb, 0xff, 0x00, 0x07, 0xfa, 0xff, 0x00, 0x7f, 0xaa, 0xff,
+        0x81, 0x00, 0x81, 0x00, 0xf2, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x13, 0x01, 0x80, 0x7f, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x01, 0xf8, 0xff, 0x0a, 0x16, 0x3f, 0xb1, 0x26, 0x3f, 0xff, 0xff, 0x3f, 0x81,
+        0xff, 0xaa, 0xff, 0xcd, 0x00, 0x00, 0x38, 0x81, 0x00, 0xc5, 0x00, 0x00, 0x7f, 0xfb, 0x00, 0x02,
+        0x02, 0xff, 0x80, 0xfd, 0x00, 0x07, 0x2f, 0x33, 0xff, 0xff, 0x30, 0x00, 0x00, 0x01, 0xfc, 0xff,
+        0x02, 0xf0, 0x00, 0x7f, 0xfc, 0xff, 0x01, 0xf0, 0x01, 0xfb, 0xff, 0x01, 0xe0, 0x0f, 0xfb, 0xff,
+        0x00, 0xe2, 0xfa, 0xff, 0x00, 0xc3, 0xfa, 0xff, 0x00, 0x87, 0xfa, 0xff, 0x00, 0x3f, 0xfb, 0xff,
+        0x01, 0xfe, 0x7f, 0x81, 0xff, 0xc6, 0xff, 0x81, 0x00, 0x98, 0x00, 0x01, 0x01, 0x10, 0xfb, 0x00,
+        0x06, 0x60, 0xfc, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0x02, 0xf8, 0x03, 0xf8, 0x81, 0xff,
+        0x81, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x01, 0x03, 0xf0, 0xfb, 0x00, 0x01, 0x07, 0xe0, 0xfa, 0x00,
+        0x00, 0xc0, 0xd3, 0x00, 0x00, 0x08, 0x81, 0x00, 0xd7, 0x00, 0x00, 0x40, 0xfa, 0x00, 0x01, 0xff,
+        0xe8, 0xfe, 0x00, 0x04, 0x80, 0x00, 0x00, 0xff, 0xfc, 0xfe, 0x00, 0x05, 0x20, 0x00, 0x00, 0xff,
+        0xff, 0x80, 0xfc, 0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00,
+        0xfd, 0xff, 0x00, 0xfd, 0xfe, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x01, 0xe0, 0x00, 0xfb,
+        0xff, 0x01, 0xe0, 0x00, 0xfb, 0xff, 0x01, 0x80, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x00, 0xfc,
+        0xff, 0x02, 0xf0, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc,
+        0xff, 0xfe, 0x00, 0xfc, 0xff, 0x02, 0x87, 0x80, 0x00, 0xfc, 0xff, 0x02, 0xda, 0x00, 0x00, 0xfc,
+        0xff, 0x02, 0x80, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xe0, 0xfe,
+        0x00, 0xfd, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0xfc, 0xff, 0xfe,
+        0x00, 0xfb, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x01, 0xfe, 0x00, 0xc1, 0xff,
+    };
+}
@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <cstdio>
+
+#include "sim.hpp"
+#include "constants.hpp"
+#include "core/framebuffer.hpp"
+#include "apps/stopwatch.hpp"
+#include "apps/clock.hpp"
+#include "apps/pet.hpp"
+
+// Counts the bytes that reach the I2C bus for each frame of the apps that redraw continuously, against the full
+// 1 KiB frame that display.display() sent before the framebuffer only transferred the changed pages
+
+extern Adafruit_SSD1306 display; // The one in main.cpp, setup() is not run
+
+namespace apps::stopwatch {
+    extern uint64_t start_time_us;
+}
+
+namespace apps::pet {
+    extern uint16_t current_frame;
+}
+
+namespace {
+    constexpr uint32_t frames_per_app = 48;
+    uint64_t full_frame_bytes = 0;
+
+    // Draws one frame, waits for its transfer and returns the bytes it put on the bus
+    uint64_t frame_bytes(void (*draw)(Adafruit_SSD1306&)) {
+        framebuffer::sync();
+        uint64_t before = sim::i2c_bytes_written();
+        draw(display);
+        framebuffer::sync();
+        return sim::i2c_bytes_written() - before;
+    }
+
+    void report(const char* app, uint64_t total_bytes) {
+        char message[128];
+        snprintf(message, sizeof(message), "%s: %llu bytes per frame, full frame %llu bytes", app,
+            static_cast<unsigned long long>(total_bytes / frames_per_app),
+            static_cast<unsigned long long>(full_frame_bytes));
+        TEST_MESSAGE(message);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_full_frame() {
+    display.clearDisplay();
+    uint64_t before = sim::i2c_bytes_written();
+    display.display();
+    full_frame_bytes = sim::i2c_bytes_written() - before;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT64(SCREEN_WIDTH * SCREEN_HEIGHT / 8, full_frame_bytes);
+}
+
+void test_stopwatch_bytes() {
+    apps::stopwatch::start_time_us = sim::now_us();
+    frame_bytes(apps::stopwatch::draw); // The first frame also sends the title bar and the labels
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < frames_per_app; ++i) {
+        sim::sleep_until_us(sim::now_us() + 40000); // 25 fps while running
+        total += frame_bytes(apps::stopwatch::draw);
+    }
+    report("stopwatch", total);
+    TEST_ASSERT_LESS_THAN_UINT64(full_frame_bytes * frames_per_app / 4, total);
+}
+
+void test_clock_bytes() {
+    frame_bytes(apps::clock::draw);
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < frames_per_app; ++i) {
+        sim::sleep_until_us(sim::now_us() + 1000000); // Redrawn when the second changes
+        total += frame_bytes(apps::clock::draw);
+    }
+    report("clock", total);
+    TEST_ASSERT_LESS_THAN_UINT64(full_frame_bytes * frames_per_app / 4, total);
+}
+
+void test_pet_bytes() {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < frames_per_app; ++i) {
+        apps::pet::current_frame = i % 2; // The animation alternates frames of the sprite sheet
+        total += frame_bytes(apps::pet::draw);
+    }
+    report("pet", total);
+    TEST_ASSERT_LESS_THAN_UINT64(full_frame_bytes * frames_per_app / 2, total);
+}
+
+int main(int argc, char** argv) {
+    sim::set_speed(20); // Only bytes are measured, the simulated time just has to move
+    Wire.begin(SDA_PIN, SCL_PIN);
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    framebuffer::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_full_frame);
+    RUN_TEST(test_stopwatch_bytes);
+    RUN_TEST(test_clock_bytes);
+    RUN_TEST(test_pet_bytes);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "sim.hpp"
+#include "constants.hpp"
+#include "core/events.hpp"
+
+// Holds buttons down on the simulated clock and checks every repeat against the deadline the repeat timer should
+// have used: REPEAT_DELAY_US after the press, then intervals shrinking by REPEAT_ACCELERATION_PERCENT down to
+// MIN_REPEAT_INTERVAL_US, each one counted from the previous deadline so late timer callbacks do not add up
+
+namespace {
+    constexpr uint64_t max_lateness_us = 20000; // Host scheduling jitter of the timer task, well under an interval
+
+    std::mutex presses_mutex;
+    std::vector<events::ButtonPressEvent> presses;
+
+    void consumer_task(void* param) {
+        events::enable_events();
+        while (true) {
+            events::Event ev = events::get_next_event(100);
+            if (ev.type == events::EventType::BUTTON_PRESS) {
+                std::lock_guard<std::mutex> lock(presses_mutex);
+                presses.push_back(ev.button_press_event);
+            }
+        }
+    }
+
+    std::vector<events::ButtonPressEvent> take_presses(events::Button button) {
+        std::lock_guard<std::mutex> lock(presses_mutex);
+        std::vector<events::ButtonPressEvent> taken;
+        std::vector<events::ButtonPressEvent> others;
+        for (const auto& press : presses) {
+            (press.button == button ? taken : others).push_back(press);
+        }
+        presses = others;
+        return taken;
+    }
+
+    // Deadlines of the repeats of a button pressed at pressed_us and released at released_us
+    std::vector<uint64_t> expected_repeats(uint64_t pressed_us, uint64_t released_us) {
+        std::vector<uint64_t> deadlines;
+        uint64_t next = pressed_us + REPEAT_DELAY_US;
+        uint64_t interval = REPEAT_INTERVAL_US;
+        while (next < released_us) {
+            deadlines.push_back(next);
+            next += interval;
+            interval = MAX(MIN_REPEAT_INTERVAL_US, interval * REPEAT_ACCELERATION_PERCENT / 100);
+        }
+        return deadlines;
+    }
+
+    void check_repeats(const char* name, const std::vector<events::ButtonPressEvent>& received, uint64_t released_us) {
+        TEST_ASSERT_TRUE_MESSAGE(!received.empty() && !received[0].repeated, "the press itself was not received");
+        std::vector<uint64_t> deadlines = expected_repeats(received[0].timestamp, released_us);
+        // A deadline right at the release may or may not fire, the tests release halfway between two repeats
+        TEST_ASSERT_EQUAL_UINT32(deadlines.size(), received.size() - 1);
+        uint64_t worst_us = 0;
+        for (size_t i = 0; i < deadlines.size(); i++) {
+            const auto& repeat = received[i + 1];
+            TEST_ASSERT_TRUE(repeat.repeated);
+            TEST_ASSERT_GREATER_OR_EQUAL_UINT64(deadlines[i], repeat.timestamp); // Never early
+            TEST_ASSERT_LESS_OR_EQUAL_UINT64(deadlines[i] + max_lateness_us, repeat.timestamp);
+            worst_us = MAX(worst_us, repeat.timestamp - deadlines[i]);
+        }
+        char message[96];
+        snprintf(message, sizeof(message), "%s: %u repeats, worst %llu us after the deadline", name,
+            static_cast<unsigned>(deadlines.size()), static_cast<unsigned long long>(worst_us));
+        TEST_MESSAGE(message);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_single_hold() {
+    sim::set_pin_level(DOWN_PIN, LOW);
+    uint64_t pressed_us = sim::now_us();
+    sim::sleep_until_us(pressed_us + 3024000); // Halfway between two repeats
+    sim::set_pin_level(DOWN_PIN, HIGH);
+    uint64_t released_us = sim::now_us();
+    sim::sleep_until_us(released_us + 500000); // Nothing may repeat after the release
+    check_repeats("DOWN held 3 s", take_presses(events::Button::DOWN), released_us);
+}
+
+void test_overlapping_holds() {
+    // Two buttons held at the same time share the one-shot timer, each keeps its own deadlines
+    sim::sleep_until_us(sim::now_us() + 400000); // Past the debounce of the last release
+    sim::set_pin_level(UP_PIN, LOW);
+    sim::sleep_until_us(sim::now_us() + 230000);
+    sim::set_pin_level(RIGHT_PIN, LOW);
+    sim::sleep_until_us(sim::now_us() + 1490000); // Hold times halfway between two repeats
+    sim::set_pin_level(UP_PIN, HIGH);
+    uint64_t up_released_us = sim::now_us();
+    sim::sleep_until_us(up_released_us + 584000);
+    sim::set_pin_level(RIGHT_PIN, HIGH);
+    uint64_t right_released_us = sim::now_us();
+    sim::sleep_until_us(right_released_us + 500000);
+    check_repeats("UP held 1.7 s", take_presses(events::Button::UP), up_released_us);
+    check_repeats("RIGHT held 2.1 s", take_presses(events::Button::RIGHT), right_released_us);
+}
+
+int main(int argc, char** argv) {
+    for (auto pin : {A_PIN, B_PIN, UP_PIN, DOWN_PIN, LEFT_PIN, RIGHT_PIN}) {
+        sim::set_pin_level(pin, HIGH);
+    }
+    xTaskCreate(consumer_task, "EventConsumer", 4096, nullptr, 1, nullptr);
+    // Until the interrupts are attached and past the debounce window, which starts at boot
+    sim::sleep_until_us(sim::now_us() + DEBOUNCE_DELAY_US + 100000);
+    UNITY_BEGIN();
+    RUN_TEST(test_single_hold);
+    RUN_TEST(test_overlapping_holds);
+    return UNITY_END();
+}
@@ -0,0 +1,117 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "constants.hpp"
+#include "core/framebuffer.hpp"
+#include "core/menu.hpp"
+#include "core/timekeeper.hpp"
+#include "apps/clock.hpp"
+
+// Host time of apps::clock::draw against the same screen drawn with the Adafruit GFX print calls it used before the
+// text renderer, kept here as the reference. Both flush the frame, as the app does.
+
+namespace menu {
+    void draw_alarm_icon(Adafruit_SSD1306& display);
+}
+
+namespace {
+    constexpr uint32_t frames = 5000;
+    constexpr size_t BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+
+    // The title bar before the text renderer and its cache
+    void draw_gfx_titlebar(const char* title) {
+        display.setTextSize(1);
+        display.fillRect(0, 0, SCREEN_WIDTH, 8, SSD1306_WHITE);
+        display.setTextColor(SSD1306_BLACK);
+        display.setCursor(0, 0);
+        display.print(" ");
+        display.println(title);
+        menu::draw_alarm_icon(display);
+        menu::draw_battery_icon(display);
+        menu::draw_wifi_icon(display);
+        display.setTextColor(SSD1306_WHITE);
+    }
+
+    // The since boot screen of the clock before the text renderer
+    void draw_gfx_clock() {
+        display.clearDisplay();
+        draw_gfx_titlebar("Clock");
+        display.fillRect(0, 8, SCREEN_WIDTH / 2, 8, SSD1306_WHITE);
+        display.setTextColor(SSD1306_INVERSE);
+        display.setTextSize(1);
+        display.setCursor(16, 8);
+        display.println("BOOT");
+        display.setCursor(SCREEN_WIDTH - 16 - 3 * 6, 8);
+        display.println("RTC");
+        unsigned long long total_seconds = timekeeper::now_us() / 1000000;
+        unsigned long long days = total_seconds / 86400;
+        char buffer[30];
+        display.setTextSize(1);
+        display.setCursor(10, 18);
+        snprintf(buffer, sizeof(buffer), "%llu day%s", days, days == 1 ? "" : "s");
+        display.println(buffer);
+        display.setCursor(10, 32);
+        display.setTextSize(2);
+        snprintf(buffer, sizeof(buffer), "%02llu:%02llu:%02llu", (total_seconds % 86400) / 3600,
+            (total_seconds % 3600) / 60, total_seconds % 60);
+        display.println(buffer);
+        display.setTextSize(1);
+        display.setCursor(10, 50);
+        display.println("since boot");
+        framebuffer::flush(display);
+    }
+
+    void draw_clock() {
+        apps::clock::draw(display);
+    }
+
+    double frame_time_us(void (*draw)()) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < frames; i++) {
+            draw();
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / frames;
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_same_frame() {
+    uint8_t expected[BUFFER_SIZE];
+    // Both frames must show the same second
+    uint64_t second;
+    do {
+        second = timekeeper::now_us() / 1000000;
+        draw_gfx_clock();
+        memcpy(expected, display.getBuffer(), BUFFER_SIZE);
+        draw_clock();
+    } while (timekeeper::now_us() / 1000000 != second);
+    TEST_ASSERT_EQUAL_MEMORY(expected, display.getBuffer(), BUFFER_SIZE);
+}
+
+void test_draw_time() {
+    double gfx_us = frame_time_us(draw_gfx_clock);
+    double text_us = frame_time_us(draw_clock);
+    char message[96];
+    snprintf(message, sizeof(message), "clock draw: GFX print %.1f us, text renderer %.1f us per frame", gfx_us, text_us);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(text_us < gfx_us);
+}
+
+int main(int argc, char** argv) {
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    framebuffer::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_same_frame);
+    RUN_TEST(test_draw_time);
+    return UNITY_END();
+}
@@ -0,0 +1,215 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <esp_partition.h>
+#include <unistd.h>
+#include <vector>
+
+#include "sim.hpp"
+#include "core/datalog.hpp"
+#include "core/thermometer.hpp"
+#include "constants.hpp"
+
+// Runs the data log over a file backed "datalog" partition: wraps around the sectors, reboots from the file alone
+// or from deep sleep with the batch kept in RTC memory, and reads back a log with torn and corrupted records
+
+namespace datalog {
+    extern const esp_partition_t* partition;
+    extern uint32_t next_sequence;
+    extern uint32_t batch_size;
+    bool open_log();
+    void add_record(const Record& sample);
+}
+
+namespace {
+    constexpr uint32_t sector_count = 4;
+    constexpr uint32_t records_per_sector = SPI_FLASH_SEC_SIZE / sizeof(datalog::Record);
+    char path[] = "/tmp/datalog_XXXXXX";
+
+    datalog::Record sample_for(uint32_t sequence) {
+        datalog::Record sample = {};
+        sample.time_s = 1750000000 + sequence * 60;
+        sample.internal_cc = static_cast<int16_t>(3000 + sequence % 100);
+        sample.external_cc = static_cast<int16_t>(-500 + sequence % 1000);
+        sample.battery_mv = static_cast<uint16_t>(3700 + sequence % 300);
+        return sample;
+    }
+
+    void add_records(uint32_t count) {
+        uint32_t end = datalog::get_range().end;
+        for (uint32_t sequence = end; sequence < end + count; ++sequence) {
+            datalog::add_record(sample_for(sequence));
+        }
+    }
+
+    // Every record of the range reads back with the content it was added with
+    void check_records(const datalog::Range& range) {
+        for (uint32_t sequence = range.first; sequence < range.end; ++sequence) {
+            datalog::Record record;
+            TEST_ASSERT_TRUE_MESSAGE(datalog::get_record(sequence, record), "a record of the range cannot be read");
+            datalog::Record expected = sample_for(sequence);
+            TEST_ASSERT_EQUAL_UINT32(sequence, record.sequence);
+            TEST_ASSERT_EQUAL_UINT32(expected.time_s, record.time_s);
+            TEST_ASSERT_EQUAL_INT(expected.internal_cc, record.internal_cc);
+            TEST_ASSERT_EQUAL_INT(expected.external_cc, record.external_cc);
+            TEST_ASSERT_EQUAL_UINT(expected.battery_mv, record.battery_mv);
+        }
+    }
+
+    std::vector<uint8_t> read_file() {
+        std::vector<uint8_t> content(sector_count * SPI_FLASH_SEC_SIZE);
+        FILE* file = fopen(path, "rb");
+        size_t read = fread(content.data(), 1, content.size(), file);
+        fclose(file);
+        content.resize(read);
+        return content;
+    }
+
+    void write_file(size_t offset, const void* data, size_t size) {
+        FILE* file = fopen(path, "r+b");
+        fseek(file, static_cast<long>(offset), SEEK_SET);
+        fwrite(data, 1, size, file);
+        fclose(file);
+    }
+
+    size_t record_offset(uint32_t sequence) {
+        return ((sequence / records_per_sector) % sector_count) * SPI_FLASH_SEC_SIZE + (sequence % records_per_sector) * sizeof(datalog::Record);
+    }
+
+    // Boots again with only what is in the file, or also with the RTC memory when waking up from deep sleep
+    void reboot(bool from_deep_sleep) {
+        TEST_ASSERT_TRUE(sim::set_partition_file("datalog", path));
+        datalog::partition = nullptr;
+        datalog::next_sequence = 0;
+        if (!from_deep_sleep) {
+            datalog::batch_size = 0;
+        }
+        TEST_ASSERT_TRUE(datalog::open_log());
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_wrap() {
+    // More than the partition holds, the oldest sector is erased when the log enters it again
+    add_records(sector_count * records_per_sector + records_per_sector / 2 + 1);
+    datalog::Range range = datalog::get_range();
+    TEST_ASSERT_EQUAL_UINT32(sector_count * records_per_sector + records_per_sector / 2 + 1, range.end);
+    // The sector being filled and the full ones but the next one to be erased
+    TEST_ASSERT_EQUAL_UINT32(records_per_sector, range.first);
+    check_records(range);
+    datalog::Record record;
+    TEST_ASSERT_FALSE(datalog::get_record(range.first - 1, record));
+    TEST_ASSERT_FALSE(datalog::get_record(range.end, record));
+}
+
+void test_reboot() {
+    datalog::Range before = datalog::get_range();
+    uint32_t pending = datalog::batch_size;
+    TEST_ASSERT_TRUE(pending > 0); // The last records are only in the batch
+    reboot(false);
+    datalog::Range after = datalog::get_range();
+    TEST_ASSERT_EQUAL_UINT32(before.first, after.first);
+    TEST_ASSERT_EQUAL_UINT32(before.end - pending, after.end); // Power lost with the batch
+    check_records(after);
+    add_records(DATALOG_BATCH_RECORDS);
+    check_records(datalog::get_range());
+}
+
+void test_deep_sleep_keeps_batch() {
+    // Fills the batch to one short of a write, none of it may reach the flash
+    add_records(DATALOG_BATCH_RECORDS - 1 - datalog::batch_size);
+    TEST_ASSERT_EQUAL_UINT32(DATALOG_BATCH_RECORDS - 1, datalog::batch_size);
+    std::vector<uint8_t> flash = read_file();
+    datalog::Range before = datalog::get_range();
+    reboot(true);
+    datalog::Range after = datalog::get_range();
+    TEST_ASSERT_EQUAL_UINT32(before.first, after.first);
+    TEST_ASSERT_EQUAL_UINT32(before.end, after.end);
+    check_records(after);
+    TEST_ASSERT_TRUE_MESSAGE(read_file() == flash, "a record went to flash before the batch was full");
+    add_records(1); // Fills the batch, written in one go
+    TEST_ASSERT_EQUAL_UINT32(0, datalog::batch_size);
+    TEST_ASSERT_TRUE(read_file() != flash);
+    reboot(false);
+    TEST_ASSERT_EQUAL_UINT32(before.end + 1, datalog::get_range().end);
+    check_records(datalog::get_range());
+
+    // A batch that does not follow the log, here the one just written, is dropped instead of numbered wrong
+    datalog::batch_size = 2;
+    reboot(true);
+    TEST_ASSERT_EQUAL_UINT32(0, datalog::batch_size);
+    TEST_ASSERT_EQUAL_UINT32(before.end + 1, datalog::get_range().end);
+}
+
+void test_torn_record() {
+    // Fills the batch so the log ends on a write, then tears the record after the end and corrupts an older one
+    add_records(DATALOG_BATCH_RECORDS - datalog::batch_size);
+    TEST_ASSERT_EQUAL_UINT32(0, datalog::batch_size);
+    datalog::Range range = datalog::get_range();
+    datalog::Record torn = sample_for(range.end);
+    torn.sequence = range.end;
+    write_file(record_offset(range.end), &torn, 8); // Reset in the middle of the write, no CRC yet
+    uint32_t corrupted = range.end - 5;
+    uint8_t flipped = 0x5A;
+    write_file(record_offset(corrupted) + 9, &flipped, 1);
+
+    reboot(false);
+    datalog::Range after = datalog::get_range();
+    TEST_ASSERT_EQUAL_UINT32(range.end + 1, after.end); // The torn slot counts as written, it cannot be written again
+    datalog::Record record;
+    TEST_ASSERT_FALSE(datalog::get_record(range.end, record));
+    TEST_ASSERT_FALSE(datalog::get_record(corrupted, record));
+    for (uint32_t sequence = after.first; sequence < range.end; ++sequence) {
+        if (sequence != corrupted) {
+            TEST_ASSERT_TRUE(datalog::get_record(sequence, record));
+        }
+    }
+
+    // The log goes on after the torn record
+    uint32_t end = after.end;
+    for (uint32_t sequence = end; sequence < end + DATALOG_BATCH_RECORDS; ++sequence) {
+        datalog::add_record(sample_for(sequence));
+    }
+    reboot(false);
+    check_records({end, datalog::get_range().end});
+    TEST_ASSERT_EQUAL_UINT32(end + DATALOG_BATCH_RECORDS, datalog::get_range().end);
+}
+
+void test_sample_schedule() {
+    // The first sample of a boot is due right away, the next one an interval later
+    thermometer::read_once();
+    TEST_ASSERT_EQUAL_UINT64(0, datalog::next_sample_in_us());
+    uint32_t end = datalog::get_range().end;
+    datalog::sample_once();
+    TEST_ASSERT_EQUAL_UINT32(end + 1, datalog::get_range().end);
+    uint64_t wait_us = datalog::next_sample_in_us();
+    TEST_ASSERT_TRUE(wait_us > DATALOG_SAMPLE_INTERVAL_MS * 1000 - 2000000 && wait_us <= DATALOG_SAMPLE_INTERVAL_MS * 1000);
+    datalog::Record record;
+    TEST_ASSERT_TRUE(datalog::get_record(end, record));
+    TEST_ASSERT_EQUAL_INT(2150, record.external_cc);
+    TEST_ASSERT_EQUAL_INT(3500, record.internal_cc);
+}
+
+int main(int argc, char** argv) {
+    int fd = mkstemp(path);
+    std::vector<uint8_t> erased(sector_count * SPI_FLASH_SEC_SIZE, 0xFF);
+    if (fd < 0 || write(fd, erased.data(), erased.size()) != static_cast<ssize_t>(erased.size())) {
+        return 1;
+    }
+    close(fd);
+    sim::set_partition_file("datalog", path);
+    datalog::open_log();
+    UNITY_BEGIN();
+    RUN_TEST(test_wrap);
+    RUN_TEST(test_reboot);
+    RUN_TEST(test_deep_sleep_keeps_batch);
+    RUN_TEST(test_torn_record);
+    RUN_TEST(test_sample_schedule);
+    int failures = UNITY_END();
+    unlink(path);
+    return failures;
+}
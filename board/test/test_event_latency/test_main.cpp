@@ -0,0 +1,103 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "sim.hpp"
+#include "constants.hpp"
+
+// Boots the whole firmware on the simulated clock, replays a script of button taps on the main menu and measures
+// the time from each press to the first byte of the new frame reaching the panel
+
+namespace {
+    struct Tap {
+        uint32_t at_ms;
+        uint8_t pin;
+    };
+
+    // Taps are more than DOUBLE_PRESS_US apart, so each one is handled on its own
+    constexpr Tap script[] = {
+        {2000, DOWN_PIN},
+        {2700, DOWN_PIN},
+        {3400, DOWN_PIN},
+        {4100, UP_PIN},
+        {4800, DOWN_PIN},
+        {5500, UP_PIN},
+        {6200, UP_PIN},
+        {6900, DOWN_PIN},
+    };
+    constexpr uint64_t tap_duration_us = 80000;
+    constexpr uint64_t max_latency_us = 40000; // Well under the 100 ms polling period the event loop used to have
+
+    std::atomic<uint32_t> loop_iterations{0};
+
+    void count_iteration() {
+        loop_iterations++;
+    }
+
+    // Simulated time at which the panel content moves past revision, 0 on timeout
+    uint64_t wait_for_frame(uint64_t revision, uint64_t timeout_us) {
+        uint64_t deadline = sim::now_us() + timeout_us;
+        while (sim::now_us() < deadline) {
+            if (sim::panel_revision() != revision) {
+                return sim::now_us();
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        return 0;
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_press_to_draw_latency() {
+    uint64_t total_us = 0;
+    uint64_t worst_us = 0;
+    for (const Tap& tap : script) {
+        sim::sleep_until_us(tap.at_ms * 1000ULL);
+        uint64_t revision = sim::panel_revision();
+        uint64_t pressed_us = sim::now_us();
+        sim::set_pin_level(tap.pin, LOW);
+        uint64_t drawn_us = wait_for_frame(revision, 500000);
+        TEST_ASSERT_TRUE_MESSAGE(drawn_us != 0, "a tap did not redraw the menu");
+        uint64_t latency_us = drawn_us - pressed_us;
+        total_us += latency_us;
+        worst_us = latency_us > worst_us ? latency_us : worst_us;
+        sim::sleep_until_us(pressed_us + tap_duration_us);
+        sim::set_pin_level(tap.pin, HIGH);
+    }
+    char message[96];
+    snprintf(message, sizeof(message), "press-to-draw latency: mean %llu us, worst %llu us over %u taps",
+        static_cast<unsigned long long>(total_us / (sizeof(script) / sizeof(script[0]))),
+        static_cast<unsigned long long>(worst_us), static_cast<unsigned>(sizeof(script) / sizeof(script[0])));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(max_latency_us, worst_us);
+}
+
+void test_idle_wakeups() {
+    // The last tap has been handled, the menu has nothing to do until the minute changes in the title bar
+    sim::sleep_until_us(sim::now_us() + 1000000);
+    uint32_t before = loop_iterations.load();
+    sim::sleep_until_us(sim::now_us() + 5000000);
+    uint32_t wakeups = loop_iterations.load() - before;
+    char message[64];
+    snprintf(message, sizeof(message), "idle loop iterations in 5 s: %u", static_cast<unsigned>(wakeups));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, wakeups); // Polling every 100 ms made it 50
+}
+
+int main(int argc, char** argv) {
+    for (auto pin : {A_PIN, B_PIN, UP_PIN, DOWN_PIN, LEFT_PIN, RIGHT_PIN}) {
+        sim::set_pin_level(pin, HIGH);
+    }
+    sim::set_analog_value(BAT_PIN, 2420); // About 3.9 V behind the divider
+    sim::start_firmware(count_iteration);
+    UNITY_BEGIN();
+    RUN_TEST(test_press_to_draw_latency);
+    RUN_TEST(test_idle_wakeups);
+    return UNITY_END();
+}
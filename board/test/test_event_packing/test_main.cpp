@@ -0,0 +1,120 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "core/events.hpp"
+
+// Round trips of events through the 12 byte ring representation: timestamps cut to 32 bits and restored from a
+// later time, including across the 2^32 us wrap, and release durations saturating at UINT32_MAX
+
+namespace {
+    using events::Button;
+    using events::Event;
+    using events::EventType;
+
+    constexpr uint64_t WRAP = 1ULL << 32;
+
+    Event press(uint64_t timestamp, Button button, Button hold, bool repeated) {
+        Event ev = { .type = EventType::BUTTON_PRESS, {}};
+        ev.button_press_event = {button, hold, timestamp, repeated};
+        return ev;
+    }
+
+    Event release(uint64_t timestamp, Button button, Button hold, uint64_t duration) {
+        Event ev = { .type = EventType::BUTTON_RELEASE, {}};
+        ev.button_release_event = {button, hold, timestamp, duration};
+        return ev;
+    }
+
+    void check_press(const Event& ev, uint64_t now) {
+        Event out = events::unpack_event(events::pack_event(ev), now);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(EventType::BUTTON_PRESS), static_cast<uint8_t>(out.type));
+        TEST_ASSERT_EQUAL_UINT64(ev.button_press_event.timestamp, out.button_press_event.timestamp);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(ev.button_press_event.button), static_cast<uint8_t>(out.button_press_event.button));
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(ev.button_press_event.hold), static_cast<uint8_t>(out.button_press_event.hold));
+        TEST_ASSERT_EQUAL(ev.button_press_event.repeated, out.button_press_event.repeated);
+    }
+
+    void check_release(const Event& ev, uint64_t now, uint64_t expected_duration) {
+        Event out = events::unpack_event(events::pack_event(ev), now);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(EventType::BUTTON_RELEASE), static_cast<uint8_t>(out.type));
+        TEST_ASSERT_EQUAL_UINT64(ev.button_release_event.timestamp, out.button_release_event.timestamp);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(ev.button_release_event.button), static_cast<uint8_t>(out.button_release_event.button));
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(ev.button_release_event.hold), static_cast<uint8_t>(out.button_release_event.hold));
+        TEST_ASSERT_EQUAL_UINT64(expected_duration, out.button_release_event.duration);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_press_round_trip() {
+    const Button all = Button::A | Button::B | Button::UP | Button::DOWN | Button::LEFT | Button::RIGHT;
+    for (uint8_t i = 0; i < 6; i++) {
+        Button button = static_cast<Button>(1 << i);
+        check_press(press(1000 + i, button, button, false), 2000);
+        check_press(press(1000 + i, button, all, true), 2000);
+    }
+    check_press(press(123456789, Button::A, Button::A | Button::B, false), 123456789); // Consumed right away
+}
+
+void test_release_round_trip() {
+    check_release(release(5000000, Button::UP, Button::NONE, 4500000), 5000100, 4500000);
+    check_release(release(5000000, Button::RIGHT, Button::LEFT, 0), 5000000, 0);
+}
+
+void test_duration_saturation() {
+    check_release(release(WRAP * 3, Button::B, Button::NONE, UINT32_MAX - 1), WRAP * 3 + 10, UINT32_MAX - 1);
+    check_release(release(WRAP * 3, Button::B, Button::NONE, UINT32_MAX), WRAP * 3 + 10, UINT32_MAX);
+    check_release(release(WRAP * 3, Button::B, Button::NONE, UINT32_MAX + 1ULL), WRAP * 3 + 10, UINT32_MAX);
+    check_release(release(WRAP * 3, Button::B, Button::NONE, 5 * WRAP + 7), WRAP * 3 + 10, UINT32_MAX); // Held for days
+}
+
+void test_timestamp_wrap() {
+    // Pushed just before the low 32 bits wrap, consumed just after
+    check_press(press(WRAP - 10, Button::DOWN, Button::DOWN, false), WRAP + 5);
+    check_release(release(7 * WRAP - 1, Button::A, Button::NONE, 80000), 7 * WRAP, 80000);
+    // Consumed as late as the representation allows
+    check_press(press(2 * WRAP + 100, Button::LEFT, Button::LEFT, true), 3 * WRAP + 99);
+    // Past that the event would look 2^32 us newer than it is, get_next_event never keeps one that long
+    Event late = events::unpack_event(events::pack_event(press(100, Button::A, Button::A, false)), WRAP + 100);
+    TEST_ASSERT_EQUAL_UINT64(WRAP + 100, late.button_press_event.timestamp);
+}
+
+void test_other_types() {
+    Event none = { .type = EventType::NONE, {}};
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(EventType::NONE), static_cast<uint8_t>(events::unpack_event(events::pack_event(none), 0).type));
+    Event gesture = { .type = EventType::GESTURE, {}};
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(EventType::GESTURE), events::pack_event(gesture).type); // Fits the 2 bits
+}
+
+void test_pack_benchmark() {
+    constexpr uint32_t rounds = 5000000;
+    Event ev = release(WRAP - 1000, Button::UP, Button::UP | Button::A, 123456);
+    uint64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        ev.button_release_event.timestamp += 3;
+        events::PackedEvent packed = events::pack_event(ev);
+        checksum += events::unpack_event(packed, ev.button_release_event.timestamp + 50).button_release_event.timestamp;
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    char message[128];
+    snprintf(message, sizeof(message), "pack + unpack: %.1f ns per event, %u bytes per ring slot instead of %u",
+        elapsed.count() / rounds, static_cast<unsigned>(sizeof(events::PackedEvent)), static_cast<unsigned>(sizeof(Event)));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(checksum != 0); // Keeps the loop from being optimized away
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_press_round_trip);
+    RUN_TEST(test_release_round_trip);
+    RUN_TEST(test_duration_saturation);
+    RUN_TEST(test_timestamp_wrap);
+    RUN_TEST(test_other_types);
+    RUN_TEST(test_pack_benchmark);
+    return UNITY_END();
+}
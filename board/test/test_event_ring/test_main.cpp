@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "constants.hpp"
+#include "core/events.hpp"
+
+// Two threads hammer the event ring as the button ISRs and the consumer task do. Every event carries its sequence
+// number in the timestamp and its complement in the duration, so a slot read while the producer overwrote it shows
+// up as a mismatch, and lost or repeated events show up as gaps the dropped counter does not explain.
+
+namespace {
+    constexpr uint32_t event_count = 500000;
+
+    events::PackedEvent make_event(uint32_t sequence) {
+        events::PackedEvent ev = {};
+        ev.timestamp = sequence;
+        ev.duration = ~sequence;
+        ev.type = static_cast<uint8_t>(events::EventType::BUTTON_PRESS);
+        ev.button = sequence % 64;
+        ev.hold = ~sequence % 64;
+        return ev;
+    }
+
+    struct Result {
+        uint32_t received;
+        uint32_t torn;
+        uint32_t out_of_order;
+        uint32_t dropped;
+    };
+
+    // Consumes until the producer is done and the ring is empty, also yielding every pause_every events
+    Result consume(std::atomic<bool>& done, uint32_t pause_every) {
+        Result result = {};
+        uint32_t dropped_before = events::get_dropped_event_count();
+        uint32_t expected = 0;
+        events::PackedEvent ev;
+        while (true) {
+            bool finished = done.load(std::memory_order_acquire);
+            if (!events::pop_event(ev)) {
+                if (finished) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            result.received++;
+            if (ev.duration != ~ev.timestamp || ev.button != ev.timestamp % 64 || ev.hold != ~ev.timestamp % 64) {
+                result.torn++;
+            }
+            if (ev.timestamp < expected) {
+                result.out_of_order++;
+            }
+            expected = ev.timestamp + 1;
+            if (pause_every != 0 && result.received % pause_every == 0) {
+                std::this_thread::yield();
+            }
+        }
+        result.dropped = events::get_dropped_event_count() - dropped_before;
+        return result;
+    }
+
+    // The producer gives up the CPU after every burst of events, as the interrupts come in bursts with gaps
+    // between them. The yields also let the two threads interleave on a single core host.
+    Result run(uint32_t burst, uint32_t pause_every) {
+        events::clear_event_queue();
+        std::atomic<bool> done{false};
+        std::thread producer([&done, burst] {
+            for (uint32_t i = 0; i < event_count; i++) {
+                events::push_event(make_event(i));
+                if (i % burst == burst - 1) {
+                    std::this_thread::yield();
+                }
+            }
+            done.store(true, std::memory_order_release);
+        });
+        Result result = consume(done, pause_every);
+        producer.join();
+        return result;
+    }
+
+    void report(const char* name, const Result& result) {
+        char message[128];
+        snprintf(message, sizeof(message), "%s: %u received, %u dropped, %u torn, %u out of order", name,
+            static_cast<unsigned>(result.received), static_cast<unsigned>(result.dropped),
+            static_cast<unsigned>(result.torn), static_cast<unsigned>(result.out_of_order));
+        TEST_MESSAGE(message);
+    }
+
+    void check(const Result& result) {
+        TEST_ASSERT_EQUAL_UINT32(0, result.torn);
+        TEST_ASSERT_EQUAL_UINT32(0, result.out_of_order);
+        // Every event pushed is either received or counted as dropped
+        TEST_ASSERT_EQUAL_UINT32(event_count, result.received + result.dropped);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_paced_producer() {
+    Result result = run(4, 0);
+    report("paced producer", result);
+    check(result);
+}
+
+void test_flooding_producer() {
+    Result result = run(event_count, 0);
+    report("flooding producer", result);
+    check(result);
+}
+
+void test_lapped_consumer() {
+    Result result = run(3 * EVENT_QUEUE_SIZE, 4);
+    report("lapped consumer", result);
+    check(result);
+}
+
+void test_single_thread_overwrite() {
+    // Filling the ring past its size keeps the newest EVENT_QUEUE_SIZE events
+    events::clear_event_queue();
+    uint32_t dropped_before = events::get_dropped_event_count();
+    for (uint32_t i = 0; i < 3 * EVENT_QUEUE_SIZE + 5; i++) {
+        events::push_event(make_event(i));
+    }
+    events::PackedEvent ev;
+    for (uint32_t i = 2 * EVENT_QUEUE_SIZE + 5; i < 3 * EVENT_QUEUE_SIZE + 5; i++) {
+        TEST_ASSERT_TRUE(events::pop_event(ev));
+        TEST_ASSERT_EQUAL_UINT32(i, ev.timestamp);
+    }
+    TEST_ASSERT_FALSE(events::pop_event(ev));
+    TEST_ASSERT_EQUAL_UINT32(2 * EVENT_QUEUE_SIZE + 5, events::get_dropped_event_count() - dropped_before);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_single_thread_overwrite);
+    RUN_TEST(test_paced_producer);
+    RUN_TEST(test_flooding_producer);
+    RUN_TEST(test_lapped_consumer);
+    return UNITY_END();
+}
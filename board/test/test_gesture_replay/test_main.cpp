@@ -0,0 +1,239 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+#include "sim.hpp"
+#include "constants.hpp"
+#include "core/events.hpp"
+#include "core/gestures.hpp"
+
+// Replays button traces through the gesture recognizer. The traces were recorded from the event trace of the
+// native sim (the same entries the serial export sends) while the matching scripts below were played on its GPIO.
+// The scripts are also replayed live, so a change in the debounce or repeat timing that changes the gestures
+// shows up even if the recorded traces still pass.
+
+namespace {
+    using events::Button;
+    using events::EventType;
+    using events::GestureType;
+
+    struct ExpectedGesture {
+        GestureType type;
+        Button buttons;
+        size_t completed_by; // Index of the trace entry completing the gesture
+    };
+
+    // Held for 1 s, the repeats do not count as presses
+    const events::TraceEntry long_press_a[] = {
+        {500128, 0, EventType::BUTTON_PRESS, Button::A, Button::A, 0},
+        {1000430, 0, EventType::BUTTON_PRESS, Button::A, Button::A, 1},
+        {1300286, 0, EventType::BUTTON_PRESS, Button::A, Button::A, 1},
+        {1500379, 1000251, EventType::BUTTON_RELEASE, Button::A, Button::NONE, 0},
+    };
+    const ExpectedGesture long_press_a_gestures[] = {
+        {GestureType::LONG_PRESS, Button::A, 3},
+    };
+
+    // Second press 400 ms after the first
+    const events::TraceEntry double_press_up[] = {
+        {2500603, 0, EventType::BUTTON_PRESS, Button::UP, Button::UP, 0},
+        {2580730, 80127, EventType::BUTTON_RELEASE, Button::UP, Button::NONE, 0},
+        {2900683, 0, EventType::BUTTON_PRESS, Button::UP, Button::UP, 0},
+        {2980749, 80066, EventType::BUTTON_RELEASE, Button::UP, Button::NONE, 0},
+    };
+    const ExpectedGesture double_press_up_gestures[] = {
+        {GestureType::DOUBLE_PRESS, Button::UP, 2},
+    };
+
+    // DOWN pressed while B is held
+    const events::TraceEntry chord_b_down[] = {
+        {3980890, 0, EventType::BUTTON_PRESS, Button::B, Button::B, 0},
+        {4130986, 0, EventType::BUTTON_PRESS, Button::DOWN, Button::B | Button::DOWN, 0},
+        {4281020, 150034, EventType::BUTTON_RELEASE, Button::DOWN, Button::B, 0},
+        {4381005, 400115, EventType::BUTTON_RELEASE, Button::B, Button::NONE, 0},
+    };
+    const ExpectedGesture chord_b_down_gestures[] = {
+        {GestureType::CHORD, Button::B | Button::DOWN, 1},
+    };
+
+    // Second press 900 ms after the first, more than DOUBLE_PRESS_US
+    const events::TraceEntry presses_too_far_apart[] = {
+        {5381167, 0, EventType::BUTTON_PRESS, Button::LEFT, Button::LEFT, 0},
+        {5461306, 80139, EventType::BUTTON_RELEASE, Button::LEFT, Button::NONE, 0},
+        {6281277, 0, EventType::BUTTON_PRESS, Button::LEFT, Button::LEFT, 0},
+        {6361284, 80007, EventType::BUTTON_RELEASE, Button::LEFT, Button::NONE, 0},
+    };
+
+    // The long hold after a double press is not a long press as well
+    const events::TraceEntry double_press_then_hold_right[] = {
+        {7361443, 0, EventType::BUTTON_PRESS, Button::RIGHT, Button::RIGHT, 0},
+        {7441588, 80145, EventType::BUTTON_RELEASE, Button::RIGHT, Button::NONE, 0},
+        {7761569, 0, EventType::BUTTON_PRESS, Button::RIGHT, Button::RIGHT, 0},
+        {8261698, 0, EventType::BUTTON_PRESS, Button::RIGHT, Button::RIGHT, 1},
+        {8561731, 0, EventType::BUTTON_PRESS, Button::RIGHT, Button::RIGHT, 1},
+        {8761625, 1000056, EventType::BUTTON_RELEASE, Button::RIGHT, Button::NONE, 0},
+    };
+    const ExpectedGesture double_press_then_hold_right_gestures[] = {
+        {GestureType::DOUBLE_PRESS, Button::RIGHT, 2},
+    };
+
+    // Only the press completing a two buttons chord reports it
+    const events::TraceEntry three_buttons_a_b_up[] = {
+        {9761805, 0, EventType::BUTTON_PRESS, Button::A, Button::A, 0},
+        {9861943, 0, EventType::BUTTON_PRESS, Button::B, Button::A | Button::B, 0},
+        {9961944, 0, EventType::BUTTON_PRESS, Button::UP, Button::A | Button::B | Button::UP, 0},
+        {10111951, 150007, EventType::BUTTON_RELEASE, Button::UP, Button::A | Button::B, 0},
+        {10161920, 299977, EventType::BUTTON_RELEASE, Button::B, Button::A, 0},
+        {10211936, 450131, EventType::BUTTON_RELEASE, Button::A, Button::NONE, 0},
+    };
+    const ExpectedGesture three_buttons_a_b_up_gestures[] = {
+        {GestureType::CHORD, Button::A | Button::B, 1},
+    };
+
+    // Contact bounce on press and release, the debounce leaves a single short press
+    const events::TraceEntry bouncing_down[] = {
+        {11212133, 0, EventType::BUTTON_PRESS, Button::DOWN, Button::DOWN, 0},
+        {11214223, 2090, EventType::BUTTON_RELEASE, Button::DOWN, Button::NONE, 0},
+    };
+
+    struct Trace {
+        const char* name;
+        const events::TraceEntry* entries;
+        size_t entry_count;
+        const ExpectedGesture* gestures;
+        size_t gesture_count;
+    };
+
+    const Trace traces[] = {
+        {"long press A", long_press_a, std::size(long_press_a), long_press_a_gestures, std::size(long_press_a_gestures)},
+        {"double press UP", double_press_up, std::size(double_press_up), double_press_up_gestures, std::size(double_press_up_gestures)},
+        {"chord B + DOWN", chord_b_down, std::size(chord_b_down), chord_b_down_gestures, std::size(chord_b_down_gestures)},
+        {"presses too far apart", presses_too_far_apart, std::size(presses_too_far_apart), nullptr, 0},
+        {"double press then hold RIGHT", double_press_then_hold_right, std::size(double_press_then_hold_right), double_press_then_hold_right_gestures, std::size(double_press_then_hold_right_gestures)},
+        {"three buttons A, B, UP", three_buttons_a_b_up, std::size(three_buttons_a_b_up), three_buttons_a_b_up_gestures, std::size(three_buttons_a_b_up_gestures)},
+        {"bouncing DOWN", bouncing_down, std::size(bouncing_down), nullptr, 0},
+    };
+
+    struct Step {
+        uint32_t at_ms;
+        uint8_t pin;
+        bool down;
+    };
+
+    struct Script {
+        const char* name;
+        std::vector<Step> steps;
+    };
+
+    // Played to record the traces above, in the same order
+    const Script scripts[] = {
+        {"long press A", {{0, A_PIN, true}, {1000, A_PIN, false}}},
+        {"double press UP", {{0, UP_PIN, true}, {80, UP_PIN, false}, {400, UP_PIN, true}, {480, UP_PIN, false}}},
+        {"chord B + DOWN", {{0, B_PIN, true}, {150, DOWN_PIN, true}, {300, DOWN_PIN, false}, {400, B_PIN, false}}},
+        {"presses too far apart", {{0, LEFT_PIN, true}, {80, LEFT_PIN, false}, {900, LEFT_PIN, true}, {980, LEFT_PIN, false}}},
+        {"double press then hold RIGHT", {{0, RIGHT_PIN, true}, {80, RIGHT_PIN, false}, {400, RIGHT_PIN, true}, {1400, RIGHT_PIN, false}}},
+        {"three buttons A, B, UP", {{0, A_PIN, true}, {100, B_PIN, true}, {200, UP_PIN, true}, {350, UP_PIN, false}, {400, B_PIN, false}, {450, A_PIN, false}}},
+        {"bouncing DOWN", {{0, DOWN_PIN, true}, {2, DOWN_PIN, false}, {4, DOWN_PIN, true}, {90, DOWN_PIN, false}, {92, DOWN_PIN, true}, {94, DOWN_PIN, false}}},
+    };
+
+    events::Event to_event(const events::TraceEntry& entry) {
+        events::Event ev = { .type = entry.type, {}};
+        if (entry.type == EventType::BUTTON_PRESS) {
+            ev.button_press_event = {entry.button, entry.hold, entry.timestamp, entry.repeated != 0};
+        } else {
+            ev.button_release_event = {entry.button, entry.hold, entry.timestamp, entry.duration};
+        }
+        return ev;
+    }
+
+    struct Recognized {
+        events::GestureEvent gesture;
+        size_t completed_by;
+    };
+
+    void check_gestures(const Trace& trace, const std::vector<Recognized>& recognized) {
+        char message[96];
+        snprintf(message, sizeof(message), "%s: wrong gesture count", trace.name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(trace.gesture_count, recognized.size(), message);
+        for (size_t i = 0; i < trace.gesture_count; i++) {
+            snprintf(message, sizeof(message), "%s: gesture %u differs", trace.name, static_cast<unsigned>(i));
+            const ExpectedGesture& expected = trace.gestures[i];
+            TEST_ASSERT_EQUAL_UINT8_MESSAGE(static_cast<uint8_t>(expected.type), static_cast<uint8_t>(recognized[i].gesture.type), message);
+            TEST_ASSERT_EQUAL_UINT8_MESSAGE(static_cast<uint8_t>(expected.buttons), static_cast<uint8_t>(recognized[i].gesture.buttons), message);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.completed_by, recognized[i].completed_by, message);
+        }
+    }
+
+    // Live replay: the consumer task feeds every event to the recognizer as menu::wait_for_event does
+    std::mutex live_mutex;
+    std::vector<Recognized> live_gestures;
+    size_t live_events = 0;
+
+    void consumer_task(void* param) {
+        events::enable_events();
+        while (true) {
+            events::Event ev = events::get_next_event(100);
+            if (ev.type == EventType::NONE) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(live_mutex);
+            events::Event gesture;
+            if (gestures::recognize(ev, gesture)) {
+                live_gestures.push_back({gesture.gesture_event, live_events});
+            }
+            live_events++;
+        }
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_recorded_traces() {
+    for (const Trace& trace : traces) {
+        std::vector<Recognized> recognized;
+        for (size_t i = 0; i < trace.entry_count; i++) {
+            events::Event gesture;
+            if (gestures::recognize(to_event(trace.entries[i]), gesture)) {
+                TEST_ASSERT_EQUAL_UINT64(trace.entries[i].timestamp, gesture.gesture_event.timestamp);
+                recognized.push_back({gesture.gesture_event, i});
+            }
+        }
+        check_gestures(trace, recognized);
+    }
+}
+
+void test_live_replay() {
+    xTaskCreate(consumer_task, "EventConsumer", 4096, nullptr, 1, nullptr);
+    for (auto pin : {A_PIN, B_PIN, UP_PIN, DOWN_PIN, LEFT_PIN, RIGHT_PIN}) {
+        sim::set_pin_level(pin, HIGH);
+    }
+    sim::sleep_until_us(sim::now_us() + DEBOUNCE_DELAY_US + 200000);
+    for (size_t s = 0; s < std::size(scripts); s++) {
+        {
+            std::lock_guard<std::mutex> lock(live_mutex);
+            live_gestures.clear();
+            live_events = 0;
+        }
+        uint64_t start_us = sim::now_us();
+        for (const Step& step : scripts[s].steps) {
+            sim::sleep_until_us(start_us + step.at_ms * 1000ULL);
+            sim::set_pin_level(step.pin, step.down ? LOW : HIGH);
+        }
+        sim::sleep_until_us(sim::now_us() + 1000000); // Longer than DOUBLE_PRESS_US, the scripts stay apart
+        std::lock_guard<std::mutex> lock(live_mutex);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(traces[s].entry_count, live_events, scripts[s].name);
+        check_gestures(traces[s], live_gestures);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_recorded_traces);
+    RUN_TEST(test_live_replay);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "sim.hpp"
+#include "constants.hpp"
+#include "core/events.hpp"
+#include "core/framebuffer.hpp"
+#include "core/history.hpp"
+#include "core/menu.hpp"
+#include "core/timekeeper.hpp"
+
+// Fills the history with 30 days of records, one a minute as the data log adds them, timing history::add, then
+// times the temperature chart at every zoom and checks that a panned window is drawn from a ring that still holds it
+
+namespace apps::temperature {
+    extern size_t chart_zoom;
+    extern uint32_t pan_s;
+    extern history::Bucket chart_columns[];
+    void draw_chart(Adafruit_SSD1306& display);
+    void chart_app(const events::Event& ev);
+}
+
+namespace {
+    constexpr uint32_t days = 30;
+    constexpr uint32_t record_interval_s = 60;
+    constexpr uint32_t frames = 200;
+    constexpr uint32_t spans_s[] = {2 * 3600, 12 * 3600, 2 * 86400, 8 * 86400, 30 * 86400, 120 * 86400};
+    constexpr size_t zoom_count = sizeof(spans_s) / sizeof(spans_s[0]);
+    constexpr uint32_t day_retention_s = 128 * 86400;
+
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+
+    double elapsed_ns(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Columns of the last chart drawn with at least one sample
+    int16_t filled_columns() {
+        int16_t filled = 0;
+        for (int16_t column = 0; column < static_cast<int16_t>(SCREEN_WIDTH); ++column) {
+            filled += apps::temperature::chart_columns[column].count > 0;
+        }
+        return filled;
+    }
+
+    void press(events::Button button) {
+        events::Event ev = {};
+        ev.type = events::EventType::BUTTON_PRESS;
+        ev.button_press_event.button = button;
+        apps::temperature::chart_app(ev);
+    }
+
+    // Pans back until the chart stops moving, or gives up after far more steps than a 128 day ring takes
+    void pan_to_oldest() {
+        for (int step = 0; step < 10000; ++step) {
+            uint32_t previous = apps::temperature::pan_s;
+            press(events::Button::LEFT);
+            if (apps::temperature::pan_s == previous) {
+                return;
+            }
+        }
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_insert() {
+    uint32_t now_s = static_cast<uint32_t>(timekeeper::rtc_s());
+    TEST_ASSERT_TRUE(now_s != 0);
+    uint32_t count = days * 86400 / record_interval_s;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; ++i) {
+        datalog::Record record = {};
+        record.sequence = i;
+        record.time_s = now_s - days * 86400 + i * record_interval_s;
+        record.internal_cc = static_cast<int16_t>(3000 + (i % 1440) - 720); // A daily swing
+        record.external_cc = static_cast<int16_t>(2000 + (i % 720));
+        record.battery_mv = static_cast<uint16_t>(4200 - i / 100);
+        history::add(record);
+    }
+    double ns = elapsed_ns(start);
+    char message[80];
+    snprintf(message, sizeof(message), "history::add: %.0f ns per record over %u records", ns / count, static_cast<unsigned>(count));
+    TEST_MESSAGE(message);
+    uint32_t hour_s = now_s - now_s % 3600;
+    history::Bucket day = history::get(history::Resolution::HOUR, history::Channel::INTERNAL_TEMPERATURE, hour_s - 86400, hour_s);
+    TEST_ASSERT_EQUAL_UINT32(1440, day.count);
+    TEST_ASSERT_EQUAL_INT(3000 - 720, day.min);
+    TEST_ASSERT_EQUAL_INT(3000 + 719, day.max);
+}
+
+void test_chart_time() {
+    for (size_t zoom = 0; zoom < zoom_count; ++zoom) {
+        apps::temperature::chart_zoom = zoom;
+        apps::temperature::pan_s = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            apps::temperature::draw_chart(display);
+        }
+        double ns = elapsed_ns(start);
+        char message[64];
+        snprintf(message, sizeof(message), "draw_chart zoom %u: %.1f us per frame, %d columns", static_cast<unsigned>(zoom),
+            ns / frames / 1000, filled_columns());
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(filled_columns() > 0);
+    }
+}
+
+void test_panned_window() {
+    // 12 hours three days back, out of the 2 hours of the minute ring the span alone would pick
+    apps::temperature::chart_zoom = 1;
+    apps::temperature::pan_s = 3 * 86400;
+    apps::temperature::draw_chart(display);
+    TEST_ASSERT_EQUAL_INT(SCREEN_WIDTH, filled_columns());
+
+    // 2 days, 10 days back, past the 8 days of the hour ring
+    apps::temperature::chart_zoom = 2;
+    apps::temperature::pan_s = 10 * 86400;
+    apps::temperature::draw_chart(display);
+    TEST_ASSERT_EQUAL_INT(SCREEN_WIDTH, filled_columns());
+}
+
+void test_pan_clamped() {
+    // The window can start as far back as the oldest day bucket and no further
+    for (size_t zoom = 0; zoom < zoom_count; ++zoom) {
+        apps::temperature::chart_zoom = zoom;
+        apps::temperature::pan_s = 0;
+        pan_to_oldest();
+        TEST_ASSERT_EQUAL_UINT32(day_retention_s - spans_s[zoom], apps::temperature::pan_s);
+    }
+    // Zooming out keeps it there
+    apps::temperature::chart_zoom = 4;
+    apps::temperature::pan_s = 0;
+    pan_to_oldest();
+    press(events::Button::DOWN);
+    TEST_ASSERT_EQUAL_UINT32(day_retention_s - spans_s[5], apps::temperature::pan_s);
+}
+
+int main(int argc, char** argv) {
+    sim::set_rtc_us(1760000000LL * 1000000);
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    framebuffer::init();
+    menu::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_insert);
+    RUN_TEST(test_chart_time);
+    RUN_TEST(test_panned_window);
+    RUN_TEST(test_pan_clamped);
+    return UNITY_END();
+}
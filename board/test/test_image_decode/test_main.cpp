@@ -0,0 +1,171 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "constants.hpp"
+#include "core/image.hpp"
+#include "images/logo.hpp"
+#include "images/deepsleep.hpp"
+#include "images/playing_music.hpp"
+#include "images/pet_happy.hpp"
+
+// Decodes what the PackBits coder of gen_images.py produced and checks it against the original rows, then times
+// the decoder and the blit the apps use for the animations
+
+namespace {
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+
+    // scripts/packbits.py applied to the rows built by the matching fill_* function
+    constexpr uint8_t packed_runs[] = {
+        0x81, 0xff, 0xb9, 0xff, 0xc9, 0x00,
+    };
+    constexpr uint8_t packed_literals[] = {
+        0x7f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+        0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e,
+        0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e,
+        0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+        0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e,
+        0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
+        0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e,
+        0x7f, 0x7f, 0x80, 0x81, 0x55, 0x55, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+        0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+        0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+        0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+        0x7a, 0x7b,
+    };
+    constexpr uint8_t packed_mixed[] = {
+        0x01, 0x01, 0x02, 0xfd, 0x03, 0x02, 0x04, 0x05, 0x05, 0xfe, 0x06, 0x00, 0x07, 0xfe, 0xaa, 0x0a,
+        0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+    };
+
+    // Runs longer than the 128 bytes one header can repeat
+    void fill_runs(uint8_t* row) {
+        memset(row, 0xff, 200);
+        memset(row + 200, 0x00, 56);
+    }
+
+    // Literals longer than the 128 bytes one header can copy, around a run too short to be coded as a run
+    void fill_literals(uint8_t* row) {
+        for (size_t i = 0; i < 130; i++) {
+            row[i] = static_cast<uint8_t>(i);
+        }
+        row[130] = 0x55;
+        row[131] = 0x55;
+        for (size_t i = 0; i < 124; i++) {
+            row[132 + i] = static_cast<uint8_t>(i);
+        }
+    }
+
+    constexpr uint8_t mixed_row[] = {
+        0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0xaa, 0xaa, 0xaa,
+        0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+    };
+
+    struct Image {
+        const char* name;
+        const image::PackedImage& packed;
+        const uint8_t* raw; // The same image unpacked, gen_images.py writes both
+    };
+
+    const Image images_to_check[] = {
+        {"logo", images::logo_packed, images::logo},
+        {"deepsleep", images::deepsleep_packed, images::deepsleep},
+        {"playing_music", images::playing_music_packed, images::playing_music},
+        {"pet_happy", images::pet_happy_packed, images::pet_happy},
+    };
+
+    void check_decode(const uint8_t* packed, size_t packed_size, const uint8_t* expected, size_t row_size) {
+        uint8_t row[256];
+        image::RowDecoder decoder = {packed, row_size};
+        image::decode_rows(decoder, row, 1);
+        TEST_ASSERT_EQUAL_MEMORY(expected, row, row_size);
+        TEST_ASSERT_TRUE(decoder.next == packed + packed_size); // The next row starts right after this one
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_packbits_fixtures() {
+    uint8_t expected[256];
+    fill_runs(expected);
+    check_decode(packed_runs, sizeof(packed_runs), expected, 256);
+    fill_literals(expected);
+    check_decode(packed_literals, sizeof(packed_literals), expected, 256);
+    check_decode(packed_mixed, sizeof(packed_mixed), mixed_row, sizeof(mixed_row));
+}
+
+void test_generated_images() {
+    uint8_t rows[image::MAX_IMAGE_WIDTH / 8];
+    for (const Image& img : images_to_check) {
+        size_t bytes_per_row = img.packed.width / 8;
+        auto decoder = image::seek_row(img.packed, 0);
+        for (size_t y = 0; y < img.packed.height; y++) {
+            image::decode_rows(decoder, rows, 1);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(img.raw + y * bytes_per_row, rows, bytes_per_row, img.name);
+            // Seeking straight to the row gives the same row
+            auto seeked = image::seek_row(img.packed, y);
+            image::decode_rows(seeked, rows, 1);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(img.raw + y * bytes_per_row, rows, bytes_per_row, img.name);
+        }
+    }
+}
+
+void test_too_wide_image() {
+    // Only the first band is looked at before the width check
+    constexpr uint16_t bands[] = {0};
+    constexpr uint8_t data[] = {0x81, 0xff};
+    const image::PackedImage wide = {data, bands, 2 * image::MAX_IMAGE_WIDTH, SCREEN_HEIGHT};
+    memset(display.getBuffer(), 0xff, SCREEN_WIDTH * SCREEN_HEIGHT / 8);
+    image::blit_image(wide, 0, 0, display);
+    uint8_t cleared[SCREEN_WIDTH * SCREEN_HEIGHT / 8] = {};
+    TEST_ASSERT_EQUAL_MEMORY(cleared, display.getBuffer(), sizeof(cleared));
+    TEST_ASSERT_TRUE(image::seek_row(wide, 5).next == data);
+}
+
+void test_decode_benchmark() {
+    constexpr size_t rounds = 200;
+    const image::PackedImage& pet = images::pet_happy_packed;
+    uint8_t rows[8 * image::MAX_IMAGE_WIDTH / 8];
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; round++) {
+        auto decoder = image::seek_row(pet, 0);
+        for (size_t y = 0; y < pet.height; y += 8) {
+            image::decode_rows(decoder, rows, 8);
+        }
+    }
+    std::chrono::duration<double, std::micro> decode = std::chrono::steady_clock::now() - start;
+
+    // The pet animation blits one 128 pixel wide frame of the sprite sheet at a time
+    start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; round++) {
+        image::blit_image(pet, (round % (pet.width / SCREEN_WIDTH)) * SCREEN_WIDTH, 0, display);
+    }
+    std::chrono::duration<double, std::micro> blit = std::chrono::steady_clock::now() - start;
+
+    double image_bytes = static_cast<double>(pet.width / 8 * pet.height);
+    char message[128];
+    snprintf(message, sizeof(message), "pet_happy %ux%u: decode %.1f us (%.0f MB/s), blit_image %.1f us per frame",
+        static_cast<unsigned>(pet.width), static_cast<unsigned>(pet.height), decode.count() / rounds,
+        image_bytes * rounds / decode.count(), blit.count() / rounds);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv) {
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    UNITY_BEGIN();
+    RUN_TEST(test_packbits_fixtures);
+    RUN_TEST(test_generated_images);
+    RUN_TEST(test_too_wide_image);
+    RUN_TEST(test_decode_benchmark);
+    return UNITY_END();
+}
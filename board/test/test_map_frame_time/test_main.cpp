@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "constants.hpp"
+#include "core/tilemap.hpp"
+
+// Host frame time of the map at each zoom level: the page blit from the tile store against the drawPixel() loop
+// the map app used before, which read every pixel of the screen from the whole decoded map
+
+namespace {
+    constexpr size_t positions = 64; // Grid of viewports per level, including unaligned and wrapping ones
+    constexpr size_t rounds = 20;
+
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+
+    struct Level {
+        size_t width;
+        size_t height;
+        std::vector<uint8_t> rows; // 1bpp by rows, leftmost pixel in the MSB, as the map was stored before
+    };
+
+    bool buffer_pixel(const uint8_t* buffer, size_t x, size_t y) {
+        return buffer[(y / 8) * SCREEN_WIDTH + x] & (1 << (y % 8));
+    }
+
+    // Rebuilds the whole level from screen-sized viewports, the level sizes are multiples of the screen size
+    Level decode_level(size_t level) {
+        Level result{tilemap::level_width(level), tilemap::level_height(level), {}};
+        result.rows.assign(result.width / 8 * result.height, 0);
+        for (size_t top = 0; top < result.height; top += SCREEN_HEIGHT) {
+            for (size_t left = 0; left < result.width; left += SCREEN_WIDTH) {
+                tilemap::blit_viewport(level, left, top, display);
+                for (size_t y = 0; y < static_cast<size_t>(SCREEN_HEIGHT); y++) {
+                    for (size_t x = 0; x < static_cast<size_t>(SCREEN_WIDTH); x++) {
+                        if (buffer_pixel(display.getBuffer(), x, y)) {
+                            result.rows[(top + y) * (result.width / 8) + (left + x) / 8] |= 0x80 >> ((left + x) % 8);
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    struct Viewport {
+        size_t x;
+        size_t y;
+        size_t cursor_x;
+        size_t cursor_y;
+    };
+
+    Viewport viewport(const Level& level, size_t i) {
+        size_t x = (i * 37) % level.width;
+        size_t y = (i * 11) % (level.height - SCREEN_HEIGHT + 1);
+        return {x, y, (x + SCREEN_WIDTH / 2) % level.width, y + SCREEN_HEIGHT / 2};
+    }
+
+    // The renderer replaced by the blit, kept here as the reference
+    void draw_pixels(const Level& level, const Viewport& view) {
+        for (size_t x = 0; x < static_cast<size_t>(SCREEN_WIDTH); x++) {
+            for (size_t y = 0; y < static_cast<size_t>(SCREEN_HEIGHT); y++) {
+                size_t map_x = (view.x + x) % level.width;
+                size_t map_y = view.y + y;
+                bool pixel = level.rows[map_y * (level.width / 8) + map_x / 8] & (0x80 >> (map_x % 8));
+                if (map_x == view.cursor_x || map_y == view.cursor_y) {
+                    pixel = !pixel; // Invert color for crosshair
+                }
+                display.drawPixel(x, y, pixel ? SSD1306_WHITE : SSD1306_BLACK);
+            }
+        }
+    }
+
+    // Same steps as apps::map::draw
+    void draw_blit(size_t level, const Level& props, const Viewport& view) {
+        tilemap::blit_viewport(level, view.x, view.y, display);
+        int16_t cursor_x = static_cast<int16_t>((view.cursor_x + props.width - view.x) % props.width);
+        int16_t cursor_y = static_cast<int16_t>(view.cursor_y - view.y);
+        display.drawFastHLine(0, cursor_y, SCREEN_WIDTH, SSD1306_INVERSE);
+        display.drawFastVLine(cursor_x, 0, SCREEN_HEIGHT, SSD1306_INVERSE);
+        display.drawPixel(cursor_x, cursor_y, SSD1306_INVERSE);
+    }
+
+    template <typename Draw>
+    double frame_time_us(Draw draw) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < rounds; round++) {
+            for (size_t i = 0; i < positions; i++) {
+                draw(i);
+            }
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (rounds * positions);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_same_frames() {
+    TEST_ASSERT_EQUAL_UINT32(3, tilemap::level_count()); // World, continent and country
+    uint8_t expected[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+    for (size_t level = 0; level < tilemap::level_count(); level++) {
+        Level props = decode_level(level);
+        for (size_t i = 0; i < positions; i++) {
+            Viewport view = viewport(props, i);
+            draw_pixels(props, view);
+            memcpy(expected, display.getBuffer(), sizeof(expected));
+            draw_blit(level, props, view);
+            TEST_ASSERT_EQUAL_MEMORY(expected, display.getBuffer(), sizeof(expected));
+        }
+    }
+}
+
+void test_frame_time() {
+    for (size_t level = 0; level < tilemap::level_count(); level++) {
+        Level props = decode_level(level);
+        double pixels_us = frame_time_us([&](size_t i) { draw_pixels(props, viewport(props, i)); });
+        double blit_us = frame_time_us([&](size_t i) { draw_blit(level, props, viewport(props, i)); });
+        char message[96];
+        snprintf(message, sizeof(message), "level %u (%ux%u): drawPixel %.1f us, blit %.1f us per frame",
+            static_cast<unsigned>(level), static_cast<unsigned>(props.width), static_cast<unsigned>(props.height),
+            pixels_us, blit_us);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(blit_us < pixels_us);
+    }
+}
+
+int main(int argc, char** argv) {
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    tilemap::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_same_frames);
+    RUN_TEST(test_frame_time);
+    return UNITY_END();
+}
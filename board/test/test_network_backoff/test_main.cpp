@@ -0,0 +1,243 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <unity.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "sim.hpp"
+#include "core/menu.hpp"
+#include "core/network.hpp"
+#include "core/timekeeper.hpp"
+#include "apps/settings.hpp"
+#include "constants.hpp"
+
+// Checks the jittered backoff on its own, then runs the network scheduler with a job that is always due against an
+// access point that is not there: the connection attempts space out within the backoff bounds, the radio-on time
+// per hour stays small, the backoff resets once the access point is back and no window opens on a low battery. Last,
+// the NTP job syncs the clock and comes due again NTP_RESYNC_INTERVAL_MS later.
+
+namespace network {
+    extern Backoff connect_backoff;
+    extern uint64_t connect_retry_at_ms;
+}
+
+namespace timekeeper {
+    uint64_t ntp_due_in_ms();
+}
+
+namespace {
+    constexpr double speed = 500; // A simulated hour in 7.2 s
+    constexpr uint32_t checked_failures = 5;
+    // WiFi.begin() fails 1.5 s after the call in the simulation, seen at the next 500 ms poll
+    constexpr uint64_t min_attempt_ms = 1500;
+    constexpr uint64_t max_attempt_ms = 2000;
+    constexpr uint64_t late_wake_up_ms = 1000; // Host scheduling slack at this speed
+    constexpr uint64_t hour_ms = 3600 * 1000;
+    // Attempts in the first hour if every delay is the shortest allowed, 1.5 s each
+    constexpr uint32_t max_attempts_per_hour = 11;
+    // analogRead() values of the battery behind the divider
+    constexpr uint16_t battery_3v9 = 2420;
+    constexpr uint16_t battery_3v45 = 2140;
+    constexpr double resync_speed = 10000; // 12 simulated hours in 4.3 s
+    constexpr uint64_t window_ms = 60000; // Enough for a connection and a sync, also covers the host slack at resync_speed
+
+    uint64_t start_ms = 0;
+    std::atomic<bool> job_pending{true};
+    std::atomic<uint32_t> job_runs{0};
+
+    uint64_t job_due_in_ms() {
+        return job_pending ? 0 : UINT64_MAX;
+    }
+
+    bool job_run() {
+        job_runs++;
+        job_pending = false;
+        return true;
+    }
+
+    uint64_t now_ms() {
+        return timekeeper::now_us() / 1000;
+    }
+
+    uint64_t delay_cap_ms(uint32_t failures) {
+        return failures < 32 && (NETWORK_BACKOFF_BASE_MS << failures) < NETWORK_BACKOFF_CAP_MS
+            ? NETWORK_BACKOFF_BASE_MS << failures : NETWORK_BACKOFF_CAP_MS;
+    }
+
+    // Waits up to timeout_ms of simulated time for the scheduler to set a new connection retry time, returns it or 0
+    uint64_t next_retry_at_ms(uint64_t previous, uint64_t timeout_ms) {
+        uint64_t deadline = now_ms() + timeout_ms;
+        while (now_ms() < deadline) {
+            uint64_t retry_at = network::connect_retry_at_ms;
+            if (retry_at != previous) {
+                return retry_at;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return 0;
+    }
+
+    // Waits up to timeout_ms of simulated time for a connection to succeed, returns false on timeout
+    bool wait_for_connection(uint64_t timeout_ms) {
+        uint64_t deadline = now_ms() + timeout_ms;
+        while (now_ms() < deadline) {
+            if (network::connect_backoff.failures == 0) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return false;
+    }
+
+    // Lets the simulated clock run for duration_ms
+    void run_for_ms(uint64_t duration_ms) {
+        sim::sleep_until_us(sim::now_us() + duration_ms * 1000);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_backoff_bounds() {
+    // Half to all of the base doubled per failure, capped, for any count of failures in a row
+    for (uint32_t failures = 0; failures < 40; ++failures) {
+        uint64_t cap = delay_cap_ms(failures);
+        uint64_t shortest = UINT64_MAX, longest = 0;
+        for (int draw = 0; draw < 200; ++draw) {
+            network::Backoff backoff = {failures};
+            uint64_t delay = backoff.failed();
+            TEST_ASSERT_EQUAL_UINT32(failures + 1, backoff.failures);
+            TEST_ASSERT_GREATER_OR_EQUAL_UINT64(cap / 2, delay);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT64(cap, delay);
+            shortest = delay < shortest ? delay : shortest;
+            longest = delay > longest ? delay : longest;
+        }
+        TEST_ASSERT_TRUE_MESSAGE(longest - shortest > cap / 4, "the delays are not spread out");
+    }
+    TEST_ASSERT_EQUAL_UINT64(NETWORK_BACKOFF_CAP_MS, delay_cap_ms(8)); // As constants.hpp says
+
+    // A success starts over from the base
+    network::Backoff backoff = {0};
+    for (int i = 0; i < 6; ++i) {
+        backoff.failed();
+    }
+    backoff.succeeded();
+    TEST_ASSERT_EQUAL_UINT32(0, backoff.failures);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(NETWORK_BACKOFF_BASE_MS, backoff.failed());
+}
+
+void test_connect_backoff() {
+    // The job is due right away. An attempt starts once the previous retry time is reached and the next one is set
+    // when it fails, so the retry times are one delay and one attempt apart.
+    start_ms = now_ms();
+    network::init();
+    network::add_job({"test", job_due_in_ms, job_run});
+    uint64_t previous = start_ms;
+    for (uint32_t failures = 0; failures < checked_failures; ++failures) {
+        uint64_t retry_at = next_retry_at_ms(network::connect_retry_at_ms, delay_cap_ms(failures) + 60000);
+        TEST_ASSERT_TRUE_MESSAGE(retry_at != 0, "no connection attempt");
+        TEST_ASSERT_EQUAL_UINT32(failures + 1, network::connect_backoff.failures);
+        uint64_t gap = retry_at - previous;
+        char message[80];
+        snprintf(message, sizeof(message), "failure %u: next attempt %.1f s later", static_cast<unsigned>(failures + 1), gap / 1000.0);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT64(delay_cap_ms(failures) / 2 + min_attempt_ms, gap);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT64(delay_cap_ms(failures) + max_attempt_ms + late_wake_up_ms, gap);
+        TEST_ASSERT_EQUAL_UINT32(0, job_runs);
+        previous = retry_at;
+    }
+}
+
+void test_radio_on_per_hour() {
+    // Still no access point, the radio is only on for the attempts
+    uint64_t elapsed = now_ms() - start_ms;
+    if (elapsed < hour_ms) {
+        run_for_ms(hour_ms - elapsed);
+    }
+    uint64_t radio_on_ms = sim::wifi_radio_on_us() / 1000;
+    uint32_t attempts = network::connect_backoff.failures;
+    char message[96];
+    snprintf(message, sizeof(message), "radio on %llu ms in the first hour without an access point, %u attempts",
+        static_cast<unsigned long long>(radio_on_ms), static_cast<unsigned>(attempts));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(max_attempts_per_hour, attempts);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(attempts * (max_attempt_ms + late_wake_up_ms), radio_on_ms);
+}
+
+void test_reset_on_success() {
+    // The next attempt, at the latest after the longest delay, connects and runs the job
+    sim::set_wifi_available(true);
+    TEST_ASSERT_TRUE_MESSAGE(wait_for_connection(NETWORK_BACKOFF_CAP_MS + 60000), "no connection");
+    TEST_ASSERT_EQUAL_UINT64(0, network::connect_retry_at_ms);
+    run_for_ms(1000); // The window runs the job after the connection
+    TEST_ASSERT_EQUAL_UINT32(1, job_runs);
+    TEST_ASSERT_EQUAL_INT(WIFI_OFF, WiFi.getMode());
+}
+
+void test_low_battery_skip() {
+    sim::set_analog_value(BAT_PIN, battery_3v45);
+    uint64_t radio_on_us = sim::wifi_radio_on_us();
+    job_pending = true;
+    network::wake();
+    run_for_ms(60000);
+    TEST_ASSERT_EQUAL_UINT32(1, job_runs);
+    TEST_ASSERT_EQUAL_UINT64(radio_on_us, sim::wifi_radio_on_us());
+
+    // Charged again, the next look at the jobs opens the window
+    sim::set_analog_value(BAT_PIN, battery_3v9);
+    network::wake();
+    run_for_ms(5000);
+    TEST_ASSERT_EQUAL_UINT32(2, job_runs);
+    TEST_ASSERT_TRUE(sim::wifi_radio_on_us() > radio_on_us);
+}
+
+void test_ntp_resync() {
+    // The first window sets the clock
+    timekeeper::add_ntp_job();
+    network::wake();
+    run_for_ms(5000);
+    TEST_ASSERT_TRUE(timekeeper::rtc_s() != 0);
+    uint64_t due_in = timekeeper::ntp_due_in_ms();
+    TEST_ASSERT_UINT64_WITHIN(window_ms, NTP_RESYNC_INTERVAL_MS, due_in);
+
+    // Still synced until the sync gets old, then due again. Without an access point it stays due.
+    sim::set_speed(resync_speed);
+    sim::set_wifi_available(false);
+    uint64_t radio_on_us = sim::wifi_radio_on_us();
+    run_for_ms(due_in - window_ms);
+    TEST_ASSERT_TRUE(timekeeper::ntp_due_in_ms() > 0);
+    TEST_ASSERT_EQUAL_UINT64(radio_on_us, sim::wifi_radio_on_us());
+    run_for_ms(2 * window_ms);
+    TEST_ASSERT_EQUAL_UINT64(0, timekeeper::ntp_due_in_ms());
+    TEST_ASSERT_TRUE(network::connect_backoff.failures > 0);
+
+    // Back in range, the next attempt syncs and the job is NTP_RESYNC_INTERVAL_MS away again
+    sim::set_wifi_available(true);
+    TEST_ASSERT_TRUE_MESSAGE(wait_for_connection(NETWORK_BACKOFF_CAP_MS + window_ms), "no connection");
+    run_for_ms(window_ms);
+    TEST_ASSERT_UINT64_WITHIN(2 * window_ms, NTP_RESYNC_INTERVAL_MS, timekeeper::ntp_due_in_ms());
+    sim::set_speed(speed);
+}
+
+int main(int argc, char** argv) {
+    sim::set_speed(speed);
+    sim::set_analog_value(BAT_PIN, battery_3v9);
+    sim::set_wifi_available(false);
+    apps::settings::Settings settings = apps::settings::get_settings();
+    settings.wifi_enabled = true;
+    settings.wifi_ssid = "ssid";
+    settings.wifi_password = "password";
+    apps::settings::save_settings(settings);
+    menu::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_backoff_bounds);
+    RUN_TEST(test_connect_backoff);
+    RUN_TEST(test_radio_on_per_hour);
+    RUN_TEST(test_reset_on_success);
+    RUN_TEST(test_low_battery_skip);
+    RUN_TEST(test_ntp_resync);
+    return UNITY_END();
+}
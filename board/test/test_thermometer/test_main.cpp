@@ -0,0 +1,100 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#include "sim.hpp"
+#include "core/thermometer.hpp"
+#include "constants.hpp"
+
+// Runs the thermometer task against the simulated DS18B20 sensors and checks that the getters the UI calls return
+// right away even while a conversion is in progress, and that the resolution stays within the 9 to 12 bits the
+// sensor supports
+
+namespace {
+    // A getter waiting on the bus would take at least the 94 ms of a 9 bit conversion
+    constexpr uint64_t max_getter_us = 2000;
+
+    // Simulated time at which sensor 0 publishes a reading newer than after_us, 0 on timeout
+    uint64_t wait_for_reading(uint64_t after_us, uint64_t timeout_us) {
+        uint64_t deadline = sim::now_us() + timeout_us;
+        while (sim::now_us() < deadline) {
+            if (thermometer::get_external(0).timestamp_us > after_us) {
+                return sim::now_us();
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return 0;
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_readings_published() {
+    TEST_ASSERT_TRUE_MESSAGE(wait_for_reading(0, 3000000) != 0, "no reading after the first conversion");
+    TEST_ASSERT_EQUAL_UINT32(2, thermometer::sensor_count());
+    TEST_ASSERT_EQUAL_FLOAT(21.5f, thermometer::get_external(0).celsius);
+    TEST_ASSERT_EQUAL_FLOAT(-3.25f, thermometer::get_external(1).celsius);
+    TEST_ASSERT_TRUE(std::isnan(thermometer::get_external(2).celsius)); // Past the sensors found
+    TEST_ASSERT_EQUAL_FLOAT(35.0f, thermometer::get_internal().celsius);
+}
+
+void test_ui_never_blocks() {
+    // Polls like the temperature app does, for longer than a sample interval so a whole conversion is covered
+    uint64_t start_us = sim::now_us();
+    uint64_t first_timestamp = thermometer::get_external(0).timestamp_us;
+    uint64_t worst_us = 0;
+    uint32_t calls = 0;
+    while (sim::now_us() - start_us < TEMPERATURE_SAMPLE_INTERVAL_MS * 1000 + 1000000) {
+        uint64_t before = sim::now_us();
+        thermometer::get_internal();
+        thermometer::get_external(0);
+        thermometer::sensor_count();
+        uint64_t took = sim::now_us() - before;
+        worst_us = took > worst_us ? took : worst_us;
+        calls++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    char message[80];
+    snprintf(message, sizeof(message), "worst getter time over %u polls: %llu us", static_cast<unsigned>(calls),
+        static_cast<unsigned long long>(worst_us));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE_MESSAGE(thermometer::get_external(0).timestamp_us > first_timestamp,
+        "no conversion ran while polling");
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(max_getter_us, worst_us);
+}
+
+void test_resolution_clamped() {
+    const uint8_t requested[] = {0, 8, 9, 10, 11, 12, 13, 255};
+    const uint8_t expected[] = {9, 9, 9, 10, 11, 12, 12, 12};
+    for (size_t i = 0; i < sizeof(requested); ++i) {
+        thermometer::set_resolution(requested[i]);
+        TEST_ASSERT_EQUAL_UINT8(expected[i], thermometer::get_resolution());
+    }
+
+    // Out of range values reach the sensors clamped, 9 bits reads in steps of 0.5 C
+    thermometer::set_resolution(2);
+    sim::set_external_temperature(21.3f, 0);
+    TEST_ASSERT_TRUE(wait_for_reading(sim::now_us(), TEMPERATURE_SAMPLE_INTERVAL_MS * 1000 + 1000000) != 0);
+    TEST_ASSERT_EQUAL_FLOAT(21.0f, thermometer::get_external(0).celsius);
+
+    thermometer::set_resolution(40);
+    TEST_ASSERT_TRUE(wait_for_reading(sim::now_us(), TEMPERATURE_SAMPLE_INTERVAL_MS * 1000 + 1000000) != 0);
+    TEST_ASSERT_EQUAL_FLOAT(21.25f, thermometer::get_external(0).celsius); // 12 bits, steps of 0.0625 C
+}
+
+int main(int argc, char** argv) {
+    sim::set_external_sensor_count(2);
+    sim::set_external_temperature(21.5f, 0);
+    sim::set_external_temperature(-3.25f, 1);
+    thermometer::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_readings_published);
+    RUN_TEST(test_ui_never_blocks);
+    RUN_TEST(test_resolution_clamped);
+    return UNITY_END();
+}
@@ -0,0 +1,94 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "sim.hpp"
+#include "constants.hpp"
+#include "core/tilemap.hpp"
+#include "maps/earth.hpp"
+
+// Host time to compose a map viewport from the tile store, with the tiles already in the cache and with every
+// frame fetching and decoding its tiles, from the built-in levels and from the "maps" partition
+
+namespace {
+    constexpr size_t frames = 600;
+
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+
+    // Frame i of a pan along the equator of the largest level, one navigation step of 8 pixels at a time
+    void pan_frame(size_t i) {
+        size_t level = tilemap::level_count() - 1;
+        size_t y = (tilemap::level_height(level) - SCREEN_HEIGHT) / 2;
+        tilemap::blit_viewport(level, (i * 8) % tilemap::level_width(level), y, display);
+    }
+
+    // Same viewport every frame, all its tiles stay cached
+    void cached_frame(size_t i) {
+        tilemap::blit_viewport(tilemap::level_count() - 1, 40, 20, display);
+    }
+
+    // Alternates the two largest levels, 6 + 6 tiles do not fit in the 8 cache slots so every frame decodes
+    void uncached_frame(size_t i) {
+        size_t level = tilemap::level_count() - 1 - i % 2;
+        tilemap::blit_viewport(level, 40, 20, display);
+    }
+
+    double frame_time_us(void (*frame)(size_t)) {
+        frame(0); // Not counted, fills the cache for the cached case
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < frames; i++) {
+            frame(i);
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / frames;
+    }
+
+    void report(const char* source) {
+        double cached_us = frame_time_us(cached_frame);
+        double pan_us = frame_time_us(pan_frame);
+        double uncached_us = frame_time_us(uncached_frame);
+        char message[128];
+        snprintf(message, sizeof(message), "%s: cached %.1f us, panning %.1f us, decoding every frame %.1f us",
+            source, cached_us, pan_us, uncached_us);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(cached_us < uncached_us);
+        TEST_ASSERT_TRUE(pan_us < uncached_us); // Panning decodes a new column of tiles once every 8 steps
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_builtin_levels() {
+    tilemap::init();
+    TEST_ASSERT_EQUAL_UINT32(3, tilemap::level_count());
+    report("built-in");
+}
+
+void test_partition_levels() {
+    // The built-in store written to a file backs the partition, so both runs decode the same tiles
+    std::string path = (std::filesystem::temp_directory_path() / "test_tile_fetch_maps.bin").string();
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(maps::earth), sizeof(maps::earth));
+    }
+    TEST_ASSERT_TRUE(sim::set_partition_file("maps", path.c_str()));
+    tilemap::init();
+    TEST_ASSERT_EQUAL_UINT32(3, tilemap::level_count());
+    report("maps partition");
+    std::filesystem::remove(path);
+}
+
+int main(int argc, char** argv) {
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    UNITY_BEGIN();
+    RUN_TEST(test_builtin_levels);
+    RUN_TEST(test_partition_levels);
+    return UNITY_END();
+}
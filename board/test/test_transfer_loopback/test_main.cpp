@@ -0,0 +1,252 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <cstring>
+#include <esp_partition.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <vector>
+
+#include "sim.hpp"
+#include "core/datalog.hpp"
+#include "core/logger.hpp"
+#include "core/transfer.hpp"
+
+// Talks to the export protocol through the pseudo terminal behind the simulated Serial, the way
+// scripts/export_log.py does: requests HELLO and READ frames over a file backed data log, checks every CRC against
+// CRC-16/X-25 computed here, resumes from the END offset and sends requests that must be refused
+
+namespace datalog {
+    extern uint32_t batch_size;
+    bool open_log();
+    void add_record(const Record& sample);
+}
+
+namespace {
+    constexpr uint32_t record_count = 100; // 6 batches in flash, 4 records still in the batch
+    constexpr int reply_timeout_ms = 2000;
+    char partition_path[] = "/tmp/transfer_XXXXXX";
+    int port = -1;
+
+    struct Frame {
+        transfer::FrameType type;
+        std::vector<uint8_t> payload;
+    };
+
+    // CRC-16/X-25 bit by bit, as in the protocol description, independent of the ROM function the firmware uses
+    uint16_t crc16_x25(const uint8_t* data, size_t length) {
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i < length; ++i) {
+            crc ^= data[i];
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+            }
+        }
+        return crc ^ 0xFFFF;
+    }
+
+    void send(uint8_t type, const std::vector<uint8_t>& payload, bool corrupt_crc = false) {
+        std::vector<uint8_t> bytes = {0xA5, type, static_cast<uint8_t>(payload.size() & 0xFF), static_cast<uint8_t>(payload.size() >> 8)};
+        bytes.insert(bytes.end(), payload.begin(), payload.end());
+        uint16_t crc = crc16_x25(bytes.data() + 1, bytes.size() - 1) ^ (corrupt_crc ? 1 : 0);
+        bytes.push_back(crc & 0xFF);
+        bytes.push_back(crc >> 8);
+        TEST_ASSERT_EQUAL_INT(static_cast<int>(bytes.size()), static_cast<int>(write(port, bytes.data(), bytes.size())));
+    }
+
+    void send_read(uint8_t stream, uint32_t first, uint32_t count) {
+        std::vector<uint8_t> payload(9);
+        payload[0] = stream;
+        memcpy(&payload[1], &first, 4);
+        memcpy(&payload[5], &count, 4);
+        send(static_cast<uint8_t>(transfer::FrameType::READ), payload);
+    }
+
+    std::vector<uint8_t> received;
+
+    // Next frame with a valid CRC, skipping the logger text around it. Returns false on timeout.
+    bool receive(Frame& frame) {
+        while (true) {
+            while (!received.empty() && received[0] != 0xA5) {
+                received.erase(received.begin());
+            }
+            if (received.size() >= 4) {
+                size_t length = received[2] | (received[3] << 8);
+                if (received.size() >= 4 + length + 2) {
+                    uint16_t crc = received[4 + length] | (received[4 + length + 1] << 8);
+                    if (crc == crc16_x25(received.data() + 1, 3 + length)) {
+                        frame.type = static_cast<transfer::FrameType>(received[1]);
+                        frame.payload.assign(received.begin() + 4, received.begin() + 4 + length);
+                        received.erase(received.begin(), received.begin() + 4 + length + 2);
+                        return true;
+                    }
+                    received.erase(received.begin()); // A 0xA5 in the text, not a frame
+                    continue;
+                }
+            }
+            pollfd descriptor = {port, POLLIN, 0};
+            if (poll(&descriptor, 1, reply_timeout_ms) <= 0) {
+                return false;
+            }
+            uint8_t buffer[256];
+            ssize_t count = read(port, buffer, sizeof(buffer));
+            if (count > 0) {
+                received.insert(received.end(), buffer, buffer + count);
+            }
+        }
+    }
+
+    uint32_t payload_u32(const Frame& frame, size_t offset) {
+        uint32_t value;
+        memcpy(&value, frame.payload.data() + offset, sizeof(value));
+        return value;
+    }
+
+    datalog::Record sample_for(uint32_t sequence) {
+        datalog::Record sample = {};
+        sample.time_s = 1760000000 + sequence * 60;
+        sample.internal_cc = static_cast<int16_t>(2500 + sequence);
+        sample.external_cc = static_cast<int16_t>(-100 - static_cast<int32_t>(sequence));
+        sample.battery_mv = static_cast<uint16_t>(4000 - sequence);
+        return sample;
+    }
+
+    // Reads entries of the record stream until END, checking that they come in order from expected_first.
+    // Returns the next offset of the END frame.
+    uint32_t read_records(uint32_t first, uint32_t count, uint32_t expected_first, uint32_t& entries_received) {
+        send_read(static_cast<uint8_t>(transfer::Stream::RECORDS), first, count);
+        uint32_t next = expected_first;
+        entries_received = 0;
+        Frame frame;
+        while (true) {
+            TEST_ASSERT_TRUE_MESSAGE(receive(frame), "no reply to READ");
+            if (frame.type == transfer::FrameType::END) {
+                TEST_ASSERT_EQUAL_UINT32(5, frame.payload.size());
+                TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(transfer::Stream::RECORDS), frame.payload[0]);
+                return payload_u32(frame, 1);
+            }
+            TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(transfer::FrameType::DATA), static_cast<uint8_t>(frame.type));
+            TEST_ASSERT_EQUAL_UINT32(next, payload_u32(frame, 1));
+            TEST_ASSERT_EQUAL_UINT32(0, (frame.payload.size() - 5) % sizeof(datalog::Record));
+            for (size_t offset = 5; offset < frame.payload.size(); offset += sizeof(datalog::Record)) {
+                datalog::Record record;
+                memcpy(&record, frame.payload.data() + offset, sizeof(record));
+                datalog::Record expected = sample_for(next);
+                TEST_ASSERT_EQUAL_UINT32(next, record.sequence);
+                TEST_ASSERT_EQUAL_UINT32(expected.time_s, record.time_s);
+                TEST_ASSERT_EQUAL_INT(expected.internal_cc, record.internal_cc);
+                TEST_ASSERT_EQUAL_INT(expected.external_cc, record.external_cc);
+                TEST_ASSERT_EQUAL_UINT(expected.battery_mv, record.battery_mv);
+                next++;
+                entries_received++;
+            }
+        }
+    }
+
+    void expect_error(transfer::ErrorCode code) {
+        Frame frame;
+        TEST_ASSERT_TRUE_MESSAGE(receive(frame), "no reply to a wrong request");
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(transfer::FrameType::ERROR), static_cast<uint8_t>(frame.type));
+        TEST_ASSERT_EQUAL_UINT32(1, frame.payload.size());
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(code), frame.payload[0]);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_crc() {
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    TEST_ASSERT_EQUAL_UINT(0x906E, crc16_x25(check, sizeof(check))); // The catalogued check value of CRC-16/X-25
+}
+
+void test_hello() {
+    send(static_cast<uint8_t>(transfer::FrameType::HELLO), {});
+    Frame frame;
+    TEST_ASSERT_TRUE_MESSAGE(receive(frame), "no reply to HELLO");
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(transfer::FrameType::INFO), static_cast<uint8_t>(frame.type));
+    TEST_ASSERT_EQUAL_UINT32(2 + 2 * 10, frame.payload.size());
+    TEST_ASSERT_EQUAL_UINT8(transfer::PROTOCOL_VERSION, frame.payload[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, frame.payload[1]);
+    TEST_ASSERT_EQUAL_UINT(sizeof(datalog::Record), frame.payload[2] | (frame.payload[3] << 8));
+    TEST_ASSERT_EQUAL_UINT32(0, payload_u32(frame, 4));
+    TEST_ASSERT_EQUAL_UINT32(record_count, payload_u32(frame, 8));
+}
+
+void test_read_all() {
+    uint32_t entries;
+    TEST_ASSERT_EQUAL_UINT32(record_count, read_records(0, UINT32_MAX, 0, entries));
+    TEST_ASSERT_EQUAL_UINT32(record_count, entries); // Including the ones still in the batch
+}
+
+void test_resume() {
+    // A transfer cut short after entry 39 goes on from the END offset
+    uint32_t entries;
+    uint32_t next = read_records(0, 40, 0, entries);
+    TEST_ASSERT_EQUAL_UINT32(40, next);
+    TEST_ASSERT_EQUAL_UINT32(40, entries);
+    next = read_records(next, 25, next, entries);
+    TEST_ASSERT_EQUAL_UINT32(65, next);
+    TEST_ASSERT_EQUAL_UINT32(25, entries);
+    next = read_records(next, UINT32_MAX, next, entries);
+    TEST_ASSERT_EQUAL_UINT32(record_count, next);
+    TEST_ASSERT_EQUAL_UINT32(record_count - 65, entries);
+
+    // Nothing past the end, the host is told where the stream ends
+    next = read_records(record_count + 50, 10, record_count, entries);
+    TEST_ASSERT_EQUAL_UINT32(record_count, next);
+    TEST_ASSERT_EQUAL_UINT32(0, entries);
+}
+
+void test_bad_request() {
+    // READ with a short payload
+    std::vector<uint8_t> short_read = {static_cast<uint8_t>(transfer::Stream::RECORDS), 0, 0, 0, 0, 1, 0, 0};
+    send(static_cast<uint8_t>(transfer::FrameType::READ), short_read);
+    expect_error(transfer::ErrorCode::BAD_REQUEST);
+    // READ of a stream that does not exist
+    send_read(2, 0, 1);
+    expect_error(transfer::ErrorCode::BAD_REQUEST);
+    // A request type the firmware does not know
+    send(0x05, {});
+    expect_error(transfer::ErrorCode::UNKNOWN_REQUEST);
+    // A request with a wrong CRC gets no answer, the next one does
+    send(static_cast<uint8_t>(transfer::FrameType::HELLO), {}, true);
+    send(static_cast<uint8_t>(transfer::FrameType::HELLO), {});
+    Frame frame;
+    TEST_ASSERT_TRUE(receive(frame));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(transfer::FrameType::INFO), static_cast<uint8_t>(frame.type));
+    TEST_ASSERT_FALSE_MESSAGE(receive(frame), "a request with a wrong CRC was answered");
+}
+
+int main(int argc, char** argv) {
+    int fd = mkstemp(partition_path);
+    std::vector<uint8_t> erased(4 * SPI_FLASH_SEC_SIZE, 0xFF);
+    if (fd < 0 || write(fd, erased.data(), erased.size()) != static_cast<ssize_t>(erased.size())) {
+        return 1;
+    }
+    close(fd);
+    sim::set_partition_file("datalog", partition_path);
+    datalog::open_log();
+    for (uint32_t sequence = 0; sequence < record_count; ++sequence) {
+        datalog::add_record(sample_for(sequence));
+    }
+    const char* pty = sim::open_serial_pty();
+    port = pty != nullptr ? open(pty, O_RDWR | O_NOCTTY) : -1;
+    if (port < 0) {
+        return 1;
+    }
+    logger::init(); // Its text goes through the same port, between the frames
+    transfer::init();
+    UNITY_BEGIN();
+    RUN_TEST(test_crc);
+    RUN_TEST(test_hello);
+    RUN_TEST(test_read_all);
+    RUN_TEST(test_resume);
+    RUN_TEST(test_bad_request);
+    int failures = UNITY_END();
+    close(port);
+    unlink(partition_path);
+    return failures;
+}
@@ -0,0 +1,202 @@
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "sim.hpp"
+#include "core/menu.hpp"
+#include "apps/settings.hpp"
+#include "constants.hpp"
+
+// Runs the weather refresh job against a mock of Nominatim and open-meteo installed with sim::set_http_handler(),
+// counting the requests each refresh makes, the connections they open and the bytes they move
+
+namespace apps::weather {
+    bool refresh_forecasts();
+    uint64_t forecast_due_in_ms();
+    void try_add_weather_job();
+}
+
+namespace {
+    constexpr uint64_t refresh_interval_ms = 3 * 3600 * 1000;
+
+    uint32_t geocode_requests = 0;
+    uint32_t forecast_requests = 0;
+    uint32_t forecast_locations = 0; // In the last forecast request
+
+    const char* nominatim_body = "[{\"place_id\":1,\"lat\":\"51.4826\",\"lon\":\"-0.0077\",\"display_name\":\"Greenwich, London\",\"importance\":0.7}]";
+
+    String hourly_json(int base_temperature) {
+        String time = "[", temperature = "[", code = "[";
+        for (int hour = 0; hour < 48; ++hour) {
+            const char* separator = hour > 0 ? "," : "";
+            time += separator + String(1760000000 + hour * 3600);
+            temperature += separator + String(base_temperature + hour % 5);
+            code += separator + String(hour % 4);
+        }
+        return "{\"latitude\":51.5,\"longitude\":0.0,\"generationtime_ms\":0.1,\"hourly_units\":{\"time\":\"unixtime\"},"
+            "\"hourly\":{\"time\":" + time + "],\"temperature_2m\":" + temperature + "],\"weather_code\":" + code + "]}}";
+    }
+
+    int mock_server(const char* url, String& body) {
+        if (strstr(url, "nominatim.openstreetmap.org") != nullptr) {
+            geocode_requests++;
+            body = nominatim_body;
+            return HTTP_CODE_OK;
+        }
+        if (strstr(url, "api.open-meteo.com") != nullptr) {
+            forecast_requests++;
+            // One location per comma separated latitude, more than one are answered with an array
+            const char* latitudes = strstr(url, "latitude=");
+            forecast_locations = 1;
+            for (const char* c = latitudes; c != nullptr && *c != '&' && *c != '\0'; ++c) {
+                forecast_locations += *c == ',';
+            }
+            if (forecast_locations == 1) {
+                body = hourly_json(12);
+            } else {
+                body = "[";
+                for (uint32_t i = 0; i < forecast_locations; ++i) {
+                    body += (i > 0 ? "," : "") + hourly_json(10 + i);
+                }
+                body += "]";
+            }
+            return HTTP_CODE_OK;
+        }
+        return HTTP_CODE_NOT_FOUND;
+    }
+
+    void set_locations(const char* first, const char* second) {
+        apps::settings::Settings settings = apps::settings::get_settings();
+        for (String& location : settings.locations) {
+            location = "";
+        }
+        settings.locations[0] = first;
+        settings.locations[1] = second;
+        apps::settings::save_settings(settings);
+    }
+
+    struct Counts {
+        uint32_t geocodes;
+        uint32_t forecasts;
+        uint32_t connections;
+        uint64_t bytes;
+    };
+
+    // Requests and connections of one refresh, which must succeed
+    Counts refresh() {
+        uint32_t geocodes = geocode_requests;
+        uint32_t forecasts = forecast_requests;
+        uint32_t connections = HTTPClient::connections_opened();
+        uint64_t bytes = HTTPClient::bytes_transferred();
+        TEST_ASSERT_TRUE_MESSAGE(apps::weather::refresh_forecasts(), "refresh failed");
+        Counts counts = {geocode_requests - geocodes, forecast_requests - forecasts, HTTPClient::connections_opened() - connections,
+            HTTPClient::bytes_transferred() - bytes};
+        char message[112];
+        snprintf(message, sizeof(message), "refresh: %u geocoding, %u forecast requests, %u connections, %llu bytes",
+            static_cast<unsigned>(counts.geocodes), static_cast<unsigned>(counts.forecasts), static_cast<unsigned>(counts.connections),
+            static_cast<unsigned long long>(counts.bytes));
+        TEST_MESSAGE(message);
+        return counts;
+    }
+
+    // One geocoding and one single location forecast request per location, on a connection each, as every refresh
+    // did before the coordinates were cached and the forecasts requested together. URLs left out, so it is a lower
+    // bound of those bytes.
+    Counts per_location_requests(uint32_t locations) {
+        return {locations, locations, 2 * locations, locations * (strlen(nominatim_body) + hourly_json(12).length())};
+    }
+
+    // Drops the coordinates cached in NVS, the only place they are kept between refreshes and reboots
+    void forget_geocode_cache() {
+        Preferences prefs;
+        prefs.begin("geocode", false);
+        prefs.clear();
+        prefs.end();
+    }
+
+    // Every location has a forecast just downloaded, the RTC may have moved on by a second
+    void assert_fresh() {
+        uint64_t due_in_ms = apps::weather::forecast_due_in_ms();
+        TEST_ASSERT_TRUE(due_in_ms <= refresh_interval_ms && due_in_ms >= refresh_interval_ms - 2000);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_first_refresh() {
+    // Each location is geocoded once, then one forecast request covers both
+    set_locations("Greenwich", "Paris");
+    TEST_ASSERT_EQUAL_UINT64(0, apps::weather::forecast_due_in_ms());
+    Counts counts = refresh();
+    TEST_ASSERT_EQUAL_UINT32(2, counts.geocodes);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.forecasts);
+    TEST_ASSERT_EQUAL_UINT32(2, forecast_locations);
+    // HTTP/1.0, every request has its own connection, none is kept open between the hosts or the refreshes
+    TEST_ASSERT_EQUAL_UINT32(counts.geocodes + counts.forecasts, counts.connections);
+    assert_fresh();
+}
+
+void test_cached_refresh() {
+    // The coordinates come from the NVS cache, a refresh is a single request
+    Counts counts = refresh();
+    TEST_ASSERT_EQUAL_UINT32(0, counts.geocodes);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.forecasts);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.connections);
+    Counts before = per_location_requests(2);
+    char message[96];
+    snprintf(message, sizeof(message), "a request of each kind per location: %u connections, at least %llu bytes",
+        static_cast<unsigned>(before.connections), static_cast<unsigned long long>(before.bytes));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(counts.bytes < before.bytes);
+}
+
+void test_cache_survives_restart() {
+    // Nothing about the coordinates is kept in RAM, the refresh above was served by NVS like the first one after a
+    // reboot. Without the NVS entries both locations are looked up again.
+    forget_geocode_cache();
+    Counts counts = refresh();
+    TEST_ASSERT_EQUAL_UINT32(2, counts.geocodes);
+    TEST_ASSERT_EQUAL_UINT32(3, counts.connections);
+    counts = refresh();
+    TEST_ASSERT_EQUAL_UINT32(0, counts.geocodes);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.connections);
+}
+
+void test_location_change() {
+    // Only the changed location is geocoded again, and a single location is answered with an object
+    set_locations("Greenwich", "");
+    assert_fresh();
+    set_locations("Rome", "");
+    TEST_ASSERT_EQUAL_UINT64(0, apps::weather::forecast_due_in_ms());
+    Counts counts = refresh();
+    TEST_ASSERT_EQUAL_UINT32(1, counts.geocodes);
+    TEST_ASSERT_EQUAL_UINT32(1, counts.forecasts);
+    TEST_ASSERT_EQUAL_UINT32(1, forecast_locations);
+    TEST_ASSERT_EQUAL_UINT32(2, counts.connections);
+    assert_fresh();
+}
+
+int main(int argc, char** argv) {
+    sim::set_rtc_us(1760000000LL * 1000000);
+    sim::set_http_handler(mock_server);
+    sim::set_wifi_available(true);
+    WiFi.mode(WIFI_STA);
+    WiFi.begin("ssid", "password");
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(100);
+    }
+    menu::init(); // A refresh wakes the app up
+    apps::weather::try_add_weather_job(); // Creates the mutex, the job itself is run here
+    UNITY_BEGIN();
+    RUN_TEST(test_first_refresh);
+    RUN_TEST(test_cached_refresh);
+    RUN_TEST(test_cache_survives_restart);
+    RUN_TEST(test_location_change);
+    return UNITY_END();
+}
@@ -0,0 +1,260 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+#include "constants.hpp"
+
+// Parses recorded shapes of the Nominatim and open-meteo responses with the filters the weather app builds, pinning
+// that one location needs an object filter and several an array one. A counting allocator reports the peak heap of
+// each parse with and without its filter, and checks that the filtered peak stays within a fixed budget whatever
+// the response carries besides the fields kept.
+
+namespace apps::weather {
+    void geocode_filter(JsonDocument& filter);
+    void forecast_filter(JsonDocument& filter, size_t count);
+}
+
+namespace {
+    constexpr size_t forecast_hours = 48;
+    constexpr uint32_t first_hour_s = 1760000400;
+    // Budgets of the filtered parses on a 64-bit host, where ArduinoJson 7 slots take twice the room they do on the
+    // ESP32-C3. The hourly forecast kept is about 150 values per location.
+    constexpr size_t max_geocode_peak = 6 * 1024;
+    constexpr size_t max_forecast_peak = 6 * 1024;
+    constexpr size_t max_forecasts_peak = 12 * 1024; // MAX_WEATHER_LOCATIONS
+    // What the parser may allocate for the keys it reads and drops, the content dropped must not count
+    constexpr size_t dropped_content_slack = 256;
+
+    // A Nominatim result, extra goes in with the fields the filter drops
+    String nominatim_json(const String& extra = "") {
+        return "[{\"place_id\":115829264,\"licence\":\"Data (c) OpenStreetMap contributors, ODbL 1.0. http://osm.org/copyright\","
+        "\"osm_type\":\"relation\",\"osm_id\":1606167,\"lat\":\"51.4825766\",\"lon\":\"-0.0076589\",\"class\":\"boundary\","
+        "\"type\":\"administrative\",\"place_rank\":12,\"importance\":0.6921,\"addresstype\":\"city\",\"name\":\"Greenwich\","
+        "\"display_name\":\"Royal Borough of Greenwich, London, Greater London, England, United Kingdom\","
+        "\"boundingbox\":[\"51.4189979\",\"51.5137290\",\"-0.0225101\",\"0.1395553\"]" + extra + "}]";
+    }
+
+    // The names in other languages that namedetails=1 adds, a few KB the filter drops
+    String name_details() {
+        String names = ",\"namedetails\":{\"name\":\"Royal Borough of Greenwich\"";
+        for (int language = 0; language < 60; ++language) {
+            names += ",\"name:l" + String(language) + "\":\"Royal Borough of Greenwich " + String(language) + "\"";
+        }
+        return names + "}";
+    }
+
+    // One location of an open-meteo response with timeformat=unixtime, as it comes alone or in the array, extra goes
+    // in with the fields the filter drops
+    String forecast_json(int base_temperature, const String& extra = "") {
+        String time = "[", temperature = "[", code = "[";
+        for (size_t hour = 0; hour < forecast_hours; ++hour) {
+            const char* separator = hour > 0 ? "," : "";
+            time += separator + String(first_hour_s + hour * 3600);
+            temperature += separator + String(base_temperature + static_cast<int>(hour % 7)) + ".4";
+            code += separator + String(hour % 4 == 3 ? 61 : static_cast<int>(hour % 4));
+        }
+        return "{\"latitude\":51.48,\"longitude\":-0.01,\"generationtime_ms\":0.0481,\"utc_offset_seconds\":0,"
+            "\"timezone\":\"GMT\",\"timezone_abbreviation\":\"GMT\",\"elevation\":12.0,"
+            "\"hourly_units\":{\"time\":\"unixtime\",\"temperature_2m\":\"\\u00b0C\",\"weather_code\":\"wmo code\"},"
+            "\"hourly\":{\"time\":" + time + "],\"temperature_2m\":" + temperature + "],\"weather_code\":" + code + "]}" + extra + "}";
+    }
+
+    // A day of the 15 minute forecast that minutely_15= adds, dropped by the filter
+    String minutely_15() {
+        String time = "[", temperature = "[";
+        for (int quarter = 0; quarter < 96; ++quarter) {
+            const char* separator = quarter > 0 ? "," : "";
+            time += separator + String(first_hour_s + quarter * 900);
+            temperature += separator + String(10 + quarter % 9) + ".25";
+        }
+        return ",\"minutely_15\":{\"time\":" + time + "],\"temperature_2m\":" + temperature + "]}";
+    }
+
+    String forecasts_json(size_t count, const String& extra = "") {
+        String json = "[";
+        for (size_t i = 0; i < count; ++i) {
+            json += (i > 0 ? "," : "") + forecast_json(10 + static_cast<int>(i), extra);
+        }
+        return json + "]";
+    }
+
+    // Tracks the bytes a JsonDocument holds, each block keeps its size in front of it
+    class CountingAllocator : public ArduinoJson::Allocator {
+        public:
+            void* allocate(size_t size) override {
+                void* block = malloc(size + header);
+                if (block == nullptr) {
+                    return nullptr;
+                }
+                *static_cast<size_t*>(block) = size;
+                add(size);
+                return static_cast<char*>(block) + header;
+            }
+
+            void deallocate(void* ptr) override {
+                if (ptr != nullptr) {
+                    void* block = static_cast<char*>(ptr) - header;
+                    in_use -= *static_cast<size_t*>(block);
+                    free(block);
+                }
+            }
+
+            void* reallocate(void* ptr, size_t new_size) override {
+                if (ptr == nullptr) {
+                    return allocate(new_size);
+                }
+                void* block = static_cast<char*>(ptr) - header;
+                size_t old_size = *static_cast<size_t*>(block);
+                void* moved = realloc(block, new_size + header);
+                if (moved == nullptr) {
+                    return nullptr;
+                }
+                *static_cast<size_t*>(moved) = new_size;
+                in_use -= old_size;
+                add(new_size);
+                return static_cast<char*>(moved) + header;
+            }
+
+            size_t peak = 0;
+
+        private:
+            static constexpr size_t header = alignof(std::max_align_t);
+            size_t in_use = 0;
+
+            void add(size_t size) {
+                in_use += size;
+                peak = in_use > peak ? in_use : peak;
+            }
+    };
+
+    // Peak heap of the document parsing json, with the filter or without one
+    size_t parse_peak(const String& json, const JsonDocument* filter) {
+        CountingAllocator allocator;
+        {
+            JsonDocument doc(&allocator);
+            DeserializationError error = filter != nullptr
+                ? deserializeJson(doc, json.c_str(), DeserializationOption::Filter(*filter))
+                : deserializeJson(doc, json.c_str());
+            TEST_ASSERT_FALSE_MESSAGE(error, error.c_str());
+        }
+        return allocator.peak;
+    }
+
+    // Reports the peak heap of a response with and without its filter and returns the filtered one
+    size_t report_peak(const char* name, const String& json, const JsonDocument& filter) {
+        size_t unfiltered = parse_peak(json, nullptr);
+        size_t filtered = parse_peak(json, &filter);
+        char message[128];
+        snprintf(message, sizeof(message), "%s, %u B: peak heap %u B without the filter, %u B with it", name,
+            static_cast<unsigned>(json.length()), static_cast<unsigned>(unfiltered), static_cast<unsigned>(filtered));
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(filtered < unfiltered);
+        return filtered;
+    }
+
+    // The filtered peak is within budget, and the same with more content around the fields kept
+    void assert_peak_bounded(const char* name, const String& json, const String& larger_json, const JsonDocument& filter,
+            size_t budget) {
+        size_t filtered = report_peak(name, json, filter);
+        String larger_name = String(name) + ", more dropped";
+        size_t larger_filtered = report_peak(larger_name.c_str(), larger_json, filter);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget, filtered);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(filtered + dropped_content_slack, larger_filtered);
+    }
+
+    // The hourly forecast the app reads, whole and with nothing else next to it
+    void assert_hourly_only(JsonVariantConst location, int base_temperature) {
+        TEST_ASSERT_EQUAL_UINT32(1, location.size());
+        TEST_ASSERT_TRUE(location["latitude"].isNull());
+        TEST_ASSERT_TRUE(location["hourly_units"].isNull());
+        JsonVariantConst hourly = location["hourly"];
+        TEST_ASSERT_EQUAL_UINT32(forecast_hours, hourly["time"].size());
+        TEST_ASSERT_EQUAL_UINT32(forecast_hours, hourly["temperature_2m"].size());
+        TEST_ASSERT_EQUAL_UINT32(forecast_hours, hourly["weather_code"].size());
+        TEST_ASSERT_EQUAL_UINT32(first_hour_s, hourly["time"][0].as<uint32_t>());
+        TEST_ASSERT_EQUAL_FLOAT(base_temperature + 47 % 7 + 0.4f, hourly["temperature_2m"][47].as<float>());
+        TEST_ASSERT_EQUAL_INT(61, hourly["weather_code"][47].as<int>());
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_single_location() {
+    // One location is answered with an object, kept by an object filter
+    JsonDocument filter;
+    apps::weather::forecast_filter(filter, 1);
+    JsonDocument doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc, forecast_json(12).c_str(), DeserializationOption::Filter(filter)));
+    assert_hourly_only(doc.as<JsonVariantConst>(), 12);
+
+    // An array filter lets nothing of the object through
+    JsonDocument array_filter;
+    apps::weather::forecast_filter(array_filter, 2);
+    TEST_ASSERT_FALSE(deserializeJson(doc, forecast_json(12).c_str(), DeserializationOption::Filter(array_filter)));
+    TEST_ASSERT_TRUE(doc.as<JsonVariantConst>()["hourly"].isNull());
+}
+
+void test_several_locations() {
+    // More than one location is answered with an array, the first element of the filter applies to each
+    JsonDocument filter;
+    apps::weather::forecast_filter(filter, MAX_WEATHER_LOCATIONS);
+    JsonDocument doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc, forecasts_json(MAX_WEATHER_LOCATIONS).c_str(), DeserializationOption::Filter(filter)));
+    JsonVariantConst root = doc.as<JsonVariantConst>();
+    TEST_ASSERT_EQUAL_UINT32(MAX_WEATHER_LOCATIONS, root.size());
+    for (size_t i = 0; i < MAX_WEATHER_LOCATIONS; ++i) {
+        assert_hourly_only(root[i], 10 + static_cast<int>(i));
+    }
+
+    // An object filter lets nothing of the array through
+    JsonDocument object_filter;
+    apps::weather::forecast_filter(object_filter, 1);
+    TEST_ASSERT_FALSE(deserializeJson(doc, forecasts_json(MAX_WEATHER_LOCATIONS).c_str(), DeserializationOption::Filter(object_filter)));
+    TEST_ASSERT_TRUE(doc.as<JsonVariantConst>()[0]["hourly"].isNull());
+}
+
+void test_geocode() {
+    JsonDocument filter;
+    apps::weather::geocode_filter(filter);
+    JsonDocument doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc, nominatim_json(name_details()).c_str(), DeserializationOption::Filter(filter)));
+    JsonVariantConst root = doc.as<JsonVariantConst>();
+    TEST_ASSERT_TRUE(root.is<JsonArray>());
+    TEST_ASSERT_EQUAL_UINT32(1, root.size());
+    TEST_ASSERT_EQUAL_UINT32(3, root[0].size());
+    TEST_ASSERT_TRUE(root[0]["boundingbox"].isNull());
+    TEST_ASSERT_TRUE(root[0]["namedetails"].isNull());
+    // Nominatim sends the coordinates as strings, they are converted when read as numbers
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 51.4825766f, root[0]["lat"].as<float>());
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, -0.0076589f, root[0]["lon"].as<float>());
+    TEST_ASSERT_EQUAL_STRING("Royal Borough of Greenwich, London, Greater London, England, United Kingdom",
+        root[0]["display_name"].as<const char*>());
+}
+
+void test_peak_heap() {
+    JsonDocument filter;
+    apps::weather::geocode_filter(filter);
+    assert_peak_bounded("Nominatim", nominatim_json(), nominatim_json(name_details()), filter, max_geocode_peak);
+    JsonDocument single_filter;
+    apps::weather::forecast_filter(single_filter, 1);
+    assert_peak_bounded("open-meteo, 1 location", forecast_json(12), forecast_json(12, minutely_15()), single_filter,
+        max_forecast_peak);
+    JsonDocument array_filter;
+    apps::weather::forecast_filter(array_filter, MAX_WEATHER_LOCATIONS);
+    assert_peak_bounded("open-meteo, all locations", forecasts_json(MAX_WEATHER_LOCATIONS),
+        forecasts_json(MAX_WEATHER_LOCATIONS, minutely_15()), array_filter, max_forecasts_peak);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_single_location);
+    RUN_TEST(test_several_locations);
+    RUN_TEST(test_geocode);
+    RUN_TEST(test_peak_heap);
+    return UNITY_END();
+}
@@ -0,0 +1,164 @@
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "constants.hpp"
+#include "core/widgets.hpp"
+
+// Pixels touched per navigation step by the retained widgets, against drawing the same screen from scratch as the
+// menu helpers did before. A pixel counts as touched if the step wrote it, whether or not its value changed: the
+// step is run once on the previous frame and once on its inverse, a written pixel ends up with the same value in
+// both runs while an untouched one keeps the value it started with. Rows the list scrolls with memmove only count
+// where the moved content differs from what was there.
+
+namespace menu {
+    extern widgets::KeyboardGrid keyboard_grid; // For the key layout of the real keyboard
+}
+
+namespace {
+    constexpr size_t BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+    Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+    uint8_t previous[BUFFER_SIZE]; // The frame the next step starts from
+
+    // Runs draw on the previous frame, which it must leave in the same state for every call, and returns the
+    // pixels it wrote. The display buffer is left with the new frame.
+    template <typename Draw>
+    uint32_t pixels_touched(Draw draw) {
+        uint8_t* buffer = display.getBuffer();
+        uint8_t inverted_result[BUFFER_SIZE];
+        for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            buffer[i] = ~previous[i];
+        }
+        draw();
+        memcpy(inverted_result, buffer, BUFFER_SIZE);
+        memcpy(buffer, previous, BUFFER_SIZE);
+        draw();
+        uint32_t touched = 0;
+        for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            uint8_t written = (buffer[i] ^ previous[i]) | (inverted_result[i] ^ static_cast<uint8_t>(~previous[i]));
+            touched += __builtin_popcount(written);
+        }
+        return touched;
+    }
+
+    struct Totals {
+        uint64_t retained;
+        uint64_t full;
+        uint32_t steps;
+    };
+
+    void report(const char* name, const Totals& totals) {
+        char message[128];
+        snprintf(message, sizeof(message), "%s: %llu pixels per step retained, %llu redrawing everything, over %u steps",
+            name, static_cast<unsigned long long>(totals.retained / totals.steps),
+            static_cast<unsigned long long>(totals.full / totals.steps), static_cast<unsigned>(totals.steps));
+        TEST_MESSAGE(message);
+    }
+
+    const char* const options[] = {
+        "Clock", "Stopwatch", "Timer", "Alarm", "Calendar", "Weather", "Map", "Temperature", "Pet", "Metronome",
+        "Music", "Flashlight", "Battery", "Event debugger", "Data log", "Settings", "WiFi", "Timezone", "About", "Power off",
+    };
+    constexpr size_t option_count = sizeof(options) / sizeof(options[0]);
+
+    struct ListScreen {
+        widgets::Screen screen;
+        widgets::TitleBar titlebar;
+        widgets::List list;
+    };
+
+    void draw_list_screen(ListScreen& state, size_t selected, bool retained) {
+        state.screen.retained = retained;
+        if (!retained) {
+            display.clearDisplay();
+        }
+        widgets::draw_titlebar(state.screen, state.titlebar, "Menu", display);
+        widgets::draw_list(state.screen, state.list, options, option_count, selected, display);
+    }
+
+    struct KeyboardScreen {
+        widgets::Screen screen;
+        widgets::KeyboardGrid grid;
+    };
+
+    void draw_keyboard_screen(KeyboardScreen& state, size_t selected, bool shifted, bool retained) {
+        state.screen.retained = retained;
+        if (!retained) {
+            display.clearDisplay();
+        }
+        widgets::draw_keyboard_grid(state.screen, state.grid, selected, shifted, display);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_list_navigation() {
+    ListScreen saved = {};
+    draw_list_screen(saved, 0, false);
+    memcpy(previous, display.getBuffer(), BUFFER_SIZE);
+    Totals moving = {}; // The cursor moves inside the visible rows
+    Totals scrolling = {};
+    // Down to the last option and back up, scrolling on the way
+    for (size_t step = 1; step < 2 * option_count - 1; step++) {
+        size_t selected = step < option_count ? step : 2 * option_count - 2 - step;
+        uint32_t full = pixels_touched([&] {
+            ListScreen state = saved;
+            draw_list_screen(state, selected, false);
+        });
+        ListScreen next = saved;
+        uint32_t retained = pixels_touched([&] {
+            next = saved;
+            draw_list_screen(next, selected, true);
+        });
+        Totals& totals = next.list.first != saved.list.first ? scrolling : moving;
+        totals.full += full;
+        totals.retained += retained;
+        totals.steps++;
+        saved = next;
+        memcpy(previous, display.getBuffer(), BUFFER_SIZE);
+    }
+    report("list, moving the cursor", moving);
+    report("list, scrolling", scrolling);
+    TEST_ASSERT_LESS_THAN_UINT64(moving.full / 2, moving.retained);
+    TEST_ASSERT_LESS_THAN_UINT64(scrolling.full, scrolling.retained);
+}
+
+void test_keyboard_navigation() {
+    KeyboardScreen saved = {};
+    saved.grid = menu::keyboard_grid;
+    draw_keyboard_screen(saved, 0, false, false);
+    memcpy(previous, display.getBuffer(), BUFFER_SIZE);
+    Totals totals = {};
+    // Every key in turn, then shift
+    for (size_t step = 1; step <= saved.grid.key_count; step++) {
+        size_t selected = step % saved.grid.key_count;
+        bool shifted = step == saved.grid.key_count;
+        totals.full += pixels_touched([&] {
+            KeyboardScreen state = saved;
+            draw_keyboard_screen(state, selected, shifted, false);
+        });
+        KeyboardScreen next = saved;
+        totals.retained += pixels_touched([&] {
+            next = saved;
+            draw_keyboard_screen(next, selected, shifted, true);
+        });
+        saved = next;
+        memcpy(previous, display.getBuffer(), BUFFER_SIZE);
+        totals.steps++;
+    }
+    report("keyboard", totals);
+    TEST_ASSERT_LESS_THAN_UINT64(totals.full / 4, totals.retained);
+}
+
+int main(int argc, char** argv) {
+    display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    UNITY_BEGIN();
+    RUN_TEST(test_list_navigation);
+    RUN_TEST(test_keyboard_navigation);
+    return UNITY_END();
+}
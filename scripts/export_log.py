@@ -0,0 +1,226 @@
+import argparse
+import csv
+import os
+import struct
+import sys
+import time
+
+# Downloads the data log and the button event trace of the watch over its USB-CDC port, see
+# board/src/core/transfer.hpp for the protocol. The entries are appended to CSV files, running it again only
+# fetches what was logged since, or what a cut transfer missed:
+#   python scripts/export_log.py /dev/ttyACM0
+# The native simulator exposes its serial port with --serial-pty.
+
+SYNC = 0xA5
+HELLO, READ, INFO, DATA, END, ERROR = 0x01, 0x02, 0x81, 0x82, 0x83, 0xFF
+RECORDS, EVENTS = 0, 1
+PROTOCOL_VERSION = 1
+NO_TEMPERATURE = -32768
+READ_CHUNK = 4096  # Entries per READ request, a lost frame costs at most one chunk
+TIMEOUT_S = 2.0
+
+RECORD_FORMAT = struct.Struct("<IIhhHH")  # sequence, time, internal, external, battery, crc
+TRACE_FORMAT = struct.Struct("<QIBBBB")  # timestamp, duration, type, button, hold, repeated
+EVENT_TYPES = {1: "press", 2: "release"}
+BUTTONS = {1: "A", 2: "B", 4: "UP", 8: "DOWN", 16: "LEFT", 32: "RIGHT"}
+
+
+def crc16(data):
+    """CRC-16/X-25, the esp_rom_crc16_le(0, ...) of the firmware"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8408 if crc & 1 else crc >> 1
+    return crc ^ 0xFFFF
+
+
+class Port:
+    """Raw byte access to the serial port, with pyserial if installed, termios otherwise"""
+
+    def __init__(self, path):
+        try:
+            import serial
+            self.serial = serial.Serial(path, 115200, timeout=0.1)
+            self.fd = None
+        except ImportError:
+            import termios
+            import tty
+            self.serial = None
+            self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+            tty.setraw(self.fd, termios.TCSANOW)
+
+    def write(self, data):
+        if self.serial is not None:
+            self.serial.write(data)
+        else:
+            os.write(self.fd, data)
+
+    def read(self):
+        if self.serial is not None:
+            return self.serial.read(self.serial.in_waiting or 1)
+        import select
+        ready, _, _ = select.select([self.fd], [], [], 0.1)
+        return os.read(self.fd, 65536) if ready else b""
+
+
+class Link:
+    def __init__(self, port):
+        self.port = port
+        self.buffer = bytearray()
+        self.skipped = 0  # Bytes that were not part of a valid frame, usually log lines
+
+    def send(self, frame_type, payload=b""):
+        body = bytes([frame_type]) + struct.pack("<H", len(payload)) + payload
+        self.port.write(bytes([SYNC]) + body + struct.pack("<H", crc16(body)))
+
+    def receive(self):
+        """Returns the next valid frame as (type, payload), None after TIMEOUT_S without one"""
+        deadline = time.monotonic() + TIMEOUT_S
+        while True:
+            frame = self.parse()
+            if frame is not None:
+                return frame
+            if time.monotonic() > deadline:
+                return None
+            self.buffer += self.port.read()
+
+    def parse(self):
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                self.skipped += len(self.buffer)
+                self.buffer.clear()
+                return None
+            self.skipped += start
+            del self.buffer[:start]
+            if len(self.buffer) < 4:
+                return None
+            length = struct.unpack_from("<H", self.buffer, 2)[0]
+            if len(self.buffer) < 4 + length + 2:
+                return None
+            body = bytes(self.buffer[1:4 + length])
+            if struct.unpack_from("<H", self.buffer, 4 + length)[0] == crc16(body):
+                del self.buffer[:4 + length + 2]
+                return body[0], body[3:]
+            # A 0xA5 in some text, look for the next one
+            self.skipped += 1
+            del self.buffer[:1]
+
+
+def hello(link):
+    for _ in range(3):
+        link.send(HELLO)
+        frame = link.receive()
+        if frame is not None and frame[0] == INFO:
+            payload = frame[1]
+            if payload[0] != PROTOCOL_VERSION:
+                raise RuntimeError(f"Unsupported protocol version {payload[0]}")
+            streams = []
+            for i in range(payload[1]):
+                streams.append(struct.unpack_from("<HII", payload, 2 + i * 10))
+            return streams
+    raise RuntimeError("No answer from the watch")
+
+
+def read_stream(link, stream, first, end, on_entry):
+    """Calls on_entry(sequence, data) for the entries in [first, end), returns the sequence to resume from"""
+    next_sequence = first
+    while next_sequence < end:
+        link.send(READ, struct.pack("<BII", stream, next_sequence, min(READ_CHUNK, end - next_sequence)))
+        while True:
+            frame = link.receive()
+            if frame is None:
+                break  # Lost frame or timeout, ask again from the last entry received
+            frame_type, payload = frame
+            if frame_type == DATA and payload[0] == stream:
+                sequence = struct.unpack_from("<I", payload, 1)[0]
+                if sequence > next_sequence:
+                    next_sequence = sequence  # The older entries were overwritten meanwhile
+                entries = payload[5:]
+                for offset in range(0, len(entries), 16):
+                    if sequence >= next_sequence:
+                        on_entry(sequence, entries[offset:offset + 16])
+                        next_sequence = sequence + 1
+                    sequence += 1
+            elif frame_type == END and payload[0] == stream:
+                next_sequence = max(next_sequence, struct.unpack_from("<I", payload, 1)[0])
+                break
+            elif frame_type == ERROR:
+                raise RuntimeError(f"The watch answered with error {payload[0]}")
+    return next_sequence
+
+
+def last_sequence(path):
+    """Sequence of the last row of a CSV written by a previous run, -1 if there is none"""
+    if not os.path.exists(path):
+        return -1
+    with open(path, newline="") as f:
+        rows = list(csv.reader(f))
+    return int(rows[-1][0]) if len(rows) > 1 else -1
+
+
+def export(link, stream, info, path, header, to_row):
+    entry_size, first, end = info
+    if entry_size != 16:
+        raise RuntimeError(f"Unexpected entry size {entry_size}")
+    start = max(first, last_sequence(path) + 1)
+    new_file = not os.path.exists(path)
+    count = 0
+    with open(path, "a", newline="") as f:
+        writer = csv.writer(f)
+        if new_file:
+            writer.writerow(header)
+
+        def on_entry(sequence, data):
+            nonlocal count
+            row = to_row(sequence, data)
+            if row is not None:
+                writer.writerow(row)
+                count += 1
+
+        read_stream(link, stream, start, end, on_entry)
+    return count
+
+
+def record_row(sequence, data):
+    stored_sequence, time_s, internal, external, battery, crc = RECORD_FORMAT.unpack(data)
+    if stored_sequence != sequence or crc != crc16(data[:14]):
+        return None  # Erased or torn record
+
+    def celsius(value):
+        return "" if value == NO_TEMPERATURE else f"{value / 100:.2f}"
+
+    return [sequence, time_s, celsius(internal), celsius(external), battery]
+
+
+def event_row(sequence, data):
+    if data == b"\xff" * 16:
+        return None  # No longer in the trace
+    timestamp, duration, event_type, button, hold, repeated = TRACE_FORMAT.unpack(data)
+    held = "+".join(name for bit, name in BUTTONS.items() if hold & bit)
+    return [sequence, timestamp, EVENT_TYPES.get(event_type, event_type), BUTTONS.get(button, button), held,
+            duration if event_type == 2 else "", repeated if event_type == 1 else ""]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Download the data log and the event trace of the watch")
+    parser.add_argument("port", help="serial port of the watch, e.g. /dev/ttyACM0 or COM3")
+    parser.add_argument("--records", default="records.csv", help="CSV the log records are appended to")
+    parser.add_argument("--events", default="events.csv", help="CSV the button events are appended to")
+    args = parser.parse_args()
+
+    link = Link(Port(args.port))
+    streams = hello(link)
+    started = time.monotonic()
+    records = export(link, RECORDS, streams[RECORDS], args.records,
+                     ["sequence", "time_s", "internal_c", "external_c", "battery_mv"], record_row)
+    events = export(link, EVENTS, streams[EVENTS], args.events,
+                    ["sequence", "timestamp_us", "type", "button", "hold", "duration_us", "repeated"], event_row)
+    elapsed = time.monotonic() - started
+    print(f"{records} records and {events} events in {elapsed:.2f} s, {link.skipped} bytes of text skipped",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
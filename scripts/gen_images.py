@@ -3,8 +3,15 @@ import numpy as np
 import glob
 import os
 
+from packbits import packbits, unpackbits
+
 image_path = "assets/images/*.png"
 output_base_path = "board/src/images/"
+# Packed images are decoded one screen-sized window at a time, smaller images are only stored raw
+screen_width = 128
+screen_height = 64
+# Widest packed image the firmware can decode, must match MAX_IMAGE_WIDTH in image.hpp
+max_image_width = 512
 # Clear and recreate output directory
 if os.path.exists(output_base_path):
     for f in glob.glob(os.path.join(output_base_path, "*")):
@@ -12,6 +19,14 @@ if os.path.exists(output_base_path):
 os.makedirs(output_base_path, exist_ok=True)
 
 total_bits = 0
+total_bytes = 0
+
+
+def format_bytes(data, per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("        " + ", ".join(f"0x{b:02x}" for b in data[i:i + per_line]) + ",\n")
+    return "".join(lines)
 
 all_images = glob.glob(image_path)
 if not all_images:
@@ -25,19 +40,14 @@ for img in all_images:
     logo_image = cv2.imread(logo_path, cv2.IMREAD_COLOR_RGB)
     assert logo_image is not None, f"Failed to load image {logo_path}"
 
-    output = \
-        "// This file was generated by gen_images.py\n" +\
-        "#pragma once\n" +\
-        "#include <Arduino.h>\n" +\
-        "#include <stdint.h>\n" +\
-        "#include <cstddef>\n\n" +\
-        f"namespace images {{\n" +\
-        f"    constexpr uint8_t {image_name}[] PROGMEM = {{\n"
     height, width, _ = logo_image.shape
     # Encode b/w pixels as 1 bit per pixel written as 0bXXXXXXXX
     # White pixel = 1, Black pixel = 0
+    raw_output = ""
+    rows = []
     for y in range(height):
         row_data = []
+        row_bytes = bytearray()
         for x in range(0, width, 8):
             byte = 0
             for bit in range(8):
@@ -49,16 +59,64 @@ for img in all_images:
                     else:
                         byte = (byte << 1) | 1
             row_data.append(f"0b{byte:08b}")
-        output += "        " + ", ".join(row_data) + ",\n"
+            row_bytes.append(byte)
+        raw_output += "        " + ", ".join(row_data) + ",\n"
+        rows.append(bytes(row_bytes))
+
+    # Rows are packed one by one so a viewport can start at any row, bands points at every 8th one
+    packed = bytearray()
+    bands = []
+    for y, row in enumerate(rows):
+        if y % 8 == 0:
+            bands.append(len(packed))
+        packed += packbits(row)
+    packed_size = len(packed) + 2 * len(bands)
+    raw_size = len(b"".join(rows))
+    use_packed = width >= screen_width and height >= screen_height and packed_size < raw_size
+    if use_packed:
+        assert width <= max_image_width, f"{image_name} is {width} pixels wide, the firmware decodes at most {max_image_width}"
+        assert bands[-1] < 2**16, f"{image_name} is too big for 16 bit band offsets"
+        # Round trip check
+        offset = 0
+        for y, row in enumerate(rows):
+            if y % 8 == 0:
+                assert offset == bands[y // 8]
+            decoded, used = unpackbits(packed[offset:], len(row))
+            assert decoded == row, f"Packed row {y} of {image_name} does not decode to the original"
+            offset += used
+
+    output = \
+        "// This file was generated by gen_images.py\n" +\
+        "#pragma once\n" +\
+        "#include <Arduino.h>\n" +\
+        "#include <stdint.h>\n" +\
+        "#include <cstddef>\n" +\
+        ("#include \"core/image.hpp\"\n" if use_packed else "") +\
+        "\n" +\
+        f"namespace images {{\n" +\
+        f"    constexpr uint8_t {image_name}[] PROGMEM = {{\n" +\
+        raw_output
     output += "    };\n"
     output += \
         f"    constexpr size_t {image_name}_width = {width};\n" +\
         f"    constexpr size_t {image_name}_height = {height};\n"
+    if use_packed:
+        output += \
+            f"    constexpr uint8_t {image_name}_packed_data[] PROGMEM = {{\n" +\
+            format_bytes(packed) +\
+            "    };\n" +\
+            f"    constexpr uint16_t {image_name}_packed_bands[] PROGMEM = {{\n" +\
+            "        " + ", ".join(str(b) for b in bands) + ",\n" +\
+            "    };\n" +\
+            f"    constexpr image::PackedImage {image_name}_packed = {{\n" +\
+            f"        {image_name}_packed_data, {image_name}_packed_bands, {image_name}_width, {image_name}_height\n" +\
+            "    };\n"
     output += "}\n"
     total_bits += width * height + 64 * 2
+    total_bytes += packed_size if use_packed else raw_size
 
     with open(output_path, "w") as f:
         f.write(output)
     print(f"Generated {output_path}")
 
-print(f"Total image size: {total_bits//8//1024}KB")
\ No newline at end of file
+print(f"Total image size: {total_bits//8//1024}KB, {total_bytes//1024}KB with packed images")
\ No newline at end of file
@@ -0,0 +1,111 @@
+import cv2
+import numpy as np
+import glob
+import os
+import re
+import struct
+
+from packbits import packbits, unpackbits
+
+# Every assets/maps/earth_<width>x<height>.png is one zoom level of an equirectangular world map,
+# the levels are cut in square tiles and every tile is PackBits coded as a whole, runs can span rows
+map_path = "assets/maps/earth_*.png"
+header_output_path = "board/src/maps/earth.hpp"
+# Levels up to this width are built into the firmware, all of them go to the image for the "maps" partition,
+# flash it with: esptool.py --chip esp32c3 write_flash 0x290000 board/maps.bin
+partition_output_path = "board/maps.bin"
+builtin_max_width = 512
+tile_size = 64
+
+# Layout, little endian:
+#   header:       "WMAP", u16 version, u16 tile size, u16 level count, u16 reserved
+#   level table:  u16 width, u16 height, u32 offset of the tile index, for each level
+#   tile indexes: u32 offset of each tile, row by row, plus one for the end of the last tile
+#   tile data
+version = 1
+
+
+def load_level(path):
+    image = cv2.imread(path, cv2.IMREAD_COLOR_RGB)
+    assert image is not None, f"Failed to load image {path}"
+    height, width, _ = image.shape
+    assert width % tile_size == 0 and height % tile_size == 0, f"{path} is not a multiple of {tile_size} pixels"
+    # White pixel = 1, Black pixel = 0, 1 bit per pixel with the leftmost pixel in the MSB
+    rows = []
+    for y in range(height):
+        row = bytearray()
+        for x in range(0, width, 8):
+            byte = 0
+            for bit in range(8):
+                byte = (byte << 1) | (0 if np.mean(image[y, x + bit]) < 128 else 1)
+            row.append(byte)
+        rows.append(bytes(row))
+    return width, height, rows
+
+
+def build_blob(levels):
+    header = b"WMAP" + struct.pack("<HHHH", version, tile_size, len(levels), 0)
+    level_table_size = 8 * len(levels)
+    index_sizes = [4 * ((width // tile_size) * (height // tile_size) + 1) for width, height, _ in levels]
+    offset = len(header) + level_table_size + sum(index_sizes)
+    level_table = bytearray()
+    indexes = bytearray()
+    data = bytearray()
+    index_offset = len(header) + level_table_size
+    for (width, height, rows), index_size in zip(levels, index_sizes):
+        level_table += struct.pack("<HHI", width, height, index_offset)
+        index_offset += index_size
+        bytes_per_tile_row = tile_size // 8
+        for tile_y in range(height // tile_size):
+            for tile_x in range(width // tile_size):
+                indexes += struct.pack("<I", offset + len(data))
+                tile = bytearray()
+                for y in range(tile_y * tile_size, (tile_y + 1) * tile_size):
+                    tile += rows[y][tile_x * bytes_per_tile_row:(tile_x + 1) * bytes_per_tile_row]
+                packed = packbits(tile)
+                assert unpackbits(packed, len(tile))[0] == tile, "PackBits round trip failed"
+                data += packed
+        indexes += struct.pack("<I", offset + len(data))
+    return header + level_table + indexes + data
+
+
+def format_bytes(data, per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("        " + ", ".join(f"0x{b:02x}" for b in data[i:i + per_line]) + ",\n")
+    return "".join(lines)
+
+
+all_levels = []
+for path in glob.glob(map_path):
+    match = re.search(r"earth_(\d+)x(\d+)\.png$", path)
+    if match:
+        all_levels.append((int(match.group(1)), path))
+if not all_levels:
+    raise FileNotFoundError(f"No maps found in {map_path}")
+all_levels.sort()
+
+levels = [load_level(path) for _, path in all_levels]
+builtin_levels = [level for level in levels if level[0] <= builtin_max_width]
+
+builtin_blob = build_blob(builtin_levels)
+output = \
+    "// This file was generated by gen_map_tiles.py\n" +\
+    "#pragma once\n" +\
+    "#include <Arduino.h>\n" +\
+    "#include <stdint.h>\n\n" +\
+    "namespace maps {\n" +\
+    "    // Zoom levels " + ", ".join(f"{width}x{height}" for width, height, _ in builtin_levels) + " in the tile store format\n" +\
+    "    constexpr uint8_t earth[] PROGMEM = {\n" +\
+    format_bytes(builtin_blob) +\
+    "    };\n" +\
+    "}\n"
+os.makedirs(os.path.dirname(header_output_path), exist_ok=True)
+with open(header_output_path, "w") as f:
+    f.write(output)
+print(f"Generated {header_output_path} with {len(builtin_levels)} levels, {len(builtin_blob)} bytes")
+
+partition_blob = build_blob(levels)
+with open(partition_output_path, "wb") as f:
+    f.write(partition_blob)
+print(f"Generated {partition_output_path} with {len(levels)} levels, {len(partition_blob)} bytes")
@@ -0,0 +1,39 @@
+# PackBits coder shared by gen_images.py and gen_map_tiles.py, the firmware decodes it with image::decode_rows
+
+
+def packbits(data):
+    """PackBits codes data: n < 128 copies the next n + 1 bytes, n > 128 repeats the next byte 257 - n times"""
+    output = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run > 1:
+            output += bytes([257 - run, data[i]])
+            i += run
+            continue
+        # Literals go on until a run of at least 3 bytes starts
+        end = i + 1
+        while end < len(data) and end - i < 128 and not (end + 2 < len(data) and data[end] == data[end + 1] == data[end + 2]):
+            end += 1
+        output += bytes([end - i - 1]) + data[i:end]
+        i = end
+    return bytes(output)
+
+
+def unpackbits(data, length):
+    """Decodes length bytes, returns them with the number of packed bytes used"""
+    output = bytearray()
+    i = 0
+    while len(output) < length:
+        header = data[i]
+        if header < 128:
+            output += data[i + 1:i + 2 + header]
+            i += 2 + header
+        elif header > 128:
+            output += bytes([data[i + 1]]) * (257 - header)
+            i += 2
+        else:
+            i += 1
+    return bytes(output), i